@@ -0,0 +1,20 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "DGtal" for configuration "Debug"
+set_property(TARGET DGtal APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(DGtal PROPERTIES
+  IMPORTED_LINK_INTERFACE_LIBRARIES_DEBUG "/usr/lib/x86_64-linux-gnu/libz.so;-lrt"
+  IMPORTED_LOCATION_DEBUG "/usr/local/lib/libDGtal.so"
+  IMPORTED_SONAME_DEBUG "libDGtal.so"
+  )
+
+list(APPEND _cmake_import_check_targets DGtal )
+list(APPEND _cmake_import_check_files_for_DGtal "/usr/local/lib/libDGtal.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
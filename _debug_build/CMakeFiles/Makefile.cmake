@@ -0,0 +1,551 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/BuildExamples.cmake"
+  "/root/repo/cmake/CheckCPP11.cmake"
+  "/root/repo/cmake/CheckCoverage.cmake"
+  "/root/repo/cmake/CheckDGtalDependencies.cmake"
+  "/root/repo/cmake/CheckDGtalOptionalDependencies.cmake"
+  "/root/repo/cmake/Common.cmake"
+  "/root/repo/cmake/CpackCtest.cmake"
+  "/root/repo/cmake/DGtalConfig.cmake.in"
+  "/root/repo/cmake/DGtalConfigGenerator.cmake"
+  "/root/repo/cmake/DGtalConfigVersion.cmake.in"
+  "/root/repo/cmake/FindEigen3.cmake"
+  "/root/repo/cmake/GeneratorSpecific.cmake"
+  "/root/repo/cmake/Install.cmake"
+  "/root/repo/cmake/NeighborhoodTablesConfig.cmake"
+  "/root/repo/cmake/OSDependentSettings.cmake"
+  "/root/repo/cmake/TargetDoxygenDoc.cmake"
+  "/root/repo/cmake/TargetDoxygenDox.cmake"
+  "/root/repo/cmake/TargetUninstall.cmake.in"
+  "/root/repo/cmake/doxygen.cmake"
+  "/root/repo/cmake/src/cpp11/cpp11_check.cpp"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/ConfigExamples.h.in"
+  "/root/repo/examples/arithmetic/CMakeLists.txt"
+  "/root/repo/examples/base/CMakeLists.txt"
+  "/root/repo/examples/dec/CMakeLists.txt"
+  "/root/repo/examples/doc-examples/CMakeLists.txt"
+  "/root/repo/examples/geometry/CMakeLists.txt"
+  "/root/repo/examples/geometry/curves/CMakeLists.txt"
+  "/root/repo/examples/geometry/curves/estimation/CMakeLists.txt"
+  "/root/repo/examples/geometry/surfaces/CMakeLists.txt"
+  "/root/repo/examples/geometry/tools/CMakeLists.txt"
+  "/root/repo/examples/geometry/tools/determinant/CMakeLists.txt"
+  "/root/repo/examples/geometry/volumes/CMakeLists.txt"
+  "/root/repo/examples/geometry/volumes/distance/CMakeLists.txt"
+  "/root/repo/examples/graph/CMakeLists.txt"
+  "/root/repo/examples/images/CMakeLists.txt"
+  "/root/repo/examples/io/CMakeLists.txt"
+  "/root/repo/examples/io/boards/CMakeLists.txt"
+  "/root/repo/examples/math/CMakeLists.txt"
+  "/root/repo/examples/shapes/CMakeLists.txt"
+  "/root/repo/examples/topology/CMakeLists.txt"
+  "/root/repo/examples/tutorial-examples/CMakeLists.txt"
+  "/root/repo/src/Board/ModuleSRC.txt"
+  "/root/repo/src/BoostAddons/ModuleSRC.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/DGtal/arithmetic/ModuleSRC.txt"
+  "/root/repo/src/DGtal/base/Config.h.in"
+  "/root/repo/src/DGtal/base/ModuleSRC.txt"
+  "/root/repo/src/DGtal/helpers/ModuleSRC.txt"
+  "/root/repo/src/DGtal/io/ModuleSRC.txt"
+  "/root/repo/src/DGtal/kernel/ModuleSRC.txt"
+  "/root/repo/src/DGtal/topology/tables/NeighborhoodTables.h.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/ConfigTest.h.in"
+  "/root/repo/tests/arithmetic/CMakeLists.txt"
+  "/root/repo/tests/base/CMakeLists.txt"
+  "/root/repo/tests/dec/CMakeLists.txt"
+  "/root/repo/tests/geometry/CMakeLists.txt"
+  "/root/repo/tests/geometry/curves/CMakeLists.txt"
+  "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt"
+  "/root/repo/tests/geometry/surfaces/CMakeLists.txt"
+  "/root/repo/tests/geometry/tools/CMakeLists.txt"
+  "/root/repo/tests/geometry/tools/determinant/CMakeLists.txt"
+  "/root/repo/tests/geometry/volumes/CMakeLists.txt"
+  "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt"
+  "/root/repo/tests/geometry/volumes/estimation/CMakeLists.txt"
+  "/root/repo/tests/graph/CMakeLists.txt"
+  "/root/repo/tests/helpers/CMakeLists.txt"
+  "/root/repo/tests/images/CMakeLists.txt"
+  "/root/repo/tests/io/CMakeLists.txt"
+  "/root/repo/tests/io/boards/CMakeLists.txt"
+  "/root/repo/tests/io/colormaps/CMakeLists.txt"
+  "/root/repo/tests/io/readers/CMakeLists.txt"
+  "/root/repo/tests/io/viewers/CMakeLists.txt"
+  "/root/repo/tests/io/writers/CMakeLists.txt"
+  "/root/repo/tests/kernel/CMakeLists.txt"
+  "/root/repo/tests/math/CMakeLists.txt"
+  "/root/repo/tests/math/linalg/CMakeLists.txt"
+  "/root/repo/tests/shapes/CMakeLists.txt"
+  "/root/repo/tests/topology/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "TargetUninstall.cmake"
+  "src/DGtal/base/Config.h"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "DartConfiguration.tcl"
+  "DGtalConfig.cmake"
+  "DGtalConfigVersion.cmake"
+  "InstallFiles/DGtalConfig.cmake"
+  "InstallFiles/DGtalConfigVersion.cmake"
+  "src/DGtal/topology/tables/NeighborhoodTables.h"
+  "InstallFiles/NeighborhoodTables.h"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/ConfigTest.h"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/kernel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/math/linalg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/arithmetic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/curves/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/volumes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/volumes/estimation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/surfaces/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/tools/determinant/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/graph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/viewers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/boards/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/colormaps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/readers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/writers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/images/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/helpers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/shapes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/ConfigExamples.h"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/images/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/io/boards/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/curves/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/curves/estimation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/surfaces/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/volumes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/volumes/distance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/geometry/tools/determinant/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/doc-examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/tutorial-examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/arithmetic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/shapes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/graph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/dec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/distclean.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/lcov.dir/DependInfo.cmake"
+  "CMakeFiles/_base.dir/DependInfo.cmake"
+  "CMakeFiles/_math.dir/DependInfo.cmake"
+  "CMakeFiles/_kernel.dir/DependInfo.cmake"
+  "CMakeFiles/_topology.dir/DependInfo.cmake"
+  "CMakeFiles/_geometry.dir/DependInfo.cmake"
+  "CMakeFiles/_io.dir/DependInfo.cmake"
+  "CMakeFiles/_images.dir/DependInfo.cmake"
+  "CMakeFiles/_shapes.dir/DependInfo.cmake"
+  "CMakeFiles/_arithmetic.dir/DependInfo.cmake"
+  "CMakeFiles/_graph.dir/DependInfo.cmake"
+  "CMakeFiles/_helpers.dir/DependInfo.cmake"
+  "CMakeFiles/_dec.dir/DependInfo.cmake"
+  "tests/CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testBasicBoolFunctors.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOrderedAlphabet.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCirculator.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testConstIteratorAdapter.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testProgressBar.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testBasicFunctors.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testConstRangeAdapter.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOutputIteratorAdapter.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testClock.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testTrace.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCountedPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCountedPtrOrPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCountedConstPtrOrConstPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testAtomicCountedPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testBits.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testIndexedListWithBlocks.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testLabels.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testLabelledMap.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testLabelledMap-benchmark.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testMultiMap-benchmark.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOpenMP.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testIteratorFunctions.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testIteratorCirculatorTraits.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCloneAndAliases.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testClone2.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOwningOrAliasingPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCatch.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testPartialTemplateSpecialization.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testContainerTraits.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testSetFunctions.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOpenAddressingMap.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testSimpleRandomAccessRangeFromPoint.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testDigitalSet.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testDomainSpanIterator.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testHyperRectDomain.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testHyperRectDomain-snippet.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testHyperRectDomainScanlineRange.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testInteger.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointVector.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointVector-catch.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointVectorContainers.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointVectorKernel.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testLinearAlgebra.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testImagesSetsUtilities.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testBasicPointFunctors.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testEmbedder.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointPredicateConcepts.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointHashFunctions.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testLinearizer.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testSimpleRegression.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMeasure.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testSignal.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testStatistics.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testHistogram.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMPolynomial.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testCompiledMPolynomial.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testAngleLinearMinimizer.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testBasicMathFunctions.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMultiStatistics.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testProfile.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMeaningfulScaleAnalysis.dir/DependInfo.cmake"
+  "tests/math/linalg/CMakeFiles/testSimpleMatrix.dir/DependInfo.cmake"
+  "tests/math/linalg/CMakeFiles/testEigenDecomposition.dir/DependInfo.cmake"
+  "tests/math/linalg/CMakeFiles/testClosedFormEigenDecomposition.dir/DependInfo.cmake"
+  "tests/math/linalg/CMakeFiles/testEigenSolver.dir/DependInfo.cmake"
+  "tests/arithmetic/CMakeFiles/testModuloComputer.dir/DependInfo.cmake"
+  "tests/arithmetic/CMakeFiles/testPattern.dir/DependInfo.cmake"
+  "tests/geometry/CMakeFiles/testContourHelper.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithDSS3d.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testFreemanChain.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testSegmentation.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testFP.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testGridCurve.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testCombinDSS.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testStabbingLineComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testStabbingCircleComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testBinomialConvolver.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testFrechetShortcut.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSS.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSLKernel.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSSComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSL.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testDSLSubsegment.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithDSSIterator.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSSConvexHull.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testAlphaThickSegmentComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLengthEstimators.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testTrueLocalEstimator.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testEstimatorComparator.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testSegmentComputerEstimators.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testMostCenteredMSEstimator.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLambdaMST2D.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLambdaMST3D.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testKanungo.dir/DependInfo.cmake"
+  "tests/geometry/volumes/estimation/CMakeFiles/testMeasureSet.dir/DependInfo.cmake"
+  "tests/geometry/volumes/estimation/CMakeFiles/testVoronoiCovarianceMeasure.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDistanceTransformation.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDistanceTransformationND.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDistanceTransformationMetrics.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testReverseDT.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testFMM.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testVoronoiMap.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testMetrics.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testMetricBalls.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testPowerMap.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testReducedMedialAxis.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testReverseDistanceTransformationBySlabs.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testSeparableMetricAdapter.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testChamferDT.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testChamferVoro.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDigitalMetricAdapter.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testChordGenericStandardPlaneComputer.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testNormalVectorEstimatorEmbedder.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testIntegralInvariantVolumeEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testIntegralInvariantCovarianceEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testLocalEstimatorFromFunctorAdapter.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testTensorVoting.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testEstimatorCache.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testSphericalHoughNormalVectorEstimator.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testRayIntersection.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testPreimage.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testSphericalAccumulator.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testHullFunctions2D.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testPolarPointComparatorBy2x2DetComputer.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testConvexHull2D.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testConvexHull2DThickness.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testConvexHull2DReverse.dir/DependInfo.cmake"
+  "tests/geometry/tools/determinant/CMakeFiles/test2x2DetComputers.dir/DependInfo.cmake"
+  "tests/geometry/tools/determinant/CMakeFiles/testInHalfPlane.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testBreadthFirstPropagation.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testBitmapMarkSet.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testDepthFirstPropagation.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testObjectBoostGraphInterface.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testDistancePropagation.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testExpander.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testSTLMapToVertexMapAdapter.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testAdjacency.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testKhalimskySpaceND.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testCubicalComplex.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testDigitalSurface.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testDigitalTopology.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testObject.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testComponentLabelling.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testObjectBorder.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSimpleExpander.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSCellsFunctor.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testUmbrellaComputer.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSurfaceHelper.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testDigitalSetToCellularGridConverter.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testNeighborhoodConfigurations.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testParDirCollapse.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSurfelNeighborhoodIndex.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testIndexedDigitalSurface.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testParallelTrackBoundary.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testLabelBoundaries.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testColor.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testSimpleBoard.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testBoard2DCustomStyle.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testLongvol.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testArcDrawing.dir/DependInfo.cmake"
+  "tests/io/boards/CMakeFiles/testBoard3D.dir/DependInfo.cmake"
+  "tests/io/boards/CMakeFiles/testBallQuad.dir/DependInfo.cmake"
+  "tests/io/colormaps/CMakeFiles/testTickedColorMap.dir/DependInfo.cmake"
+  "tests/io/colormaps/CMakeFiles/testColorMaps.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testPNMReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testVolReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testRawReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testGenericReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testPointListReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testTableReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testMeshReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testMPolynomialReader.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testCompressedVolWriter.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testPNMRawWriter.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testMeshWriter.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testGenericWriter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageSimple.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageAdapter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageCache.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testTiledImage.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testConstImageAdapter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImage.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageSpanIterators.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testCheckImageConcept.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testMorton.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testHashTree.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testSliceImageFromFunctor.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testRigidTransformation2D.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testRigidTransformation3D.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageResampler.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageSpanEvaluator.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testArrayImageAdapter.dir/DependInfo.cmake"
+  "tests/helpers/CMakeFiles/testParametricShape.dir/DependInfo.cmake"
+  "tests/helpers/CMakeFiles/testImplicitShape.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testGaussDigitizer.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testHalfPlane.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testImplicitFunctionModels.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testShapesFromPoints.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testMesh.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testCompactMesh.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testBoundaryMesher.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testScanlineDigitizer.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testBall3DSurface.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testEuclideanShapesDecorator.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testDigitalShapesDecorator.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testDiscreteExteriorCalculus.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testLinearStructure.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testDiscreteExteriorCalculusExtended.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testEmbedding.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testStencilOperator.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testMultigridSolver.dir/DependInfo.cmake"
+  "tests/dec/CMakeFiles/testDiscreteExteriorCalculusSolver.dir/DependInfo.cmake"
+  "src/CMakeFiles/DGtal.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/exampleConstImageAdapter.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/exampleTiledImage.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/extract2DImagesFrom3D.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/extract2DSlicesImagesFrom3D.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/imageBasicSubsampling.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/exampleRigidtransformation2d.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/exampleRigidtransformation3d.dir/DependInfo.cmake"
+  "examples/images/CMakeFiles/exampleArrayImageAdapter.dir/DependInfo.cmake"
+  "examples/io/CMakeFiles/display3DToOFF.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard2D-1-points.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard2D-2-sets.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard2D-3-custom-classes.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard2D-3-custom-points.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard2D-4-colormaps.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard3D-1-points.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard3D-2-ks.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/dgtalBoard3D-6-clipping.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/logoDGtal.dir/DependInfo.cmake"
+  "examples/io/boards/CMakeFiles/exampleBezierCurve.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/greedy-dss-decomposition.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/greedyAlphaThickDecomposition.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/convex-and-concave-parts.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleAlphaThickSegment.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleAlphaThickSegmentNoisy.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleAlphaThickSegmentTgtCover.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleGridCurve2d.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleStabbingLineComputer.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleStabbingCircleComputer.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleFrechetShortcut.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleArithmeticalDSS.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleArithmeticalDSSComputer.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleDSLSubsegment.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleArithmeticalDSL.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleNaive3DDSSComputer.dir/DependInfo.cmake"
+  "examples/geometry/curves/CMakeFiles/exampleArithDSSIterator.dir/DependInfo.cmake"
+  "examples/geometry/curves/estimation/CMakeFiles/exampleCurvature.dir/DependInfo.cmake"
+  "examples/geometry/curves/estimation/CMakeFiles/exampleLMST2D.dir/DependInfo.cmake"
+  "examples/geometry/curves/estimation/CMakeFiles/exampleLMST3D.dir/DependInfo.cmake"
+  "examples/geometry/surfaces/CMakeFiles/exampleIntegralInvariantCurvature2D.dir/DependInfo.cmake"
+  "examples/geometry/surfaces/CMakeFiles/exampleEstimatorFromSurfelFunctors.dir/DependInfo.cmake"
+  "examples/geometry/surfaces/CMakeFiles/dvcm-2d-curvature.dir/DependInfo.cmake"
+  "examples/geometry/volumes/CMakeFiles/dvcm-2d.dir/DependInfo.cmake"
+  "examples/geometry/volumes/distance/CMakeFiles/toricdomainvolumetric.dir/DependInfo.cmake"
+  "examples/geometry/volumes/distance/CMakeFiles/distancetransform2D.dir/DependInfo.cmake"
+  "examples/geometry/volumes/distance/CMakeFiles/exampleFMM2D.dir/DependInfo.cmake"
+  "examples/geometry/volumes/distance/CMakeFiles/voronoimap2D.dir/DependInfo.cmake"
+  "examples/geometry/tools/CMakeFiles/examplePreimage.dir/DependInfo.cmake"
+  "examples/geometry/tools/CMakeFiles/exampleConvexHull2D.dir/DependInfo.cmake"
+  "examples/geometry/tools/CMakeFiles/exampleAlphaShape.dir/DependInfo.cmake"
+  "examples/geometry/tools/determinant/CMakeFiles/exampleInHalfPlane.dir/DependInfo.cmake"
+  "examples/doc-examples/CMakeFiles/demo-kernel-1.dir/DependInfo.cmake"
+  "examples/doc-examples/CMakeFiles/kernelDomain.dir/DependInfo.cmake"
+  "examples/doc-examples/CMakeFiles/range.dir/DependInfo.cmake"
+  "examples/doc-examples/CMakeFiles/labelledMapBestParameters.dir/DependInfo.cmake"
+  "examples/doc-examples/CMakeFiles/exampleCatch.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/imageSetDT.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/fileGridCurveRanges.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/imageGridCurveEstimator.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/shapeGridCurveEstimator.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/freemanChainFromImage.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/FMMErosion.dir/DependInfo.cmake"
+  "examples/tutorial-examples/CMakeFiles/2DSliceImageFromVol.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/ctopo-1.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/ctopo-2.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/ctopo-fillContours.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/khalimskySpaceScanner.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/volMarchingCubes.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/volToOFF.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/trackImplicitPolynomialSurfaceToOFF.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/generateSimplicityTables2D.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/generateSimplicityTables3D.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/digitalSetToCubicalComplexes2D.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/cubical-complex-illustrations.dir/DependInfo.cmake"
+  "examples/topology/CMakeFiles/cubicalComplexThinning.dir/DependInfo.cmake"
+  "examples/math/CMakeFiles/polynomial-derivative.dir/DependInfo.cmake"
+  "examples/math/CMakeFiles/polynomial2-derivative.dir/DependInfo.cmake"
+  "examples/math/CMakeFiles/polynomial-read.dir/DependInfo.cmake"
+  "examples/arithmetic/CMakeFiles/approximation.dir/DependInfo.cmake"
+  "examples/arithmetic/CMakeFiles/convergents.dir/DependInfo.cmake"
+  "examples/arithmetic/CMakeFiles/fraction.dir/DependInfo.cmake"
+  "examples/arithmetic/CMakeFiles/pattern.dir/DependInfo.cmake"
+  "examples/arithmetic/CMakeFiles/lower-integer-convex-hull.dir/DependInfo.cmake"
+  "examples/shapes/CMakeFiles/exampleEuclideanShapesDecorator.dir/DependInfo.cmake"
+  "examples/graph/CMakeFiles/graphTraversal.dir/DependInfo.cmake"
+  "examples/base/CMakeFiles/exampleIteratorCompletion.dir/DependInfo.cmake"
+  )
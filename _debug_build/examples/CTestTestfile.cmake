@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_debug_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("images")
+subdirs("io")
+subdirs("geometry")
+subdirs("doc-examples")
+subdirs("tutorial-examples")
+subdirs("topology")
+subdirs("math")
+subdirs("arithmetic")
+subdirs("shapes")
+subdirs("graph")
+subdirs("dec")
+subdirs("base")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/approximation.dir/approximation.cpp.o"
+  "CMakeFiles/approximation.dir/approximation.cpp.o.d"
+  "approximation"
+  "approximation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/approximation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
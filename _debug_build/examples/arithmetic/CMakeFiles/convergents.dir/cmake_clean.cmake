@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convergents.dir/convergents.cpp.o"
+  "CMakeFiles/convergents.dir/convergents.cpp.o.d"
+  "convergents"
+  "convergents.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convergents.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
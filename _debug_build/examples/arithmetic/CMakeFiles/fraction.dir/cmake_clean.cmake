@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fraction.dir/fraction.cpp.o"
+  "CMakeFiles/fraction.dir/fraction.cpp.o.d"
+  "fraction"
+  "fraction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fraction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
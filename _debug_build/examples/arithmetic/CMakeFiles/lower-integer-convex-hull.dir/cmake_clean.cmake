@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lower-integer-convex-hull.dir/lower-integer-convex-hull.cpp.o"
+  "CMakeFiles/lower-integer-convex-hull.dir/lower-integer-convex-hull.cpp.o.d"
+  "lower-integer-convex-hull"
+  "lower-integer-convex-hull.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lower-integer-convex-hull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pattern.dir/pattern.cpp.o"
+  "CMakeFiles/pattern.dir/pattern.cpp.o.d"
+  "pattern"
+  "pattern.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pattern.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleIteratorCompletion.dir/exampleIteratorCompletion.cpp.o"
+  "CMakeFiles/exampleIteratorCompletion.dir/exampleIteratorCompletion.cpp.o.d"
+  "exampleIteratorCompletion"
+  "exampleIteratorCompletion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleIteratorCompletion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
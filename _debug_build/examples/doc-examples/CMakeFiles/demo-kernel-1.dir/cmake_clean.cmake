@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demo-kernel-1.dir/demo-kernel-1.cpp.o"
+  "CMakeFiles/demo-kernel-1.dir/demo-kernel-1.cpp.o.d"
+  "demo-kernel-1"
+  "demo-kernel-1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/demo-kernel-1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
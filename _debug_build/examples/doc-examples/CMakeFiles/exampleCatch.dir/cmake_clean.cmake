@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleCatch.dir/exampleCatch.cpp.o"
+  "CMakeFiles/exampleCatch.dir/exampleCatch.cpp.o.d"
+  "exampleCatch"
+  "exampleCatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleCatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
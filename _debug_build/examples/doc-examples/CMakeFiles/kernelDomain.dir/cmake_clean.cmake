@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/kernelDomain.dir/kernelDomain.cpp.o"
+  "CMakeFiles/kernelDomain.dir/kernelDomain.cpp.o.d"
+  "kernelDomain"
+  "kernelDomain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/kernelDomain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/labelledMapBestParameters.dir/labelledMapBestParameters.cpp.o"
+  "CMakeFiles/labelledMapBestParameters.dir/labelledMapBestParameters.cpp.o.d"
+  "labelledMapBestParameters"
+  "labelledMapBestParameters.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/labelledMapBestParameters.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
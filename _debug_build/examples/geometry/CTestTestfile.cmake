@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/geometry
+# Build directory: /root/repo/_debug_build/examples/geometry
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("curves")
+subdirs("surfaces")
+subdirs("volumes")
+subdirs("tools")
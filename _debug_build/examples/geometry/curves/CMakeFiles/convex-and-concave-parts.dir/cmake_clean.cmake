@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convex-and-concave-parts.dir/convex-and-concave-parts.cpp.o"
+  "CMakeFiles/convex-and-concave-parts.dir/convex-and-concave-parts.cpp.o.d"
+  "convex-and-concave-parts"
+  "convex-and-concave-parts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convex-and-concave-parts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleAlphaThickSegment.dir/exampleAlphaThickSegment.cpp.o"
+  "CMakeFiles/exampleAlphaThickSegment.dir/exampleAlphaThickSegment.cpp.o.d"
+  "exampleAlphaThickSegment"
+  "exampleAlphaThickSegment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleAlphaThickSegment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleAlphaThickSegmentNoisy.dir/exampleAlphaThickSegmentNoisy.cpp.o"
+  "CMakeFiles/exampleAlphaThickSegmentNoisy.dir/exampleAlphaThickSegmentNoisy.cpp.o.d"
+  "exampleAlphaThickSegmentNoisy"
+  "exampleAlphaThickSegmentNoisy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleAlphaThickSegmentNoisy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleAlphaThickSegmentTgtCover.dir/exampleAlphaThickSegmentTgtCover.cpp.o"
+  "CMakeFiles/exampleAlphaThickSegmentTgtCover.dir/exampleAlphaThickSegmentTgtCover.cpp.o.d"
+  "exampleAlphaThickSegmentTgtCover"
+  "exampleAlphaThickSegmentTgtCover.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleAlphaThickSegmentTgtCover.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleArithDSSIterator.dir/exampleArithDSSIterator.cpp.o"
+  "CMakeFiles/exampleArithDSSIterator.dir/exampleArithDSSIterator.cpp.o.d"
+  "exampleArithDSSIterator"
+  "exampleArithDSSIterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleArithDSSIterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
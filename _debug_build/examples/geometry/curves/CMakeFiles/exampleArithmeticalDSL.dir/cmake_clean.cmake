@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleArithmeticalDSL.dir/exampleArithmeticalDSL.cpp.o"
+  "CMakeFiles/exampleArithmeticalDSL.dir/exampleArithmeticalDSL.cpp.o.d"
+  "exampleArithmeticalDSL"
+  "exampleArithmeticalDSL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleArithmeticalDSL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
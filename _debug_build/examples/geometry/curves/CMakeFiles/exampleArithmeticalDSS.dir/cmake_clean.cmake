@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleArithmeticalDSS.dir/exampleArithmeticalDSS.cpp.o"
+  "CMakeFiles/exampleArithmeticalDSS.dir/exampleArithmeticalDSS.cpp.o.d"
+  "exampleArithmeticalDSS"
+  "exampleArithmeticalDSS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleArithmeticalDSS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
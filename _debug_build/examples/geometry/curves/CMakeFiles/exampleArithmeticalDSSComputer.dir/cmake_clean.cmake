@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleArithmeticalDSSComputer.dir/exampleArithmeticalDSSComputer.cpp.o"
+  "CMakeFiles/exampleArithmeticalDSSComputer.dir/exampleArithmeticalDSSComputer.cpp.o.d"
+  "exampleArithmeticalDSSComputer"
+  "exampleArithmeticalDSSComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleArithmeticalDSSComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
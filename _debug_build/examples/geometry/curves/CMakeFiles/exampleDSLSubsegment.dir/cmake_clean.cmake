@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleDSLSubsegment.dir/exampleDSLSubsegment.cpp.o"
+  "CMakeFiles/exampleDSLSubsegment.dir/exampleDSLSubsegment.cpp.o.d"
+  "exampleDSLSubsegment"
+  "exampleDSLSubsegment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleDSLSubsegment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
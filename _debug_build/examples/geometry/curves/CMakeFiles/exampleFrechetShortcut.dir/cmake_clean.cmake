@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleFrechetShortcut.dir/exampleFrechetShortcut.cpp.o"
+  "CMakeFiles/exampleFrechetShortcut.dir/exampleFrechetShortcut.cpp.o.d"
+  "exampleFrechetShortcut"
+  "exampleFrechetShortcut.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleFrechetShortcut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
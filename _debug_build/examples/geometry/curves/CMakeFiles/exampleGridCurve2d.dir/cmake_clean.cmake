@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleGridCurve2d.dir/exampleGridCurve2d.cpp.o"
+  "CMakeFiles/exampleGridCurve2d.dir/exampleGridCurve2d.cpp.o.d"
+  "exampleGridCurve2d"
+  "exampleGridCurve2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleGridCurve2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
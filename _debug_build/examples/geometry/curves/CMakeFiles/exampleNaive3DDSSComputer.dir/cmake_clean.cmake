@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleNaive3DDSSComputer.dir/exampleNaive3DDSSComputer.cpp.o"
+  "CMakeFiles/exampleNaive3DDSSComputer.dir/exampleNaive3DDSSComputer.cpp.o.d"
+  "exampleNaive3DDSSComputer"
+  "exampleNaive3DDSSComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleNaive3DDSSComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleStabbingCircleComputer.dir/exampleStabbingCircleComputer.cpp.o"
+  "CMakeFiles/exampleStabbingCircleComputer.dir/exampleStabbingCircleComputer.cpp.o.d"
+  "exampleStabbingCircleComputer"
+  "exampleStabbingCircleComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleStabbingCircleComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
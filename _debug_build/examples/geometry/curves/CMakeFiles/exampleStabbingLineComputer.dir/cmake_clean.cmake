@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleStabbingLineComputer.dir/exampleStabbingLineComputer.cpp.o"
+  "CMakeFiles/exampleStabbingLineComputer.dir/exampleStabbingLineComputer.cpp.o.d"
+  "exampleStabbingLineComputer"
+  "exampleStabbingLineComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleStabbingLineComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/greedy-dss-decomposition.dir/greedy-dss-decomposition.cpp.o"
+  "CMakeFiles/greedy-dss-decomposition.dir/greedy-dss-decomposition.cpp.o.d"
+  "greedy-dss-decomposition"
+  "greedy-dss-decomposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/greedy-dss-decomposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
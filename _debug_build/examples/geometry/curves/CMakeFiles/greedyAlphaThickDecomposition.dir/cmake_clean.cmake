@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/greedyAlphaThickDecomposition.dir/greedyAlphaThickDecomposition.cpp.o"
+  "CMakeFiles/greedyAlphaThickDecomposition.dir/greedyAlphaThickDecomposition.cpp.o.d"
+  "greedyAlphaThickDecomposition"
+  "greedyAlphaThickDecomposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/greedyAlphaThickDecomposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
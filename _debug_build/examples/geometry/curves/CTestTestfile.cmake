@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/geometry/curves
+# Build directory: /root/repo/_debug_build/examples/geometry/curves
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("estimation")
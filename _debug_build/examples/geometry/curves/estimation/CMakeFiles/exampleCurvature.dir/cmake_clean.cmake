@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleCurvature.dir/exampleCurvature.cpp.o"
+  "CMakeFiles/exampleCurvature.dir/exampleCurvature.cpp.o.d"
+  "exampleCurvature"
+  "exampleCurvature.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleCurvature.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
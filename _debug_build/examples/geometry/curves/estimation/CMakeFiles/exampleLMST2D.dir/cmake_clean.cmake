@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleLMST2D.dir/exampleLMST2D.cpp.o"
+  "CMakeFiles/exampleLMST2D.dir/exampleLMST2D.cpp.o.d"
+  "exampleLMST2D"
+  "exampleLMST2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleLMST2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleLMST3D.dir/exampleLMST3D.cpp.o"
+  "CMakeFiles/exampleLMST3D.dir/exampleLMST3D.cpp.o.d"
+  "exampleLMST3D"
+  "exampleLMST3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleLMST3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
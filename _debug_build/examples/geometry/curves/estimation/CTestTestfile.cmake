@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/geometry/curves/estimation
+# Build directory: /root/repo/_debug_build/examples/geometry/curves/estimation
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dvcm-2d-curvature.dir/dvcm-2d-curvature.cpp.o"
+  "CMakeFiles/dvcm-2d-curvature.dir/dvcm-2d-curvature.cpp.o.d"
+  "dvcm-2d-curvature"
+  "dvcm-2d-curvature.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dvcm-2d-curvature.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
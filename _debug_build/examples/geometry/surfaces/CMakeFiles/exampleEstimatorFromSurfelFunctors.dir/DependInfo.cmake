@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/geometry/surfaces/exampleEstimatorFromSurfelFunctors.cpp" "examples/geometry/surfaces/CMakeFiles/exampleEstimatorFromSurfelFunctors.dir/exampleEstimatorFromSurfelFunctors.cpp.o" "gcc" "examples/geometry/surfaces/CMakeFiles/exampleEstimatorFromSurfelFunctors.dir/exampleEstimatorFromSurfelFunctors.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/CMakeFiles/DGtal.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
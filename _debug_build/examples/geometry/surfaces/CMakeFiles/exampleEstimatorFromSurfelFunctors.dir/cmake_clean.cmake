@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleEstimatorFromSurfelFunctors.dir/exampleEstimatorFromSurfelFunctors.cpp.o"
+  "CMakeFiles/exampleEstimatorFromSurfelFunctors.dir/exampleEstimatorFromSurfelFunctors.cpp.o.d"
+  "exampleEstimatorFromSurfelFunctors"
+  "exampleEstimatorFromSurfelFunctors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleEstimatorFromSurfelFunctors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
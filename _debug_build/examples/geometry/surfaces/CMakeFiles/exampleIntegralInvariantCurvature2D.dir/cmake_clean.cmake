@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleIntegralInvariantCurvature2D.dir/exampleIntegralInvariantCurvature2D.cpp.o"
+  "CMakeFiles/exampleIntegralInvariantCurvature2D.dir/exampleIntegralInvariantCurvature2D.cpp.o.d"
+  "exampleIntegralInvariantCurvature2D"
+  "exampleIntegralInvariantCurvature2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleIntegralInvariantCurvature2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
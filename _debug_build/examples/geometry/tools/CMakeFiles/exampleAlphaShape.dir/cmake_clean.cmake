@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleAlphaShape.dir/exampleAlphaShape.cpp.o"
+  "CMakeFiles/exampleAlphaShape.dir/exampleAlphaShape.cpp.o.d"
+  "exampleAlphaShape"
+  "exampleAlphaShape.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleAlphaShape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
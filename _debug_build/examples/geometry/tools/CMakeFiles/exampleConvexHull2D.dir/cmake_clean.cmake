@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleConvexHull2D.dir/exampleConvexHull2D.cpp.o"
+  "CMakeFiles/exampleConvexHull2D.dir/exampleConvexHull2D.cpp.o.d"
+  "exampleConvexHull2D"
+  "exampleConvexHull2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleConvexHull2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
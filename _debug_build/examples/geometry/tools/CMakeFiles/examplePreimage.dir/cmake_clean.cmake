@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/examplePreimage.dir/examplePreimage.cpp.o"
+  "CMakeFiles/examplePreimage.dir/examplePreimage.cpp.o.d"
+  "examplePreimage"
+  "examplePreimage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/examplePreimage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/geometry/tools
+# Build directory: /root/repo/_debug_build/examples/geometry/tools
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("determinant")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleInHalfPlane.dir/exampleInHalfPlane.cpp.o"
+  "CMakeFiles/exampleInHalfPlane.dir/exampleInHalfPlane.cpp.o.d"
+  "exampleInHalfPlane"
+  "exampleInHalfPlane.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleInHalfPlane.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dvcm-2d.dir/dvcm-2d.cpp.o"
+  "CMakeFiles/dvcm-2d.dir/dvcm-2d.cpp.o.d"
+  "dvcm-2d"
+  "dvcm-2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dvcm-2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
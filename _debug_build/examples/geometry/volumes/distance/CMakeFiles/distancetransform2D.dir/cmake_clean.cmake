@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/distancetransform2D.dir/distancetransform2D.cpp.o"
+  "CMakeFiles/distancetransform2D.dir/distancetransform2D.cpp.o.d"
+  "distancetransform2D"
+  "distancetransform2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distancetransform2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleFMM2D.dir/exampleFMM2D.cpp.o"
+  "CMakeFiles/exampleFMM2D.dir/exampleFMM2D.cpp.o.d"
+  "exampleFMM2D"
+  "exampleFMM2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleFMM2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/toricdomainvolumetric.dir/toricdomainvolumetric.cpp.o"
+  "CMakeFiles/toricdomainvolumetric.dir/toricdomainvolumetric.cpp.o.d"
+  "toricdomainvolumetric"
+  "toricdomainvolumetric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toricdomainvolumetric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/voronoimap2D.dir/voronoimap2D.cpp.o"
+  "CMakeFiles/voronoimap2D.dir/voronoimap2D.cpp.o.d"
+  "voronoimap2D"
+  "voronoimap2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/voronoimap2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
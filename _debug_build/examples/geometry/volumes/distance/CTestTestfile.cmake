@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/geometry/volumes/distance
+# Build directory: /root/repo/_debug_build/examples/geometry/volumes/distance
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
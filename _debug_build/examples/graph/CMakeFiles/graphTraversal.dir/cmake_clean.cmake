@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphTraversal.dir/graphTraversal.cpp.o"
+  "CMakeFiles/graphTraversal.dir/graphTraversal.cpp.o.d"
+  "graphTraversal"
+  "graphTraversal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphTraversal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
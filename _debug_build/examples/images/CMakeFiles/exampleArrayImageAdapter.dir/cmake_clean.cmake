@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleArrayImageAdapter.dir/exampleArrayImageAdapter.cpp.o"
+  "CMakeFiles/exampleArrayImageAdapter.dir/exampleArrayImageAdapter.cpp.o.d"
+  "exampleArrayImageAdapter"
+  "exampleArrayImageAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleArrayImageAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleConstImageAdapter.dir/exampleConstImageAdapter.cpp.o"
+  "CMakeFiles/exampleConstImageAdapter.dir/exampleConstImageAdapter.cpp.o.d"
+  "exampleConstImageAdapter"
+  "exampleConstImageAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleConstImageAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
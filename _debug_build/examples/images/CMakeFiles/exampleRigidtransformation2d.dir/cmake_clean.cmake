@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleRigidtransformation2d.dir/exampleRigidtransformation2d.cpp.o"
+  "CMakeFiles/exampleRigidtransformation2d.dir/exampleRigidtransformation2d.cpp.o.d"
+  "exampleRigidtransformation2d"
+  "exampleRigidtransformation2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleRigidtransformation2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
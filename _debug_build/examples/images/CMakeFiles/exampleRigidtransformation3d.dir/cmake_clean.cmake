@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleRigidtransformation3d.dir/exampleRigidtransformation3d.cpp.o"
+  "CMakeFiles/exampleRigidtransformation3d.dir/exampleRigidtransformation3d.cpp.o.d"
+  "exampleRigidtransformation3d"
+  "exampleRigidtransformation3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleRigidtransformation3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
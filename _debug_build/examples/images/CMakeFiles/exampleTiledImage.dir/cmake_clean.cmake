@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleTiledImage.dir/exampleTiledImage.cpp.o"
+  "CMakeFiles/exampleTiledImage.dir/exampleTiledImage.cpp.o.d"
+  "exampleTiledImage"
+  "exampleTiledImage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleTiledImage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extract2DImagesFrom3D.dir/extract2DImagesFrom3D.cpp.o"
+  "CMakeFiles/extract2DImagesFrom3D.dir/extract2DImagesFrom3D.cpp.o.d"
+  "extract2DImagesFrom3D"
+  "extract2DImagesFrom3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extract2DImagesFrom3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
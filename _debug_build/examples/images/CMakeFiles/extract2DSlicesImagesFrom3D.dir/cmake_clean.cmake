@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/extract2DSlicesImagesFrom3D.dir/extract2DSlicesImagesFrom3D.cpp.o"
+  "CMakeFiles/extract2DSlicesImagesFrom3D.dir/extract2DSlicesImagesFrom3D.cpp.o.d"
+  "extract2DSlicesImagesFrom3D"
+  "extract2DSlicesImagesFrom3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extract2DSlicesImagesFrom3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imageBasicSubsampling.dir/imageBasicSubsampling.cpp.o"
+  "CMakeFiles/imageBasicSubsampling.dir/imageBasicSubsampling.cpp.o.d"
+  "imageBasicSubsampling"
+  "imageBasicSubsampling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imageBasicSubsampling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
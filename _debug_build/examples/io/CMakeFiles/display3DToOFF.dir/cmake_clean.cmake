@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/display3DToOFF.dir/display3DToOFF.cpp.o"
+  "CMakeFiles/display3DToOFF.dir/display3DToOFF.cpp.o.d"
+  "display3DToOFF"
+  "display3DToOFF.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/display3DToOFF.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
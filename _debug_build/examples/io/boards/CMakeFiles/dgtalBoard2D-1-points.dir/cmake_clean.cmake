@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard2D-1-points.dir/dgtalBoard2D-1-points.cpp.o"
+  "CMakeFiles/dgtalBoard2D-1-points.dir/dgtalBoard2D-1-points.cpp.o.d"
+  "dgtalBoard2D-1-points"
+  "dgtalBoard2D-1-points.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard2D-1-points.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
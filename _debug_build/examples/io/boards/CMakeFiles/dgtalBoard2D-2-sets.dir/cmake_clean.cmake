@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard2D-2-sets.dir/dgtalBoard2D-2-sets.cpp.o"
+  "CMakeFiles/dgtalBoard2D-2-sets.dir/dgtalBoard2D-2-sets.cpp.o.d"
+  "dgtalBoard2D-2-sets"
+  "dgtalBoard2D-2-sets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard2D-2-sets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
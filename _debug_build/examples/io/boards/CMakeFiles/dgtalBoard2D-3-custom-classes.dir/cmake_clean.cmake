@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard2D-3-custom-classes.dir/dgtalBoard2D-3-custom-classes.cpp.o"
+  "CMakeFiles/dgtalBoard2D-3-custom-classes.dir/dgtalBoard2D-3-custom-classes.cpp.o.d"
+  "dgtalBoard2D-3-custom-classes"
+  "dgtalBoard2D-3-custom-classes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard2D-3-custom-classes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
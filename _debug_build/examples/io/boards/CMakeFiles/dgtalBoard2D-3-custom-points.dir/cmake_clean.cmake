@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard2D-3-custom-points.dir/dgtalBoard2D-3-custom-points.cpp.o"
+  "CMakeFiles/dgtalBoard2D-3-custom-points.dir/dgtalBoard2D-3-custom-points.cpp.o.d"
+  "dgtalBoard2D-3-custom-points"
+  "dgtalBoard2D-3-custom-points.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard2D-3-custom-points.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard2D-4-colormaps.dir/dgtalBoard2D-4-colormaps.cpp.o"
+  "CMakeFiles/dgtalBoard2D-4-colormaps.dir/dgtalBoard2D-4-colormaps.cpp.o.d"
+  "dgtalBoard2D-4-colormaps"
+  "dgtalBoard2D-4-colormaps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard2D-4-colormaps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard3D-1-points.dir/dgtalBoard3D-1-points.cpp.o"
+  "CMakeFiles/dgtalBoard3D-1-points.dir/dgtalBoard3D-1-points.cpp.o.d"
+  "dgtalBoard3D-1-points"
+  "dgtalBoard3D-1-points.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard3D-1-points.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
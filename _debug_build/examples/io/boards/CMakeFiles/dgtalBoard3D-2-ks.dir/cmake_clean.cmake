@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard3D-2-ks.dir/dgtalBoard3D-2-ks.cpp.o"
+  "CMakeFiles/dgtalBoard3D-2-ks.dir/dgtalBoard3D-2-ks.cpp.o.d"
+  "dgtalBoard3D-2-ks"
+  "dgtalBoard3D-2-ks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard3D-2-ks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dgtalBoard3D-6-clipping.dir/dgtalBoard3D-6-clipping.cpp.o"
+  "CMakeFiles/dgtalBoard3D-6-clipping.dir/dgtalBoard3D-6-clipping.cpp.o.d"
+  "dgtalBoard3D-6-clipping"
+  "dgtalBoard3D-6-clipping.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dgtalBoard3D-6-clipping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
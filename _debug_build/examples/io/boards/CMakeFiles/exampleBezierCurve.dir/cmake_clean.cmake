@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleBezierCurve.dir/exampleBezierCurve.cpp.o"
+  "CMakeFiles/exampleBezierCurve.dir/exampleBezierCurve.cpp.o.d"
+  "exampleBezierCurve"
+  "exampleBezierCurve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleBezierCurve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/logoDGtal.dir/logoDGtal.cpp.o"
+  "CMakeFiles/logoDGtal.dir/logoDGtal.cpp.o.d"
+  "logoDGtal"
+  "logoDGtal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logoDGtal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomial-derivative.dir/polynomial-derivative.cpp.o"
+  "CMakeFiles/polynomial-derivative.dir/polynomial-derivative.cpp.o.d"
+  "polynomial-derivative"
+  "polynomial-derivative.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomial-derivative.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
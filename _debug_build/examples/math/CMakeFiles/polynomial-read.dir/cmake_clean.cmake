@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomial-read.dir/polynomial-read.cpp.o"
+  "CMakeFiles/polynomial-read.dir/polynomial-read.cpp.o.d"
+  "polynomial-read"
+  "polynomial-read.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomial-read.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/polynomial2-derivative.dir/polynomial2-derivative.cpp.o"
+  "CMakeFiles/polynomial2-derivative.dir/polynomial2-derivative.cpp.o.d"
+  "polynomial2-derivative"
+  "polynomial2-derivative.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/polynomial2-derivative.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/exampleEuclideanShapesDecorator.dir/exampleEuclideanShapesDecorator.cpp.o"
+  "CMakeFiles/exampleEuclideanShapesDecorator.dir/exampleEuclideanShapesDecorator.cpp.o.d"
+  "exampleEuclideanShapesDecorator"
+  "exampleEuclideanShapesDecorator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exampleEuclideanShapesDecorator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
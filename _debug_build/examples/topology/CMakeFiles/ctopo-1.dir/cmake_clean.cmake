@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctopo-1.dir/ctopo-1.cpp.o"
+  "CMakeFiles/ctopo-1.dir/ctopo-1.cpp.o.d"
+  "ctopo-1"
+  "ctopo-1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctopo-1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctopo-2.dir/ctopo-2.cpp.o"
+  "CMakeFiles/ctopo-2.dir/ctopo-2.cpp.o.d"
+  "ctopo-2"
+  "ctopo-2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctopo-2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
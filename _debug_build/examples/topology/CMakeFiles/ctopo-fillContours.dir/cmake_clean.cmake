@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ctopo-fillContours.dir/ctopo-fillContours.cpp.o"
+  "CMakeFiles/ctopo-fillContours.dir/ctopo-fillContours.cpp.o.d"
+  "ctopo-fillContours"
+  "ctopo-fillContours.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ctopo-fillContours.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
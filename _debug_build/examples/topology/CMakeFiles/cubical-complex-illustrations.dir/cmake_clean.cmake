@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cubical-complex-illustrations.dir/cubical-complex-illustrations.cpp.o"
+  "CMakeFiles/cubical-complex-illustrations.dir/cubical-complex-illustrations.cpp.o.d"
+  "cubical-complex-illustrations"
+  "cubical-complex-illustrations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cubical-complex-illustrations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
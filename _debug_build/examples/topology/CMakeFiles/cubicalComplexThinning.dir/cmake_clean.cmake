@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cubicalComplexThinning.dir/cubicalComplexThinning.cpp.o"
+  "CMakeFiles/cubicalComplexThinning.dir/cubicalComplexThinning.cpp.o.d"
+  "cubicalComplexThinning"
+  "cubicalComplexThinning.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cubicalComplexThinning.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/digitalSetToCubicalComplexes2D.dir/digitalSetToCubicalComplexes2D.cpp.o"
+  "CMakeFiles/digitalSetToCubicalComplexes2D.dir/digitalSetToCubicalComplexes2D.cpp.o.d"
+  "digitalSetToCubicalComplexes2D"
+  "digitalSetToCubicalComplexes2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/digitalSetToCubicalComplexes2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generateSimplicityTables2D.dir/generateSimplicityTables2D.cpp.o"
+  "CMakeFiles/generateSimplicityTables2D.dir/generateSimplicityTables2D.cpp.o.d"
+  "generateSimplicityTables2D"
+  "generateSimplicityTables2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generateSimplicityTables2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generateSimplicityTables3D.dir/generateSimplicityTables3D.cpp.o"
+  "CMakeFiles/generateSimplicityTables3D.dir/generateSimplicityTables3D.cpp.o.d"
+  "generateSimplicityTables3D"
+  "generateSimplicityTables3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generateSimplicityTables3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
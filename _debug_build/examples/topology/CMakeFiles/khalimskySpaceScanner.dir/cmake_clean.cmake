@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/khalimskySpaceScanner.dir/khalimskySpaceScanner.cpp.o"
+  "CMakeFiles/khalimskySpaceScanner.dir/khalimskySpaceScanner.cpp.o.d"
+  "khalimskySpaceScanner"
+  "khalimskySpaceScanner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/khalimskySpaceScanner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
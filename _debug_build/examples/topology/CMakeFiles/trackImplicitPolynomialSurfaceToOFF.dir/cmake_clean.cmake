@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trackImplicitPolynomialSurfaceToOFF.dir/trackImplicitPolynomialSurfaceToOFF.cpp.o"
+  "CMakeFiles/trackImplicitPolynomialSurfaceToOFF.dir/trackImplicitPolynomialSurfaceToOFF.cpp.o.d"
+  "trackImplicitPolynomialSurfaceToOFF"
+  "trackImplicitPolynomialSurfaceToOFF.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trackImplicitPolynomialSurfaceToOFF.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/volMarchingCubes.dir/volMarchingCubes.cpp.o"
+  "CMakeFiles/volMarchingCubes.dir/volMarchingCubes.cpp.o.d"
+  "volMarchingCubes"
+  "volMarchingCubes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/volMarchingCubes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/volToOFF.dir/volToOFF.cpp.o"
+  "CMakeFiles/volToOFF.dir/volToOFF.cpp.o.d"
+  "volToOFF"
+  "volToOFF.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/volToOFF.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "2DSliceImageFromVol"
+  "2DSliceImageFromVol.pdb"
+  "CMakeFiles/2DSliceImageFromVol.dir/2DSliceImageFromVol.cpp.o"
+  "CMakeFiles/2DSliceImageFromVol.dir/2DSliceImageFromVol.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/2DSliceImageFromVol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FMMErosion.dir/FMMErosion.cpp.o"
+  "CMakeFiles/FMMErosion.dir/FMMErosion.cpp.o.d"
+  "FMMErosion"
+  "FMMErosion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FMMErosion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
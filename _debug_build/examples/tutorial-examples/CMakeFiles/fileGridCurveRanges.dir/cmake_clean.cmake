@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fileGridCurveRanges.dir/fileGridCurveRanges.cpp.o"
+  "CMakeFiles/fileGridCurveRanges.dir/fileGridCurveRanges.cpp.o.d"
+  "fileGridCurveRanges"
+  "fileGridCurveRanges.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fileGridCurveRanges.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
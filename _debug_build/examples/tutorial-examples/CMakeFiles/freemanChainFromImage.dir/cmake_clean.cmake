@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/freemanChainFromImage.dir/freemanChainFromImage.cpp.o"
+  "CMakeFiles/freemanChainFromImage.dir/freemanChainFromImage.cpp.o.d"
+  "freemanChainFromImage"
+  "freemanChainFromImage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/freemanChainFromImage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imageGridCurveEstimator.dir/imageGridCurveEstimator.cpp.o"
+  "CMakeFiles/imageGridCurveEstimator.dir/imageGridCurveEstimator.cpp.o.d"
+  "imageGridCurveEstimator"
+  "imageGridCurveEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imageGridCurveEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imageSetDT.dir/imageSetDT.cpp.o"
+  "CMakeFiles/imageSetDT.dir/imageSetDT.cpp.o.d"
+  "imageSetDT"
+  "imageSetDT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imageSetDT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shapeGridCurveEstimator.dir/shapeGridCurveEstimator.cpp.o"
+  "CMakeFiles/shapeGridCurveEstimator.dir/shapeGridCurveEstimator.cpp.o.d"
+  "shapeGridCurveEstimator"
+  "shapeGridCurveEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shapeGridCurveEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
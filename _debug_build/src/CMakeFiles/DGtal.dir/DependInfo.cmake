@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Board/Board.cpp" "src/CMakeFiles/DGtal.dir/Board/Board.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/Board.cpp.o.d"
+  "/root/repo/src/Board/PSFonts.cpp" "src/CMakeFiles/DGtal.dir/Board/PSFonts.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/PSFonts.cpp.o.d"
+  "/root/repo/src/Board/Path.cpp" "src/CMakeFiles/DGtal.dir/Board/Path.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/Path.cpp.o.d"
+  "/root/repo/src/Board/Rect.cpp" "src/CMakeFiles/DGtal.dir/Board/Rect.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/Rect.cpp.o.d"
+  "/root/repo/src/Board/ShapeList.cpp" "src/CMakeFiles/DGtal.dir/Board/ShapeList.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/ShapeList.cpp.o.d"
+  "/root/repo/src/Board/Shapes.cpp" "src/CMakeFiles/DGtal.dir/Board/Shapes.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/Shapes.cpp.o.d"
+  "/root/repo/src/Board/Tools.cpp" "src/CMakeFiles/DGtal.dir/Board/Tools.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/Tools.cpp.o.d"
+  "/root/repo/src/Board/Transforms.cpp" "src/CMakeFiles/DGtal.dir/Board/Transforms.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/Board/Transforms.cpp.o.d"
+  "/root/repo/src/BoostAddons/zlib.cpp" "src/CMakeFiles/DGtal.dir/BoostAddons/zlib.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/BoostAddons/zlib.cpp.o.d"
+  "/root/repo/src/DGtal/arithmetic/LightSternBrocot.cpp" "src/CMakeFiles/DGtal.dir/DGtal/arithmetic/LightSternBrocot.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/arithmetic/LightSternBrocot.cpp.o.d"
+  "/root/repo/src/DGtal/arithmetic/LighterSternBrocot.cpp" "src/CMakeFiles/DGtal.dir/DGtal/arithmetic/LighterSternBrocot.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/arithmetic/LighterSternBrocot.cpp.o.d"
+  "/root/repo/src/DGtal/arithmetic/SternBrocot.cpp" "src/CMakeFiles/DGtal.dir/DGtal/arithmetic/SternBrocot.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/arithmetic/SternBrocot.cpp.o.d"
+  "/root/repo/src/DGtal/base/Bits.cpp" "src/CMakeFiles/DGtal.dir/DGtal/base/Bits.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/base/Bits.cpp.o.d"
+  "/root/repo/src/DGtal/base/Common.cpp" "src/CMakeFiles/DGtal.dir/DGtal/base/Common.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/base/Common.cpp.o.d"
+  "/root/repo/src/DGtal/helpers/StdDefs.cpp" "src/CMakeFiles/DGtal.dir/DGtal/helpers/StdDefs.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/helpers/StdDefs.cpp.o.d"
+  "/root/repo/src/DGtal/io/Color.cpp" "src/CMakeFiles/DGtal.dir/DGtal/io/Color.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/io/Color.cpp.o.d"
+  "/root/repo/src/DGtal/io/boards/Board2D.cpp" "src/CMakeFiles/DGtal.dir/DGtal/io/boards/Board2D.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/io/boards/Board2D.cpp.o.d"
+  "/root/repo/src/DGtal/io/boards/Board3D.cpp" "src/CMakeFiles/DGtal.dir/DGtal/io/boards/Board3D.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/io/boards/Board3D.cpp.o.d"
+  "/root/repo/src/DGtal/kernel/NumberTraits.cpp" "src/CMakeFiles/DGtal.dir/DGtal/kernel/NumberTraits.cpp.o" "gcc" "src/CMakeFiles/DGtal.dir/DGtal/kernel/NumberTraits.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
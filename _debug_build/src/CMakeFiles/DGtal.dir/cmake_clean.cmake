@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DGtal.dir/Board/Board.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/Board.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/PSFonts.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/PSFonts.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/Path.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/Path.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/Rect.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/Rect.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/ShapeList.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/ShapeList.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/Shapes.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/Shapes.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/Tools.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/Tools.cpp.o.d"
+  "CMakeFiles/DGtal.dir/Board/Transforms.cpp.o"
+  "CMakeFiles/DGtal.dir/Board/Transforms.cpp.o.d"
+  "CMakeFiles/DGtal.dir/BoostAddons/zlib.cpp.o"
+  "CMakeFiles/DGtal.dir/BoostAddons/zlib.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/arithmetic/LightSternBrocot.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/arithmetic/LightSternBrocot.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/arithmetic/LighterSternBrocot.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/arithmetic/LighterSternBrocot.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/arithmetic/SternBrocot.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/arithmetic/SternBrocot.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/base/Bits.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/base/Bits.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/base/Common.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/base/Common.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/helpers/StdDefs.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/helpers/StdDefs.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/io/Color.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/io/Color.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/io/boards/Board2D.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/io/boards/Board2D.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/io/boards/Board3D.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/io/boards/Board3D.cpp.o.d"
+  "CMakeFiles/DGtal.dir/DGtal/kernel/NumberTraits.cpp.o"
+  "CMakeFiles/DGtal.dir/DGtal/kernel/NumberTraits.cpp.o.d"
+  "libDGtal.pdb"
+  "libDGtal.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DGtal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_debug_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("base")
+subdirs("kernel")
+subdirs("math")
+subdirs("arithmetic")
+subdirs("geometry")
+subdirs("graph")
+subdirs("topology")
+subdirs("io")
+subdirs("images")
+subdirs("helpers")
+subdirs("shapes")
+subdirs("dec")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAtomicCountedPtr.dir/testAtomicCountedPtr.cpp.o"
+  "CMakeFiles/testAtomicCountedPtr.dir/testAtomicCountedPtr.cpp.o.d"
+  "testAtomicCountedPtr"
+  "testAtomicCountedPtr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAtomicCountedPtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
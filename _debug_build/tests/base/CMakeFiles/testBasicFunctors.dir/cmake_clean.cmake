@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBasicFunctors.dir/testBasicFunctors.cpp.o"
+  "CMakeFiles/testBasicFunctors.dir/testBasicFunctors.cpp.o.d"
+  "testBasicFunctors"
+  "testBasicFunctors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBasicFunctors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCatch.dir/testCatch.cpp.o"
+  "CMakeFiles/testCatch.dir/testCatch.cpp.o.d"
+  "testCatch"
+  "testCatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
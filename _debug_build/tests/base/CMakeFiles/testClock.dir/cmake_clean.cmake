@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testClock.dir/testClock.cpp.o"
+  "CMakeFiles/testClock.dir/testClock.cpp.o.d"
+  "testClock"
+  "testClock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testClock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testClone2.dir/testClone2.cpp.o"
+  "CMakeFiles/testClone2.dir/testClone2.cpp.o.d"
+  "testClone2"
+  "testClone2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testClone2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
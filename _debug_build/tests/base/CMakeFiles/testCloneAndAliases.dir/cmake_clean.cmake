@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCloneAndAliases.dir/testCloneAndAliases.cpp.o"
+  "CMakeFiles/testCloneAndAliases.dir/testCloneAndAliases.cpp.o.d"
+  "testCloneAndAliases"
+  "testCloneAndAliases.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCloneAndAliases.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
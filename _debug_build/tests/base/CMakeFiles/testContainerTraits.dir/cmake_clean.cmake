@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testContainerTraits.dir/testContainerTraits.cpp.o"
+  "CMakeFiles/testContainerTraits.dir/testContainerTraits.cpp.o.d"
+  "testContainerTraits"
+  "testContainerTraits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testContainerTraits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCountedPtr.dir/testCountedPtr.cpp.o"
+  "CMakeFiles/testCountedPtr.dir/testCountedPtr.cpp.o.d"
+  "testCountedPtr"
+  "testCountedPtr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCountedPtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMultiMap-benchmark.dir/testMultiMap-benchmark.cpp.o"
+  "CMakeFiles/testMultiMap-benchmark.dir/testMultiMap-benchmark.cpp.o.d"
+  "testMultiMap-benchmark"
+  "testMultiMap-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMultiMap-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
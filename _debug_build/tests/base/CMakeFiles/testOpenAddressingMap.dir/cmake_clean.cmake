@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testOpenAddressingMap.dir/testOpenAddressingMap.cpp.o"
+  "CMakeFiles/testOpenAddressingMap.dir/testOpenAddressingMap.cpp.o.d"
+  "testOpenAddressingMap"
+  "testOpenAddressingMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testOpenAddressingMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testOpenMP.dir/testOpenMP.cpp.o"
+  "CMakeFiles/testOpenMP.dir/testOpenMP.cpp.o.d"
+  "testOpenMP"
+  "testOpenMP.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testOpenMP.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
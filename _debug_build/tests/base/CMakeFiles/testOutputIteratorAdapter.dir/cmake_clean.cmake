@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testOutputIteratorAdapter.dir/testOutputIteratorAdapter.cpp.o"
+  "CMakeFiles/testOutputIteratorAdapter.dir/testOutputIteratorAdapter.cpp.o.d"
+  "testOutputIteratorAdapter"
+  "testOutputIteratorAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testOutputIteratorAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testOwningOrAliasingPtr.dir/testOwningOrAliasingPtr.cpp.o"
+  "CMakeFiles/testOwningOrAliasingPtr.dir/testOwningOrAliasingPtr.cpp.o.d"
+  "testOwningOrAliasingPtr"
+  "testOwningOrAliasingPtr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testOwningOrAliasingPtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
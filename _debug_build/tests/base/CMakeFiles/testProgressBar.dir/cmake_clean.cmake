@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testProgressBar.dir/testProgressBar.cpp.o"
+  "CMakeFiles/testProgressBar.dir/testProgressBar.cpp.o.d"
+  "testProgressBar"
+  "testProgressBar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testProgressBar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
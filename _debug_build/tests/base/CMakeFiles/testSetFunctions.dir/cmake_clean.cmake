@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSetFunctions.dir/testSetFunctions.cpp.o"
+  "CMakeFiles/testSetFunctions.dir/testSetFunctions.cpp.o.d"
+  "testSetFunctions"
+  "testSetFunctions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSetFunctions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTrace.dir/testTrace.cpp.o"
+  "CMakeFiles/testTrace.dir/testTrace.cpp.o.d"
+  "testTrace"
+  "testTrace.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTrace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
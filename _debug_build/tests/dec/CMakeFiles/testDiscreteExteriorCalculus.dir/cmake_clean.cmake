@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDiscreteExteriorCalculus.dir/testDiscreteExteriorCalculus.cpp.o"
+  "CMakeFiles/testDiscreteExteriorCalculus.dir/testDiscreteExteriorCalculus.cpp.o.d"
+  "testDiscreteExteriorCalculus"
+  "testDiscreteExteriorCalculus.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDiscreteExteriorCalculus.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDiscreteExteriorCalculusExtended.dir/testDiscreteExteriorCalculusExtended.cpp.o"
+  "CMakeFiles/testDiscreteExteriorCalculusExtended.dir/testDiscreteExteriorCalculusExtended.cpp.o.d"
+  "testDiscreteExteriorCalculusExtended"
+  "testDiscreteExteriorCalculusExtended.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDiscreteExteriorCalculusExtended.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDiscreteExteriorCalculusSolver.dir/testDiscreteExteriorCalculusSolver.cpp.o"
+  "CMakeFiles/testDiscreteExteriorCalculusSolver.dir/testDiscreteExteriorCalculusSolver.cpp.o.d"
+  "testDiscreteExteriorCalculusSolver"
+  "testDiscreteExteriorCalculusSolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDiscreteExteriorCalculusSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
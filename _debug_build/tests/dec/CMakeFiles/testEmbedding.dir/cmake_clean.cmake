@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEmbedding.dir/testEmbedding.cpp.o"
+  "CMakeFiles/testEmbedding.dir/testEmbedding.cpp.o.d"
+  "testEmbedding"
+  "testEmbedding.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEmbedding.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLinearStructure.dir/testLinearStructure.cpp.o"
+  "CMakeFiles/testLinearStructure.dir/testLinearStructure.cpp.o.d"
+  "testLinearStructure"
+  "testLinearStructure.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLinearStructure.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMultigridSolver.dir/testMultigridSolver.cpp.o"
+  "CMakeFiles/testMultigridSolver.dir/testMultigridSolver.cpp.o.d"
+  "testMultigridSolver"
+  "testMultigridSolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMultigridSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
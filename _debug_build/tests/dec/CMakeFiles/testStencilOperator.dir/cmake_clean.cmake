@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testStencilOperator.dir/testStencilOperator.cpp.o"
+  "CMakeFiles/testStencilOperator.dir/testStencilOperator.cpp.o.d"
+  "testStencilOperator"
+  "testStencilOperator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testStencilOperator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/dec
+# Build directory: /root/repo/_debug_build/tests/dec
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testDiscreteExteriorCalculus "testDiscreteExteriorCalculus")
+set_tests_properties(testDiscreteExteriorCalculus PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dec/CMakeLists.txt;6;add_test;/root/repo/tests/dec/CMakeLists.txt;0;")
+add_test(testLinearStructure "testLinearStructure")
+set_tests_properties(testLinearStructure PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dec/CMakeLists.txt;10;add_test;/root/repo/tests/dec/CMakeLists.txt;0;")
+add_test(testEmbedding "testEmbedding")
+set_tests_properties(testEmbedding PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dec/CMakeLists.txt;18;add_test;/root/repo/tests/dec/CMakeLists.txt;0;")
+add_test(testStencilOperator "testStencilOperator")
+set_tests_properties(testStencilOperator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dec/CMakeLists.txt;22;add_test;/root/repo/tests/dec/CMakeLists.txt;0;")
+add_test(testMultigridSolver "testMultigridSolver")
+set_tests_properties(testMultigridSolver PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dec/CMakeLists.txt;26;add_test;/root/repo/tests/dec/CMakeLists.txt;0;")
+add_test(testDiscreteExteriorCalculusSolver "testDiscreteExteriorCalculusSolver")
+set_tests_properties(testDiscreteExteriorCalculusSolver PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/dec/CMakeLists.txt;30;add_test;/root/repo/tests/dec/CMakeLists.txt;0;")
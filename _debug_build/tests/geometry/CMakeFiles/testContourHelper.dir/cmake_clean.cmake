@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testContourHelper.dir/testContourHelper.cpp.o"
+  "CMakeFiles/testContourHelper.dir/testContourHelper.cpp.o.d"
+  "testContourHelper"
+  "testContourHelper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testContourHelper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
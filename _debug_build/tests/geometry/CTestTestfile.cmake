@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry
+# Build directory: /root/repo/_debug_build/tests/geometry
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testContourHelper "testContourHelper")
+set_tests_properties(testContourHelper PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/CMakeLists.txt;0;")
+subdirs("curves")
+subdirs("volumes")
+subdirs("surfaces")
+subdirs("tools")
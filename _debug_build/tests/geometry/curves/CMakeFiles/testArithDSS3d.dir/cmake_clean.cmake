@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithDSS3d.dir/testArithDSS3d.cpp.o"
+  "CMakeFiles/testArithDSS3d.dir/testArithDSS3d.cpp.o.d"
+  "testArithDSS3d"
+  "testArithDSS3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithDSS3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithmeticalDSLKernel.dir/testArithmeticalDSLKernel.cpp.o"
+  "CMakeFiles/testArithmeticalDSLKernel.dir/testArithmeticalDSLKernel.cpp.o.d"
+  "testArithmeticalDSLKernel"
+  "testArithmeticalDSLKernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithmeticalDSLKernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
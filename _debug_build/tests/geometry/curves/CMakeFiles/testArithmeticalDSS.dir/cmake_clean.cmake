@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithmeticalDSS.dir/testArithmeticalDSS.cpp.o"
+  "CMakeFiles/testArithmeticalDSS.dir/testArithmeticalDSS.cpp.o.d"
+  "testArithmeticalDSS"
+  "testArithmeticalDSS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithmeticalDSS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
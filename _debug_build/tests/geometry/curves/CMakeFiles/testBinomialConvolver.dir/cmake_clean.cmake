@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBinomialConvolver.dir/testBinomialConvolver.cpp.o"
+  "CMakeFiles/testBinomialConvolver.dir/testBinomialConvolver.cpp.o.d"
+  "testBinomialConvolver"
+  "testBinomialConvolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBinomialConvolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCombinDSS.dir/testCombinDSS.cpp.o"
+  "CMakeFiles/testCombinDSS.dir/testCombinDSS.cpp.o.d"
+  "testCombinDSS"
+  "testCombinDSS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCombinDSS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
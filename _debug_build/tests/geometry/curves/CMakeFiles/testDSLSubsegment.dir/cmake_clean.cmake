@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDSLSubsegment.dir/testDSLSubsegment.cpp.o"
+  "CMakeFiles/testDSLSubsegment.dir/testDSLSubsegment.cpp.o.d"
+  "testDSLSubsegment"
+  "testDSLSubsegment.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDSLSubsegment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFP.dir/testFP.cpp.o"
+  "CMakeFiles/testFP.dir/testFP.cpp.o.d"
+  "testFP"
+  "testFP.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFP.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testStabbingLineComputer.dir/testStabbingLineComputer.cpp.o"
+  "CMakeFiles/testStabbingLineComputer.dir/testStabbingLineComputer.cpp.o.d"
+  "testStabbingLineComputer"
+  "testStabbingLineComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testStabbingLineComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
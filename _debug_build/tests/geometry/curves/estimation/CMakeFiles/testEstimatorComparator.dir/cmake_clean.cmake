@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEstimatorComparator.dir/testEstimatorComparator.cpp.o"
+  "CMakeFiles/testEstimatorComparator.dir/testEstimatorComparator.cpp.o.d"
+  "testEstimatorComparator"
+  "testEstimatorComparator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEstimatorComparator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLambdaMST2D.dir/testLambdaMST2D.cpp.o"
+  "CMakeFiles/testLambdaMST2D.dir/testLambdaMST2D.cpp.o.d"
+  "testLambdaMST2D"
+  "testLambdaMST2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLambdaMST2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLambdaMST3D.dir/testLambdaMST3D.cpp.o"
+  "CMakeFiles/testLambdaMST3D.dir/testLambdaMST3D.cpp.o.d"
+  "testLambdaMST3D"
+  "testLambdaMST3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLambdaMST3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
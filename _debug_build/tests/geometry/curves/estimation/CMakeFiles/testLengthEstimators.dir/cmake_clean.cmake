@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLengthEstimators.dir/testLengthEstimators.cpp.o"
+  "CMakeFiles/testLengthEstimators.dir/testLengthEstimators.cpp.o.d"
+  "testLengthEstimators"
+  "testLengthEstimators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLengthEstimators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
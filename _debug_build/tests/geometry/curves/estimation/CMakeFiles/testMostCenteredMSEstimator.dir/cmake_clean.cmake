@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMostCenteredMSEstimator.dir/testMostCenteredMSEstimator.cpp.o"
+  "CMakeFiles/testMostCenteredMSEstimator.dir/testMostCenteredMSEstimator.cpp.o.d"
+  "testMostCenteredMSEstimator"
+  "testMostCenteredMSEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMostCenteredMSEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSegmentComputerEstimators.dir/testSegmentComputerEstimators.cpp.o"
+  "CMakeFiles/testSegmentComputerEstimators.dir/testSegmentComputerEstimators.cpp.o.d"
+  "testSegmentComputerEstimators"
+  "testSegmentComputerEstimators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSegmentComputerEstimators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
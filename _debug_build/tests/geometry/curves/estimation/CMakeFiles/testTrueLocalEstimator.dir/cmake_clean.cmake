@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTrueLocalEstimator.dir/testTrueLocalEstimator.cpp.o"
+  "CMakeFiles/testTrueLocalEstimator.dir/testTrueLocalEstimator.cpp.o.d"
+  "testTrueLocalEstimator"
+  "testTrueLocalEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTrueLocalEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/curves/estimation
+# Build directory: /root/repo/_debug_build/tests/geometry/curves/estimation
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testLengthEstimators "testLengthEstimators")
+set_tests_properties(testLengthEstimators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
+add_test(testTrueLocalEstimator "testTrueLocalEstimator")
+set_tests_properties(testTrueLocalEstimator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
+add_test(testEstimatorComparator "testEstimatorComparator")
+set_tests_properties(testEstimatorComparator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
+add_test(testSegmentComputerEstimators "testSegmentComputerEstimators")
+set_tests_properties(testSegmentComputerEstimators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
+add_test(testMostCenteredMSEstimator "testMostCenteredMSEstimator")
+set_tests_properties(testMostCenteredMSEstimator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
+add_test(testLambdaMST2D "testLambdaMST2D")
+set_tests_properties(testLambdaMST2D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
+add_test(testLambdaMST3D "testLambdaMST3D")
+set_tests_properties(testLambdaMST3D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;14;add_test;/root/repo/tests/geometry/curves/estimation/CMakeLists.txt;0;")
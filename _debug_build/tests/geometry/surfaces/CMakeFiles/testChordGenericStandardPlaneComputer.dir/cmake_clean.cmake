@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testChordGenericStandardPlaneComputer.dir/testChordGenericStandardPlaneComputer.cpp.o"
+  "CMakeFiles/testChordGenericStandardPlaneComputer.dir/testChordGenericStandardPlaneComputer.cpp.o.d"
+  "testChordGenericStandardPlaneComputer"
+  "testChordGenericStandardPlaneComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testChordGenericStandardPlaneComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEstimatorCache.dir/testEstimatorCache.cpp.o"
+  "CMakeFiles/testEstimatorCache.dir/testEstimatorCache.cpp.o.d"
+  "testEstimatorCache"
+  "testEstimatorCache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEstimatorCache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testIntegralInvariantCovarianceEstimator.dir/testIntegralInvariantCovarianceEstimator.cpp.o"
+  "CMakeFiles/testIntegralInvariantCovarianceEstimator.dir/testIntegralInvariantCovarianceEstimator.cpp.o.d"
+  "testIntegralInvariantCovarianceEstimator"
+  "testIntegralInvariantCovarianceEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testIntegralInvariantCovarianceEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
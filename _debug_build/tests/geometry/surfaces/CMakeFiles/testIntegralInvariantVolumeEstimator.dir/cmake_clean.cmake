@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testIntegralInvariantVolumeEstimator.dir/testIntegralInvariantVolumeEstimator.cpp.o"
+  "CMakeFiles/testIntegralInvariantVolumeEstimator.dir/testIntegralInvariantVolumeEstimator.cpp.o.d"
+  "testIntegralInvariantVolumeEstimator"
+  "testIntegralInvariantVolumeEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testIntegralInvariantVolumeEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
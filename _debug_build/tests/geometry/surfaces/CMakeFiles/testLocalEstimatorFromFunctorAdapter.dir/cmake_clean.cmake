@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLocalEstimatorFromFunctorAdapter.dir/testLocalEstimatorFromFunctorAdapter.cpp.o"
+  "CMakeFiles/testLocalEstimatorFromFunctorAdapter.dir/testLocalEstimatorFromFunctorAdapter.cpp.o.d"
+  "testLocalEstimatorFromFunctorAdapter"
+  "testLocalEstimatorFromFunctorAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLocalEstimatorFromFunctorAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testNormalVectorEstimatorEmbedder.dir/testNormalVectorEstimatorEmbedder.cpp.o"
+  "CMakeFiles/testNormalVectorEstimatorEmbedder.dir/testNormalVectorEstimatorEmbedder.cpp.o.d"
+  "testNormalVectorEstimatorEmbedder"
+  "testNormalVectorEstimatorEmbedder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testNormalVectorEstimatorEmbedder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
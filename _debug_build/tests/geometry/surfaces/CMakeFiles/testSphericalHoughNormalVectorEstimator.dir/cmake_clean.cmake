@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSphericalHoughNormalVectorEstimator.dir/testSphericalHoughNormalVectorEstimator.cpp.o"
+  "CMakeFiles/testSphericalHoughNormalVectorEstimator.dir/testSphericalHoughNormalVectorEstimator.cpp.o.d"
+  "testSphericalHoughNormalVectorEstimator"
+  "testSphericalHoughNormalVectorEstimator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSphericalHoughNormalVectorEstimator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTensorVoting.dir/testTensorVoting.cpp.o"
+  "CMakeFiles/testTensorVoting.dir/testTensorVoting.cpp.o.d"
+  "testTensorVoting"
+  "testTensorVoting.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTensorVoting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/surfaces
+# Build directory: /root/repo/_debug_build/tests/geometry/surfaces
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testChordGenericStandardPlaneComputer "testChordGenericStandardPlaneComputer")
+set_tests_properties(testChordGenericStandardPlaneComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;8;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testNormalVectorEstimatorEmbedder "testNormalVectorEstimatorEmbedder")
+set_tests_properties(testNormalVectorEstimatorEmbedder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testIntegralInvariantVolumeEstimator "testIntegralInvariantVolumeEstimator")
+set_tests_properties(testIntegralInvariantVolumeEstimator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testIntegralInvariantCovarianceEstimator "testIntegralInvariantCovarianceEstimator")
+set_tests_properties(testIntegralInvariantCovarianceEstimator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testLocalEstimatorFromFunctorAdapter "testLocalEstimatorFromFunctorAdapter")
+set_tests_properties(testLocalEstimatorFromFunctorAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testTensorVoting "testTensorVoting")
+set_tests_properties(testTensorVoting PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testEstimatorCache "testEstimatorCache")
+set_tests_properties(testEstimatorCache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
+add_test(testSphericalHoughNormalVectorEstimator "testSphericalHoughNormalVectorEstimator")
+set_tests_properties(testSphericalHoughNormalVectorEstimator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/surfaces/CMakeLists.txt;25;add_test;/root/repo/tests/geometry/surfaces/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConvexHull2D.dir/testConvexHull2D.cpp.o"
+  "CMakeFiles/testConvexHull2D.dir/testConvexHull2D.cpp.o.d"
+  "testConvexHull2D"
+  "testConvexHull2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConvexHull2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
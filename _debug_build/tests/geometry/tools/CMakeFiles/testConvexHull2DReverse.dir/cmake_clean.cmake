@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConvexHull2DReverse.dir/testConvexHull2DReverse.cpp.o"
+  "CMakeFiles/testConvexHull2DReverse.dir/testConvexHull2DReverse.cpp.o.d"
+  "testConvexHull2DReverse"
+  "testConvexHull2DReverse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConvexHull2DReverse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConvexHull2DThickness.dir/testConvexHull2DThickness.cpp.o"
+  "CMakeFiles/testConvexHull2DThickness.dir/testConvexHull2DThickness.cpp.o.d"
+  "testConvexHull2DThickness"
+  "testConvexHull2DThickness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConvexHull2DThickness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
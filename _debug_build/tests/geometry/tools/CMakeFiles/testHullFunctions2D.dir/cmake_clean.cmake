@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHullFunctions2D.dir/testHullFunctions2D.cpp.o"
+  "CMakeFiles/testHullFunctions2D.dir/testHullFunctions2D.cpp.o.d"
+  "testHullFunctions2D"
+  "testHullFunctions2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHullFunctions2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPolarPointComparatorBy2x2DetComputer.dir/testPolarPointComparatorBy2x2DetComputer.cpp.o"
+  "CMakeFiles/testPolarPointComparatorBy2x2DetComputer.dir/testPolarPointComparatorBy2x2DetComputer.cpp.o.d"
+  "testPolarPointComparatorBy2x2DetComputer"
+  "testPolarPointComparatorBy2x2DetComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPolarPointComparatorBy2x2DetComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
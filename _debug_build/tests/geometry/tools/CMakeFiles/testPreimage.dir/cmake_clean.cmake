@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPreimage.dir/testPreimage.cpp.o"
+  "CMakeFiles/testPreimage.dir/testPreimage.cpp.o.d"
+  "testPreimage"
+  "testPreimage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPreimage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
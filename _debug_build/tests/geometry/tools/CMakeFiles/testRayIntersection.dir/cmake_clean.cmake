@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRayIntersection.dir/testRayIntersection.cpp.o"
+  "CMakeFiles/testRayIntersection.dir/testRayIntersection.cpp.o.d"
+  "testRayIntersection"
+  "testRayIntersection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRayIntersection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSphericalAccumulator.dir/testSphericalAccumulator.cpp.o"
+  "CMakeFiles/testSphericalAccumulator.dir/testSphericalAccumulator.cpp.o.d"
+  "testSphericalAccumulator"
+  "testSphericalAccumulator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSphericalAccumulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/tools
+# Build directory: /root/repo/_debug_build/tests/geometry/tools
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testRayIntersection "testRayIntersection")
+set_tests_properties(testRayIntersection PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testPreimage "testPreimage")
+set_tests_properties(testPreimage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testSphericalAccumulator "testSphericalAccumulator")
+set_tests_properties(testSphericalAccumulator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testHullFunctions2D "testHullFunctions2D")
+set_tests_properties(testHullFunctions2D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testPolarPointComparatorBy2x2DetComputer "testPolarPointComparatorBy2x2DetComputer")
+set_tests_properties(testPolarPointComparatorBy2x2DetComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testConvexHull2D "testConvexHull2D")
+set_tests_properties(testConvexHull2D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testConvexHull2DThickness "testConvexHull2DThickness")
+set_tests_properties(testConvexHull2DThickness PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+add_test(testConvexHull2DReverse "testConvexHull2DReverse")
+set_tests_properties(testConvexHull2DReverse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/CMakeLists.txt;19;add_test;/root/repo/tests/geometry/tools/CMakeLists.txt;0;")
+subdirs("determinant")
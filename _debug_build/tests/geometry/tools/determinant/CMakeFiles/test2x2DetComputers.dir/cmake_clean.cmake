@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test2x2DetComputers.dir/test2x2DetComputers.cpp.o"
+  "CMakeFiles/test2x2DetComputers.dir/test2x2DetComputers.cpp.o.d"
+  "test2x2DetComputers"
+  "test2x2DetComputers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test2x2DetComputers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
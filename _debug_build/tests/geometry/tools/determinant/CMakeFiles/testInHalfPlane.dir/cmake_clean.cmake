@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testInHalfPlane.dir/testInHalfPlane.cpp.o"
+  "CMakeFiles/testInHalfPlane.dir/testInHalfPlane.cpp.o.d"
+  "testInHalfPlane"
+  "testInHalfPlane.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testInHalfPlane.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/tools/determinant
+# Build directory: /root/repo/_debug_build/tests/geometry/tools/determinant
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test2x2DetComputers "test2x2DetComputers")
+set_tests_properties(test2x2DetComputers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/determinant/CMakeLists.txt;8;add_test;/root/repo/tests/geometry/tools/determinant/CMakeLists.txt;0;")
+add_test(testInHalfPlane "testInHalfPlane")
+set_tests_properties(testInHalfPlane PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/tools/determinant/CMakeLists.txt;8;add_test;/root/repo/tests/geometry/tools/determinant/CMakeLists.txt;0;")
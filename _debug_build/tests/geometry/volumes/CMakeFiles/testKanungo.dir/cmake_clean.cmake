@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testKanungo.dir/testKanungo.cpp.o"
+  "CMakeFiles/testKanungo.dir/testKanungo.cpp.o.d"
+  "testKanungo"
+  "testKanungo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testKanungo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
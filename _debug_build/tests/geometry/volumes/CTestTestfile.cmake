@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/volumes
+# Build directory: /root/repo/_debug_build/tests/geometry/volumes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testKanungo "testKanungo")
+set_tests_properties(testKanungo PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/CMakeLists.txt;12;add_test;/root/repo/tests/geometry/volumes/CMakeLists.txt;0;")
+subdirs("estimation")
+subdirs("distance")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testChamferDT.dir/testChamferDT.cpp.o"
+  "CMakeFiles/testChamferDT.dir/testChamferDT.cpp.o.d"
+  "testChamferDT"
+  "testChamferDT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testChamferDT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testChamferVoro.dir/testChamferVoro.cpp.o"
+  "CMakeFiles/testChamferVoro.dir/testChamferVoro.cpp.o.d"
+  "testChamferVoro"
+  "testChamferVoro.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testChamferVoro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDigitalMetricAdapter.dir/testDigitalMetricAdapter.cpp.o"
+  "CMakeFiles/testDigitalMetricAdapter.dir/testDigitalMetricAdapter.cpp.o.d"
+  "testDigitalMetricAdapter"
+  "testDigitalMetricAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDigitalMetricAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
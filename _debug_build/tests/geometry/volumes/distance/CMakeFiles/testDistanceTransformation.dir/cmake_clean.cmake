@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDistanceTransformation.dir/testDistanceTransformation.cpp.o"
+  "CMakeFiles/testDistanceTransformation.dir/testDistanceTransformation.cpp.o.d"
+  "testDistanceTransformation"
+  "testDistanceTransformation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDistanceTransformation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
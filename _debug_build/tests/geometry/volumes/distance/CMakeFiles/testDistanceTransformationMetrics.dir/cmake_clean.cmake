@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDistanceTransformationMetrics.dir/testDistanceTransformationMetrics.cpp.o"
+  "CMakeFiles/testDistanceTransformationMetrics.dir/testDistanceTransformationMetrics.cpp.o.d"
+  "testDistanceTransformationMetrics"
+  "testDistanceTransformationMetrics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDistanceTransformationMetrics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
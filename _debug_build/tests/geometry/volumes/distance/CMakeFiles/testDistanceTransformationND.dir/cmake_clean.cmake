@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDistanceTransformationND.dir/testDistanceTransformationND.cpp.o"
+  "CMakeFiles/testDistanceTransformationND.dir/testDistanceTransformationND.cpp.o.d"
+  "testDistanceTransformationND"
+  "testDistanceTransformationND.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDistanceTransformationND.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFMM.dir/testFMM.cpp.o"
+  "CMakeFiles/testFMM.dir/testFMM.cpp.o.d"
+  "testFMM"
+  "testFMM.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFMM.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
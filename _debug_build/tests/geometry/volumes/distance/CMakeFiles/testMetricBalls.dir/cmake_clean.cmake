@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMetricBalls.dir/testMetricBalls.cpp.o"
+  "CMakeFiles/testMetricBalls.dir/testMetricBalls.cpp.o.d"
+  "testMetricBalls"
+  "testMetricBalls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMetricBalls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
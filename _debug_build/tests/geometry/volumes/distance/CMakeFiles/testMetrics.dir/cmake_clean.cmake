@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMetrics.dir/testMetrics.cpp.o"
+  "CMakeFiles/testMetrics.dir/testMetrics.cpp.o.d"
+  "testMetrics"
+  "testMetrics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMetrics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPowerMap.dir/testPowerMap.cpp.o"
+  "CMakeFiles/testPowerMap.dir/testPowerMap.cpp.o.d"
+  "testPowerMap"
+  "testPowerMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPowerMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
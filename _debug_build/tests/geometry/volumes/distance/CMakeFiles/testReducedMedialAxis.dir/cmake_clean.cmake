@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testReducedMedialAxis.dir/testReducedMedialAxis.cpp.o"
+  "CMakeFiles/testReducedMedialAxis.dir/testReducedMedialAxis.cpp.o.d"
+  "testReducedMedialAxis"
+  "testReducedMedialAxis.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testReducedMedialAxis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testReverseDT.dir/testReverseDT.cpp.o"
+  "CMakeFiles/testReverseDT.dir/testReverseDT.cpp.o.d"
+  "testReverseDT"
+  "testReverseDT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testReverseDT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
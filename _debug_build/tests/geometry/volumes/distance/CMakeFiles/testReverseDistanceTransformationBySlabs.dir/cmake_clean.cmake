@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testReverseDistanceTransformationBySlabs.dir/testReverseDistanceTransformationBySlabs.cpp.o"
+  "CMakeFiles/testReverseDistanceTransformationBySlabs.dir/testReverseDistanceTransformationBySlabs.cpp.o.d"
+  "testReverseDistanceTransformationBySlabs"
+  "testReverseDistanceTransformationBySlabs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testReverseDistanceTransformationBySlabs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
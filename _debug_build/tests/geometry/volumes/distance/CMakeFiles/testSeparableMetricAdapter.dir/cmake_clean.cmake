@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSeparableMetricAdapter.dir/testSeparableMetricAdapter.cpp.o"
+  "CMakeFiles/testSeparableMetricAdapter.dir/testSeparableMetricAdapter.cpp.o.d"
+  "testSeparableMetricAdapter"
+  "testSeparableMetricAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSeparableMetricAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
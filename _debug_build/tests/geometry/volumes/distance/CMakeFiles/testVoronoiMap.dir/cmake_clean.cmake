@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testVoronoiMap.dir/testVoronoiMap.cpp.o"
+  "CMakeFiles/testVoronoiMap.dir/testVoronoiMap.cpp.o.d"
+  "testVoronoiMap"
+  "testVoronoiMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testVoronoiMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
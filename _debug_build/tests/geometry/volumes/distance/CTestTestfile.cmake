@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/volumes/distance
+# Build directory: /root/repo/_debug_build/tests/geometry/volumes/distance
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testDistanceTransformation "testDistanceTransformation")
+set_tests_properties(testDistanceTransformation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testDistanceTransformationND "testDistanceTransformationND")
+set_tests_properties(testDistanceTransformationND PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testDistanceTransformationMetrics "testDistanceTransformationMetrics")
+set_tests_properties(testDistanceTransformationMetrics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testReverseDT "testReverseDT")
+set_tests_properties(testReverseDT PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testFMM "testFMM")
+set_tests_properties(testFMM PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testVoronoiMap "testVoronoiMap")
+set_tests_properties(testVoronoiMap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testMetrics "testMetrics")
+set_tests_properties(testMetrics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testMetricBalls "testMetricBalls")
+set_tests_properties(testMetricBalls PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testPowerMap "testPowerMap")
+set_tests_properties(testPowerMap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testReducedMedialAxis "testReducedMedialAxis")
+set_tests_properties(testReducedMedialAxis PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testReverseDistanceTransformationBySlabs "testReverseDistanceTransformationBySlabs")
+set_tests_properties(testReverseDistanceTransformationBySlabs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testSeparableMetricAdapter "testSeparableMetricAdapter")
+set_tests_properties(testSeparableMetricAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testChamferDT "testChamferDT")
+set_tests_properties(testChamferDT PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testChamferVoro "testChamferVoro")
+set_tests_properties(testChamferVoro PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
+add_test(testDigitalMetricAdapter "testDigitalMetricAdapter")
+set_tests_properties(testDigitalMetricAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;23;add_test;/root/repo/tests/geometry/volumes/distance/CMakeLists.txt;0;")
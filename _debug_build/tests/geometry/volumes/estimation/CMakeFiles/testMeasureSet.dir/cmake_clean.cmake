@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMeasureSet.dir/testMeasureSet.cpp.o"
+  "CMakeFiles/testMeasureSet.dir/testMeasureSet.cpp.o.d"
+  "testMeasureSet"
+  "testMeasureSet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMeasureSet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
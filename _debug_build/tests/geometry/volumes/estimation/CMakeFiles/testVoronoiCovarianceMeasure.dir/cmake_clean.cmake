@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testVoronoiCovarianceMeasure.dir/testVoronoiCovarianceMeasure.cpp.o"
+  "CMakeFiles/testVoronoiCovarianceMeasure.dir/testVoronoiCovarianceMeasure.cpp.o.d"
+  "testVoronoiCovarianceMeasure"
+  "testVoronoiCovarianceMeasure.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testVoronoiCovarianceMeasure.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/volumes/estimation
+# Build directory: /root/repo/_debug_build/tests/geometry/volumes/estimation
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testMeasureSet "testMeasureSet")
+set_tests_properties(testMeasureSet PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/estimation/CMakeLists.txt;9;add_test;/root/repo/tests/geometry/volumes/estimation/CMakeLists.txt;0;")
+add_test(testVoronoiCovarianceMeasure "testVoronoiCovarianceMeasure")
+set_tests_properties(testVoronoiCovarianceMeasure PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/geometry/volumes/estimation/CMakeLists.txt;9;add_test;/root/repo/tests/geometry/volumes/estimation/CMakeLists.txt;0;")
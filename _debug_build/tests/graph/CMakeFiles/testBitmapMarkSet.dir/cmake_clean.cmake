@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBitmapMarkSet.dir/testBitmapMarkSet.cpp.o"
+  "CMakeFiles/testBitmapMarkSet.dir/testBitmapMarkSet.cpp.o.d"
+  "testBitmapMarkSet"
+  "testBitmapMarkSet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBitmapMarkSet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
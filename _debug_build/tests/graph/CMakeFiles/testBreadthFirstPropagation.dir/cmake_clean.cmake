@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBreadthFirstPropagation.dir/testBreadthFirstPropagation.cpp.o"
+  "CMakeFiles/testBreadthFirstPropagation.dir/testBreadthFirstPropagation.cpp.o.d"
+  "testBreadthFirstPropagation"
+  "testBreadthFirstPropagation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBreadthFirstPropagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
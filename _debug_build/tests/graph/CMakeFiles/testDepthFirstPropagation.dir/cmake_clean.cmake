@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDepthFirstPropagation.dir/testDepthFirstPropagation.cpp.o"
+  "CMakeFiles/testDepthFirstPropagation.dir/testDepthFirstPropagation.cpp.o.d"
+  "testDepthFirstPropagation"
+  "testDepthFirstPropagation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDepthFirstPropagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDistancePropagation.dir/testDistancePropagation.cpp.o"
+  "CMakeFiles/testDistancePropagation.dir/testDistancePropagation.cpp.o.d"
+  "testDistancePropagation"
+  "testDistancePropagation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDistancePropagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
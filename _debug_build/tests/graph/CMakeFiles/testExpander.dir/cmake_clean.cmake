@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testExpander.dir/testExpander.cpp.o"
+  "CMakeFiles/testExpander.dir/testExpander.cpp.o.d"
+  "testExpander"
+  "testExpander.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testExpander.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testObjectBoostGraphInterface.dir/testObjectBoostGraphInterface.cpp.o"
+  "CMakeFiles/testObjectBoostGraphInterface.dir/testObjectBoostGraphInterface.cpp.o.d"
+  "testObjectBoostGraphInterface"
+  "testObjectBoostGraphInterface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testObjectBoostGraphInterface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
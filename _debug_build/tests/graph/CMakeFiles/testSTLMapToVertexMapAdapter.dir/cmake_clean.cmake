@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSTLMapToVertexMapAdapter.dir/testSTLMapToVertexMapAdapter.cpp.o"
+  "CMakeFiles/testSTLMapToVertexMapAdapter.dir/testSTLMapToVertexMapAdapter.cpp.o.d"
+  "testSTLMapToVertexMapAdapter"
+  "testSTLMapToVertexMapAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSTLMapToVertexMapAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/graph
+# Build directory: /root/repo/_debug_build/tests/graph
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testBreadthFirstPropagation "testBreadthFirstPropagation")
+set_tests_properties(testBreadthFirstPropagation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
+add_test(testBitmapMarkSet "testBitmapMarkSet")
+set_tests_properties(testBitmapMarkSet PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
+add_test(testDepthFirstPropagation "testDepthFirstPropagation")
+set_tests_properties(testDepthFirstPropagation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
+add_test(testObjectBoostGraphInterface "testObjectBoostGraphInterface")
+set_tests_properties(testObjectBoostGraphInterface PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
+add_test(testDistancePropagation "testDistancePropagation")
+set_tests_properties(testDistancePropagation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
+add_test(testExpander "testExpander")
+set_tests_properties(testExpander PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
+add_test(testSTLMapToVertexMapAdapter "testSTLMapToVertexMapAdapter")
+set_tests_properties(testSTLMapToVertexMapAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/graph/CMakeLists.txt;15;add_test;/root/repo/tests/graph/CMakeLists.txt;0;")
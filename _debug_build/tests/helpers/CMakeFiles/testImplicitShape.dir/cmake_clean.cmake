@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImplicitShape.dir/testImplicitShape.cpp.o"
+  "CMakeFiles/testImplicitShape.dir/testImplicitShape.cpp.o.d"
+  "testImplicitShape"
+  "testImplicitShape.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImplicitShape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
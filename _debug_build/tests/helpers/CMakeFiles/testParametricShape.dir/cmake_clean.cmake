@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testParametricShape.dir/testParametricShape.cpp.o"
+  "CMakeFiles/testParametricShape.dir/testParametricShape.cpp.o.d"
+  "testParametricShape"
+  "testParametricShape.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testParametricShape.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
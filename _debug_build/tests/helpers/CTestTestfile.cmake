@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/helpers
+# Build directory: /root/repo/_debug_build/tests/helpers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testParametricShape "testParametricShape")
+set_tests_properties(testParametricShape PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/helpers/CMakeLists.txt;9;add_test;/root/repo/tests/helpers/CMakeLists.txt;0;")
+add_test(testImplicitShape "testImplicitShape")
+set_tests_properties(testImplicitShape PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/helpers/CMakeLists.txt;9;add_test;/root/repo/tests/helpers/CMakeLists.txt;0;")
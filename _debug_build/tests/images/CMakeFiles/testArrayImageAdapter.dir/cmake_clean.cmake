@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArrayImageAdapter.dir/testArrayImageAdapter.cpp.o"
+  "CMakeFiles/testArrayImageAdapter.dir/testArrayImageAdapter.cpp.o.d"
+  "testArrayImageAdapter"
+  "testArrayImageAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArrayImageAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCheckImageConcept.dir/testCheckImageConcept.cpp.o"
+  "CMakeFiles/testCheckImageConcept.dir/testCheckImageConcept.cpp.o.d"
+  "testCheckImageConcept"
+  "testCheckImageConcept.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCheckImageConcept.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
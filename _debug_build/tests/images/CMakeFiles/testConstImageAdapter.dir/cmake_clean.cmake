@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConstImageAdapter.dir/testConstImageAdapter.cpp.o"
+  "CMakeFiles/testConstImageAdapter.dir/testConstImageAdapter.cpp.o.d"
+  "testConstImageAdapter"
+  "testConstImageAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConstImageAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
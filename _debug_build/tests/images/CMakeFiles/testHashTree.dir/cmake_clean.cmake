@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHashTree.dir/testHashTree.cpp.o"
+  "CMakeFiles/testHashTree.dir/testHashTree.cpp.o.d"
+  "testHashTree"
+  "testHashTree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHashTree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
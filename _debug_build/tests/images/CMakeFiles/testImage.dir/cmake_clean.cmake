@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImage.dir/testImage.cpp.o"
+  "CMakeFiles/testImage.dir/testImage.cpp.o.d"
+  "testImage"
+  "testImage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImageAdapter.dir/testImageAdapter.cpp.o"
+  "CMakeFiles/testImageAdapter.dir/testImageAdapter.cpp.o.d"
+  "testImageAdapter"
+  "testImageAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImageAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
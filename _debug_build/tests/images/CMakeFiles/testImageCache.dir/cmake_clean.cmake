@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImageCache.dir/testImageCache.cpp.o"
+  "CMakeFiles/testImageCache.dir/testImageCache.cpp.o.d"
+  "testImageCache"
+  "testImageCache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImageCache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
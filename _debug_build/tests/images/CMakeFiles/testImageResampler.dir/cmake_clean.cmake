@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImageResampler.dir/testImageResampler.cpp.o"
+  "CMakeFiles/testImageResampler.dir/testImageResampler.cpp.o.d"
+  "testImageResampler"
+  "testImageResampler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImageResampler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
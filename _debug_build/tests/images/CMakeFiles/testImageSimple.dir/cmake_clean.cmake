@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImageSimple.dir/testImageSimple.cpp.o"
+  "CMakeFiles/testImageSimple.dir/testImageSimple.cpp.o.d"
+  "testImageSimple"
+  "testImageSimple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImageSimple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
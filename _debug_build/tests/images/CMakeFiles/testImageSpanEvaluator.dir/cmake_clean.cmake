@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImageSpanEvaluator.dir/testImageSpanEvaluator.cpp.o"
+  "CMakeFiles/testImageSpanEvaluator.dir/testImageSpanEvaluator.cpp.o.d"
+  "testImageSpanEvaluator"
+  "testImageSpanEvaluator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImageSpanEvaluator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
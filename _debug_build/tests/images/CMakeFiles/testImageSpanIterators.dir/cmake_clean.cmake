@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImageSpanIterators.dir/testImageSpanIterators.cpp.o"
+  "CMakeFiles/testImageSpanIterators.dir/testImageSpanIterators.cpp.o.d"
+  "testImageSpanIterators"
+  "testImageSpanIterators.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImageSpanIterators.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMorton.dir/testMorton.cpp.o"
+  "CMakeFiles/testMorton.dir/testMorton.cpp.o.d"
+  "testMorton"
+  "testMorton.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMorton.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRigidTransformation2D.dir/testRigidTransformation2D.cpp.o"
+  "CMakeFiles/testRigidTransformation2D.dir/testRigidTransformation2D.cpp.o.d"
+  "testRigidTransformation2D"
+  "testRigidTransformation2D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRigidTransformation2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
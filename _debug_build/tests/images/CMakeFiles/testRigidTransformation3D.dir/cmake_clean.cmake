@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRigidTransformation3D.dir/testRigidTransformation3D.cpp.o"
+  "CMakeFiles/testRigidTransformation3D.dir/testRigidTransformation3D.cpp.o.d"
+  "testRigidTransformation3D"
+  "testRigidTransformation3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRigidTransformation3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
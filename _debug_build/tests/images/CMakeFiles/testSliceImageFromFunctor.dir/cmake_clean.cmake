@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSliceImageFromFunctor.dir/testSliceImageFromFunctor.cpp.o"
+  "CMakeFiles/testSliceImageFromFunctor.dir/testSliceImageFromFunctor.cpp.o.d"
+  "testSliceImageFromFunctor"
+  "testSliceImageFromFunctor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSliceImageFromFunctor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTiledImage.dir/testTiledImage.cpp.o"
+  "CMakeFiles/testTiledImage.dir/testTiledImage.cpp.o.d"
+  "testTiledImage"
+  "testTiledImage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTiledImage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
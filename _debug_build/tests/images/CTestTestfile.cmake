@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/images
+# Build directory: /root/repo/_debug_build/tests/images
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testImageSimple "testImageSimple")
+set_tests_properties(testImageSimple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testImageAdapter "testImageAdapter")
+set_tests_properties(testImageAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testImageCache "testImageCache")
+set_tests_properties(testImageCache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testTiledImage "testTiledImage")
+set_tests_properties(testTiledImage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testConstImageAdapter "testConstImageAdapter")
+set_tests_properties(testConstImageAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testImage "testImage")
+set_tests_properties(testImage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testImageSpanIterators "testImageSpanIterators")
+set_tests_properties(testImageSpanIterators PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testCheckImageConcept "testCheckImageConcept")
+set_tests_properties(testCheckImageConcept PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testMorton "testMorton")
+set_tests_properties(testMorton PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testHashTree "testHashTree")
+set_tests_properties(testHashTree PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testSliceImageFromFunctor "testSliceImageFromFunctor")
+set_tests_properties(testSliceImageFromFunctor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testRigidTransformation2D "testRigidTransformation2D")
+set_tests_properties(testRigidTransformation2D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testRigidTransformation3D "testRigidTransformation3D")
+set_tests_properties(testRigidTransformation3D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testImageResampler "testImageResampler")
+set_tests_properties(testImageResampler PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testImageSpanEvaluator "testImageSpanEvaluator")
+set_tests_properties(testImageSpanEvaluator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
+add_test(testArrayImageAdapter "testArrayImageAdapter")
+set_tests_properties(testArrayImageAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/images/CMakeLists.txt;29;add_test;/root/repo/tests/images/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArcDrawing.dir/testArcDrawing.cpp.o"
+  "CMakeFiles/testArcDrawing.dir/testArcDrawing.cpp.o.d"
+  "testArcDrawing"
+  "testArcDrawing.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArcDrawing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
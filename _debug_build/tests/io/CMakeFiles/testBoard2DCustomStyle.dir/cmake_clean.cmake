@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBoard2DCustomStyle.dir/testBoard2DCustomStyle.cpp.o"
+  "CMakeFiles/testBoard2DCustomStyle.dir/testBoard2DCustomStyle.cpp.o.d"
+  "testBoard2DCustomStyle"
+  "testBoard2DCustomStyle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBoard2DCustomStyle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testColor.dir/testColor.cpp.o"
+  "CMakeFiles/testColor.dir/testColor.cpp.o.d"
+  "testColor"
+  "testColor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testColor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLongvol.dir/testLongvol.cpp.o"
+  "CMakeFiles/testLongvol.dir/testLongvol.cpp.o.d"
+  "testLongvol"
+  "testLongvol.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLongvol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSimpleBoard.dir/testSimpleBoard.cpp.o"
+  "CMakeFiles/testSimpleBoard.dir/testSimpleBoard.cpp.o.d"
+  "testSimpleBoard"
+  "testSimpleBoard.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSimpleBoard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
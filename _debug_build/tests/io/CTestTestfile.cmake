@@ -0,0 +1,21 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/io
+# Build directory: /root/repo/_debug_build/tests/io
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testColor "testColor")
+set_tests_properties(testColor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;17;add_test;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(testSimpleBoard "testSimpleBoard")
+set_tests_properties(testSimpleBoard PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;17;add_test;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(testBoard2DCustomStyle "testBoard2DCustomStyle")
+set_tests_properties(testBoard2DCustomStyle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;17;add_test;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(testLongvol "testLongvol")
+set_tests_properties(testLongvol PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;17;add_test;/root/repo/tests/io/CMakeLists.txt;0;")
+add_test(testArcDrawing "testArcDrawing")
+set_tests_properties(testArcDrawing PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/CMakeLists.txt;17;add_test;/root/repo/tests/io/CMakeLists.txt;0;")
+subdirs("viewers")
+subdirs("boards")
+subdirs("colormaps")
+subdirs("readers")
+subdirs("writers")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBallQuad.dir/testBallQuad.cpp.o"
+  "CMakeFiles/testBallQuad.dir/testBallQuad.cpp.o.d"
+  "testBallQuad"
+  "testBallQuad.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBallQuad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBoard3D.dir/testBoard3D.cpp.o"
+  "CMakeFiles/testBoard3D.dir/testBoard3D.cpp.o.d"
+  "testBoard3D"
+  "testBoard3D.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBoard3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
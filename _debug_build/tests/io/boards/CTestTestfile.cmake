@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/io/boards
+# Build directory: /root/repo/_debug_build/tests/io/boards
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testBoard3D "testBoard3D")
+set_tests_properties(testBoard3D PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/boards/CMakeLists.txt;9;add_test;/root/repo/tests/io/boards/CMakeLists.txt;0;")
+add_test(testBallQuad "testBallQuad")
+set_tests_properties(testBallQuad PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/boards/CMakeLists.txt;9;add_test;/root/repo/tests/io/boards/CMakeLists.txt;0;")
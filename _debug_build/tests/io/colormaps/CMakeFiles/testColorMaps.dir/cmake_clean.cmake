@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testColorMaps.dir/testColorMaps.cpp.o"
+  "CMakeFiles/testColorMaps.dir/testColorMaps.cpp.o.d"
+  "testColorMaps"
+  "testColorMaps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testColorMaps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
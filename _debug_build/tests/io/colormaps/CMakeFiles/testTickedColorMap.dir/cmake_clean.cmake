@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTickedColorMap.dir/testTickedColorMap.cpp.o"
+  "CMakeFiles/testTickedColorMap.dir/testTickedColorMap.cpp.o.d"
+  "testTickedColorMap"
+  "testTickedColorMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTickedColorMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/io/colormaps
+# Build directory: /root/repo/_debug_build/tests/io/colormaps
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testTickedColorMap "testTickedColorMap")
+set_tests_properties(testTickedColorMap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/colormaps/CMakeLists.txt;9;add_test;/root/repo/tests/io/colormaps/CMakeLists.txt;0;")
+add_test(testColorMaps "testColorMaps")
+set_tests_properties(testColorMaps PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/colormaps/CMakeLists.txt;9;add_test;/root/repo/tests/io/colormaps/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testGenericReader.dir/testGenericReader.cpp.o"
+  "CMakeFiles/testGenericReader.dir/testGenericReader.cpp.o.d"
+  "testGenericReader"
+  "testGenericReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testGenericReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
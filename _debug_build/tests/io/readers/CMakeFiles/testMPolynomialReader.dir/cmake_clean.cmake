@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMPolynomialReader.dir/testMPolynomialReader.cpp.o"
+  "CMakeFiles/testMPolynomialReader.dir/testMPolynomialReader.cpp.o.d"
+  "testMPolynomialReader"
+  "testMPolynomialReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMPolynomialReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMeshReader.dir/testMeshReader.cpp.o"
+  "CMakeFiles/testMeshReader.dir/testMeshReader.cpp.o.d"
+  "testMeshReader"
+  "testMeshReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMeshReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPNMReader.dir/testPNMReader.cpp.o"
+  "CMakeFiles/testPNMReader.dir/testPNMReader.cpp.o.d"
+  "testPNMReader"
+  "testPNMReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPNMReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointListReader.dir/testPointListReader.cpp.o"
+  "CMakeFiles/testPointListReader.dir/testPointListReader.cpp.o.d"
+  "testPointListReader"
+  "testPointListReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointListReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testRawReader.dir/testRawReader.cpp.o"
+  "CMakeFiles/testRawReader.dir/testRawReader.cpp.o.d"
+  "testRawReader"
+  "testRawReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testRawReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
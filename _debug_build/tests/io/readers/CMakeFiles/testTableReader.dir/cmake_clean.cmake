@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testTableReader.dir/testTableReader.cpp.o"
+  "CMakeFiles/testTableReader.dir/testTableReader.cpp.o.d"
+  "testTableReader"
+  "testTableReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testTableReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testVolReader.dir/testVolReader.cpp.o"
+  "CMakeFiles/testVolReader.dir/testVolReader.cpp.o.d"
+  "testVolReader"
+  "testVolReader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testVolReader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/io/readers
+# Build directory: /root/repo/_debug_build/tests/io/readers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testPNMReader "testPNMReader")
+set_tests_properties(testPNMReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testVolReader "testVolReader")
+set_tests_properties(testVolReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testRawReader "testRawReader")
+set_tests_properties(testRawReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testGenericReader "testGenericReader")
+set_tests_properties(testGenericReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testPointListReader "testPointListReader")
+set_tests_properties(testPointListReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testTableReader "testTableReader")
+set_tests_properties(testTableReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testMeshReader "testMeshReader")
+set_tests_properties(testMeshReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
+add_test(testMPolynomialReader "testMPolynomialReader")
+set_tests_properties(testMPolynomialReader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/readers/CMakeLists.txt;15;add_test;/root/repo/tests/io/readers/CMakeLists.txt;0;")
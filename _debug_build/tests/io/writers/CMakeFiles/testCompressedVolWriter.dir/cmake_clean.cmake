@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCompressedVolWriter.dir/testCompressedVolWriter.cpp.o"
+  "CMakeFiles/testCompressedVolWriter.dir/testCompressedVolWriter.cpp.o.d"
+  "testCompressedVolWriter"
+  "testCompressedVolWriter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCompressedVolWriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
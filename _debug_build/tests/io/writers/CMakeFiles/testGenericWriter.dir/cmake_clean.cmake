@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testGenericWriter.dir/testGenericWriter.cpp.o"
+  "CMakeFiles/testGenericWriter.dir/testGenericWriter.cpp.o.d"
+  "testGenericWriter"
+  "testGenericWriter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testGenericWriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMeshWriter.dir/testMeshWriter.cpp.o"
+  "CMakeFiles/testMeshWriter.dir/testMeshWriter.cpp.o.d"
+  "testMeshWriter"
+  "testMeshWriter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMeshWriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
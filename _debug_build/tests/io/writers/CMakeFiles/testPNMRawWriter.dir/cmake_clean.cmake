@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPNMRawWriter.dir/testPNMRawWriter.cpp.o"
+  "CMakeFiles/testPNMRawWriter.dir/testPNMRawWriter.cpp.o.d"
+  "testPNMRawWriter"
+  "testPNMRawWriter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPNMRawWriter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/io/writers
+# Build directory: /root/repo/_debug_build/tests/io/writers
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testCompressedVolWriter "testCompressedVolWriter")
+set_tests_properties(testCompressedVolWriter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/writers/CMakeLists.txt;11;add_test;/root/repo/tests/io/writers/CMakeLists.txt;0;")
+add_test(testPNMRawWriter "testPNMRawWriter")
+set_tests_properties(testPNMRawWriter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/writers/CMakeLists.txt;11;add_test;/root/repo/tests/io/writers/CMakeLists.txt;0;")
+add_test(testMeshWriter "testMeshWriter")
+set_tests_properties(testMeshWriter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/writers/CMakeLists.txt;11;add_test;/root/repo/tests/io/writers/CMakeLists.txt;0;")
+add_test(testGenericWriter "testGenericWriter")
+set_tests_properties(testGenericWriter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/io/writers/CMakeLists.txt;11;add_test;/root/repo/tests/io/writers/CMakeLists.txt;0;")
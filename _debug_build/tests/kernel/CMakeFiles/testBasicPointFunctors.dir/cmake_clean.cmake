@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBasicPointFunctors.dir/testBasicPointFunctors.cpp.o"
+  "CMakeFiles/testBasicPointFunctors.dir/testBasicPointFunctors.cpp.o.d"
+  "testBasicPointFunctors"
+  "testBasicPointFunctors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBasicPointFunctors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
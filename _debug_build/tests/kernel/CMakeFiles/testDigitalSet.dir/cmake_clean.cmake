@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDigitalSet.dir/testDigitalSet.cpp.o"
+  "CMakeFiles/testDigitalSet.dir/testDigitalSet.cpp.o.d"
+  "testDigitalSet"
+  "testDigitalSet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDigitalSet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
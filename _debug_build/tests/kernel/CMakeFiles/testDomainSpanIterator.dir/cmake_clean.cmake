@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDomainSpanIterator.dir/testDomainSpanIterator.cpp.o"
+  "CMakeFiles/testDomainSpanIterator.dir/testDomainSpanIterator.cpp.o.d"
+  "testDomainSpanIterator"
+  "testDomainSpanIterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDomainSpanIterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEmbedder.dir/testEmbedder.cpp.o"
+  "CMakeFiles/testEmbedder.dir/testEmbedder.cpp.o.d"
+  "testEmbedder"
+  "testEmbedder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEmbedder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
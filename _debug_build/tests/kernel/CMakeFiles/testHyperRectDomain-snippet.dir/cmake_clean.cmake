@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHyperRectDomain-snippet.dir/testHyperRectDomain-snippet.cpp.o"
+  "CMakeFiles/testHyperRectDomain-snippet.dir/testHyperRectDomain-snippet.cpp.o.d"
+  "testHyperRectDomain-snippet"
+  "testHyperRectDomain-snippet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHyperRectDomain-snippet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
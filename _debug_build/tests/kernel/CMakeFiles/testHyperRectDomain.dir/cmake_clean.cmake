@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHyperRectDomain.dir/testHyperRectDomain.cpp.o"
+  "CMakeFiles/testHyperRectDomain.dir/testHyperRectDomain.cpp.o.d"
+  "testHyperRectDomain"
+  "testHyperRectDomain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHyperRectDomain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHyperRectDomainScanlineRange.dir/testHyperRectDomainScanlineRange.cpp.o"
+  "CMakeFiles/testHyperRectDomainScanlineRange.dir/testHyperRectDomainScanlineRange.cpp.o.d"
+  "testHyperRectDomainScanlineRange"
+  "testHyperRectDomainScanlineRange.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHyperRectDomainScanlineRange.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImagesSetsUtilities.dir/testImagesSetsUtilities.cpp.o"
+  "CMakeFiles/testImagesSetsUtilities.dir/testImagesSetsUtilities.cpp.o.d"
+  "testImagesSetsUtilities"
+  "testImagesSetsUtilities.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImagesSetsUtilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
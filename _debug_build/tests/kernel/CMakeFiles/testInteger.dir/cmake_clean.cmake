@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testInteger.dir/testInteger.cpp.o"
+  "CMakeFiles/testInteger.dir/testInteger.cpp.o.d"
+  "testInteger"
+  "testInteger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testInteger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
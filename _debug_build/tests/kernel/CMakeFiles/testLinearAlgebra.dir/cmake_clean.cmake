@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLinearAlgebra.dir/testLinearAlgebra.cpp.o"
+  "CMakeFiles/testLinearAlgebra.dir/testLinearAlgebra.cpp.o.d"
+  "testLinearAlgebra"
+  "testLinearAlgebra.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLinearAlgebra.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
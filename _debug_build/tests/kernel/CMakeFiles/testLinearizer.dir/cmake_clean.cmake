@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLinearizer.dir/testLinearizer.cpp.o"
+  "CMakeFiles/testLinearizer.dir/testLinearizer.cpp.o.d"
+  "testLinearizer"
+  "testLinearizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLinearizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointHashFunctions.dir/testPointHashFunctions.cpp.o"
+  "CMakeFiles/testPointHashFunctions.dir/testPointHashFunctions.cpp.o.d"
+  "testPointHashFunctions"
+  "testPointHashFunctions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointHashFunctions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
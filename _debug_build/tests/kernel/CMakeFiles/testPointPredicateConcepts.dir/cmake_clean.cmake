@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointPredicateConcepts.dir/testPointPredicateConcepts.cpp.o"
+  "CMakeFiles/testPointPredicateConcepts.dir/testPointPredicateConcepts.cpp.o.d"
+  "testPointPredicateConcepts"
+  "testPointPredicateConcepts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointPredicateConcepts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointVector-catch.dir/testPointVector-catch.cpp.o"
+  "CMakeFiles/testPointVector-catch.dir/testPointVector-catch.cpp.o.d"
+  "testPointVector-catch"
+  "testPointVector-catch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointVector-catch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
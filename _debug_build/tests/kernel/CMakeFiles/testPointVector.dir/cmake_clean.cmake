@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointVector.dir/testPointVector.cpp.o"
+  "CMakeFiles/testPointVector.dir/testPointVector.cpp.o.d"
+  "testPointVector"
+  "testPointVector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointVector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
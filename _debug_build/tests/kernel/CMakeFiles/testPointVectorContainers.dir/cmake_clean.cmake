@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointVectorContainers.dir/testPointVectorContainers.cpp.o"
+  "CMakeFiles/testPointVectorContainers.dir/testPointVectorContainers.cpp.o.d"
+  "testPointVectorContainers"
+  "testPointVectorContainers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointVectorContainers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPointVectorKernel.dir/testPointVectorKernel.cpp.o"
+  "CMakeFiles/testPointVectorKernel.dir/testPointVectorKernel.cpp.o.d"
+  "testPointVectorKernel"
+  "testPointVectorKernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPointVectorKernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
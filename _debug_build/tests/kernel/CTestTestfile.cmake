@@ -0,0 +1,40 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/kernel
+# Build directory: /root/repo/_debug_build/tests/kernel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testDigitalSet "testDigitalSet")
+set_tests_properties(testDigitalSet PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testDomainSpanIterator "testDomainSpanIterator")
+set_tests_properties(testDomainSpanIterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testHyperRectDomain "testHyperRectDomain")
+set_tests_properties(testHyperRectDomain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testHyperRectDomain-snippet "testHyperRectDomain-snippet")
+set_tests_properties(testHyperRectDomain-snippet PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testHyperRectDomainScanlineRange "testHyperRectDomainScanlineRange")
+set_tests_properties(testHyperRectDomainScanlineRange PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testInteger "testInteger")
+set_tests_properties(testInteger PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testPointVector "testPointVector")
+set_tests_properties(testPointVector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testPointVector-catch "testPointVector-catch")
+set_tests_properties(testPointVector-catch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testPointVectorContainers "testPointVectorContainers")
+set_tests_properties(testPointVectorContainers PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testPointVectorKernel "testPointVectorKernel")
+set_tests_properties(testPointVectorKernel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testLinearAlgebra "testLinearAlgebra")
+set_tests_properties(testLinearAlgebra PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testImagesSetsUtilities "testImagesSetsUtilities")
+set_tests_properties(testImagesSetsUtilities PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testBasicPointFunctors "testBasicPointFunctors")
+set_tests_properties(testBasicPointFunctors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testEmbedder "testEmbedder")
+set_tests_properties(testEmbedder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testPointPredicateConcepts "testPointPredicateConcepts")
+set_tests_properties(testPointPredicateConcepts PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testPointHashFunctions "testPointHashFunctions")
+set_tests_properties(testPointHashFunctions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
+add_test(testLinearizer "testLinearizer")
+set_tests_properties(testLinearizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/kernel/CMakeLists.txt;25;add_test;/root/repo/tests/kernel/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAngleLinearMinimizer.dir/testAngleLinearMinimizer.cpp.o"
+  "CMakeFiles/testAngleLinearMinimizer.dir/testAngleLinearMinimizer.cpp.o.d"
+  "testAngleLinearMinimizer"
+  "testAngleLinearMinimizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAngleLinearMinimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBasicMathFunctions.dir/testBasicMathFunctions.cpp.o"
+  "CMakeFiles/testBasicMathFunctions.dir/testBasicMathFunctions.cpp.o.d"
+  "testBasicMathFunctions"
+  "testBasicMathFunctions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBasicMathFunctions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCompiledMPolynomial.dir/testCompiledMPolynomial.cpp.o"
+  "CMakeFiles/testCompiledMPolynomial.dir/testCompiledMPolynomial.cpp.o.d"
+  "testCompiledMPolynomial"
+  "testCompiledMPolynomial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCompiledMPolynomial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
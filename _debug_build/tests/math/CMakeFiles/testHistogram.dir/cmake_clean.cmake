@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHistogram.dir/testHistogram.cpp.o"
+  "CMakeFiles/testHistogram.dir/testHistogram.cpp.o.d"
+  "testHistogram"
+  "testHistogram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHistogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
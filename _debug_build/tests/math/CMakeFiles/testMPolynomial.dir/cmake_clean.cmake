@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMPolynomial.dir/testMPolynomial.cpp.o"
+  "CMakeFiles/testMPolynomial.dir/testMPolynomial.cpp.o.d"
+  "testMPolynomial"
+  "testMPolynomial.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMPolynomial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
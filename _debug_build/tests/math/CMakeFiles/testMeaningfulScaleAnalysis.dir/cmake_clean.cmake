@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMeaningfulScaleAnalysis.dir/testMeaningfulScaleAnalysis.cpp.o"
+  "CMakeFiles/testMeaningfulScaleAnalysis.dir/testMeaningfulScaleAnalysis.cpp.o.d"
+  "testMeaningfulScaleAnalysis"
+  "testMeaningfulScaleAnalysis.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMeaningfulScaleAnalysis.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMeasure.dir/testMeasure.cpp.o"
+  "CMakeFiles/testMeasure.dir/testMeasure.cpp.o.d"
+  "testMeasure"
+  "testMeasure.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMeasure.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMultiStatistics.dir/testMultiStatistics.cpp.o"
+  "CMakeFiles/testMultiStatistics.dir/testMultiStatistics.cpp.o.d"
+  "testMultiStatistics"
+  "testMultiStatistics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMultiStatistics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
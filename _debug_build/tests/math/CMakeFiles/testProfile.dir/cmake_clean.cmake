@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testProfile.dir/testProfile.cpp.o"
+  "CMakeFiles/testProfile.dir/testProfile.cpp.o.d"
+  "testProfile"
+  "testProfile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testProfile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSignal.dir/testSignal.cpp.o"
+  "CMakeFiles/testSignal.dir/testSignal.cpp.o.d"
+  "testSignal"
+  "testSignal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSignal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
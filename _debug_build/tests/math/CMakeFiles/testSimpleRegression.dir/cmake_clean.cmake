@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSimpleRegression.dir/testSimpleRegression.cpp.o"
+  "CMakeFiles/testSimpleRegression.dir/testSimpleRegression.cpp.o.d"
+  "testSimpleRegression"
+  "testSimpleRegression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSimpleRegression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testStatistics.dir/testStatistics.cpp.o"
+  "CMakeFiles/testStatistics.dir/testStatistics.cpp.o.d"
+  "testStatistics"
+  "testStatistics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testStatistics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/math
+# Build directory: /root/repo/_debug_build/tests/math
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testSimpleRegression "testSimpleRegression")
+set_tests_properties(testSimpleRegression PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testMeasure "testMeasure")
+set_tests_properties(testMeasure PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testSignal "testSignal")
+set_tests_properties(testSignal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testStatistics "testStatistics")
+set_tests_properties(testStatistics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testHistogram "testHistogram")
+set_tests_properties(testHistogram PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testMPolynomial "testMPolynomial")
+set_tests_properties(testMPolynomial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testCompiledMPolynomial "testCompiledMPolynomial")
+set_tests_properties(testCompiledMPolynomial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testAngleLinearMinimizer "testAngleLinearMinimizer")
+set_tests_properties(testAngleLinearMinimizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testBasicMathFunctions "testBasicMathFunctions")
+set_tests_properties(testBasicMathFunctions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testMultiStatistics "testMultiStatistics")
+set_tests_properties(testMultiStatistics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testProfile "testProfile")
+set_tests_properties(testProfile PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+add_test(testMeaningfulScaleAnalysis "testMeaningfulScaleAnalysis")
+set_tests_properties(testMeaningfulScaleAnalysis PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/CMakeLists.txt;24;add_test;/root/repo/tests/math/CMakeLists.txt;0;")
+subdirs("linalg")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testClosedFormEigenDecomposition.dir/testClosedFormEigenDecomposition.cpp.o"
+  "CMakeFiles/testClosedFormEigenDecomposition.dir/testClosedFormEigenDecomposition.cpp.o.d"
+  "testClosedFormEigenDecomposition"
+  "testClosedFormEigenDecomposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testClosedFormEigenDecomposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
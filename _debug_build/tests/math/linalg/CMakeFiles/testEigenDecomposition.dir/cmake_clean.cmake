@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEigenDecomposition.dir/testEigenDecomposition.cpp.o"
+  "CMakeFiles/testEigenDecomposition.dir/testEigenDecomposition.cpp.o.d"
+  "testEigenDecomposition"
+  "testEigenDecomposition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEigenDecomposition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEigenSolver.dir/testEigenSolver.cpp.o"
+  "CMakeFiles/testEigenSolver.dir/testEigenSolver.cpp.o.d"
+  "testEigenSolver"
+  "testEigenSolver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEigenSolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSimpleMatrix.dir/testSimpleMatrix.cpp.o"
+  "CMakeFiles/testSimpleMatrix.dir/testSimpleMatrix.cpp.o.d"
+  "testSimpleMatrix"
+  "testSimpleMatrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSimpleMatrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/math/linalg
+# Build directory: /root/repo/_debug_build/tests/math/linalg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testSimpleMatrix "testSimpleMatrix")
+set_tests_properties(testSimpleMatrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/linalg/CMakeLists.txt;15;add_test;/root/repo/tests/math/linalg/CMakeLists.txt;0;")
+add_test(testEigenDecomposition "testEigenDecomposition")
+set_tests_properties(testEigenDecomposition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/linalg/CMakeLists.txt;15;add_test;/root/repo/tests/math/linalg/CMakeLists.txt;0;")
+add_test(testClosedFormEigenDecomposition "testClosedFormEigenDecomposition")
+set_tests_properties(testClosedFormEigenDecomposition PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/linalg/CMakeLists.txt;15;add_test;/root/repo/tests/math/linalg/CMakeLists.txt;0;")
+add_test(testEigenSolver "testEigenSolver")
+set_tests_properties(testEigenSolver PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/math/linalg/CMakeLists.txt;15;add_test;/root/repo/tests/math/linalg/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBall3DSurface.dir/testBall3DSurface.cpp.o"
+  "CMakeFiles/testBall3DSurface.dir/testBall3DSurface.cpp.o.d"
+  "testBall3DSurface"
+  "testBall3DSurface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBall3DSurface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
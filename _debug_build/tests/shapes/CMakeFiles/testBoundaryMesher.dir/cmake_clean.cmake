@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBoundaryMesher.dir/testBoundaryMesher.cpp.o"
+  "CMakeFiles/testBoundaryMesher.dir/testBoundaryMesher.cpp.o.d"
+  "testBoundaryMesher"
+  "testBoundaryMesher.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBoundaryMesher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
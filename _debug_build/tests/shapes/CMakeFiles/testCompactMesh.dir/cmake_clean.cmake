@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCompactMesh.dir/testCompactMesh.cpp.o"
+  "CMakeFiles/testCompactMesh.dir/testCompactMesh.cpp.o.d"
+  "testCompactMesh"
+  "testCompactMesh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCompactMesh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
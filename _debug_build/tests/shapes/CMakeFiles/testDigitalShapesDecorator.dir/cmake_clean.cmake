@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDigitalShapesDecorator.dir/testDigitalShapesDecorator.cpp.o"
+  "CMakeFiles/testDigitalShapesDecorator.dir/testDigitalShapesDecorator.cpp.o.d"
+  "testDigitalShapesDecorator"
+  "testDigitalShapesDecorator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDigitalShapesDecorator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
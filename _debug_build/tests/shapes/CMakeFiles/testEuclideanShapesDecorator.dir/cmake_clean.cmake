@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testEuclideanShapesDecorator.dir/testEuclideanShapesDecorator.cpp.o"
+  "CMakeFiles/testEuclideanShapesDecorator.dir/testEuclideanShapesDecorator.cpp.o.d"
+  "testEuclideanShapesDecorator"
+  "testEuclideanShapesDecorator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testEuclideanShapesDecorator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
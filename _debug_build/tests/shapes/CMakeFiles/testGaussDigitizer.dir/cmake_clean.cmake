@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testGaussDigitizer.dir/testGaussDigitizer.cpp.o"
+  "CMakeFiles/testGaussDigitizer.dir/testGaussDigitizer.cpp.o.d"
+  "testGaussDigitizer"
+  "testGaussDigitizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testGaussDigitizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testHalfPlane.dir/testHalfPlane.cpp.o"
+  "CMakeFiles/testHalfPlane.dir/testHalfPlane.cpp.o.d"
+  "testHalfPlane"
+  "testHalfPlane.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testHalfPlane.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testImplicitFunctionModels.dir/testImplicitFunctionModels.cpp.o"
+  "CMakeFiles/testImplicitFunctionModels.dir/testImplicitFunctionModels.cpp.o.d"
+  "testImplicitFunctionModels"
+  "testImplicitFunctionModels.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testImplicitFunctionModels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testMesh.dir/testMesh.cpp.o"
+  "CMakeFiles/testMesh.dir/testMesh.cpp.o.d"
+  "testMesh"
+  "testMesh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testMesh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testScanlineDigitizer.dir/testScanlineDigitizer.cpp.o"
+  "CMakeFiles/testScanlineDigitizer.dir/testScanlineDigitizer.cpp.o.d"
+  "testScanlineDigitizer"
+  "testScanlineDigitizer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testScanlineDigitizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testShapesFromPoints.dir/testShapesFromPoints.cpp.o"
+  "CMakeFiles/testShapesFromPoints.dir/testShapesFromPoints.cpp.o.d"
+  "testShapesFromPoints"
+  "testShapesFromPoints.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testShapesFromPoints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
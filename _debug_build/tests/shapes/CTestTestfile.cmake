@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/shapes
+# Build directory: /root/repo/_debug_build/tests/shapes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testGaussDigitizer "testGaussDigitizer")
+set_tests_properties(testGaussDigitizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testHalfPlane "testHalfPlane")
+set_tests_properties(testHalfPlane PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testImplicitFunctionModels "testImplicitFunctionModels")
+set_tests_properties(testImplicitFunctionModels PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testShapesFromPoints "testShapesFromPoints")
+set_tests_properties(testShapesFromPoints PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testMesh "testMesh")
+set_tests_properties(testMesh PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testCompactMesh "testCompactMesh")
+set_tests_properties(testCompactMesh PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testBoundaryMesher "testBoundaryMesher")
+set_tests_properties(testBoundaryMesher PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testScanlineDigitizer "testScanlineDigitizer")
+set_tests_properties(testScanlineDigitizer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testBall3DSurface "testBall3DSurface")
+set_tests_properties(testBall3DSurface PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testEuclideanShapesDecorator "testEuclideanShapesDecorator")
+set_tests_properties(testEuclideanShapesDecorator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
+add_test(testDigitalShapesDecorator "testDigitalShapesDecorator")
+set_tests_properties(testDigitalShapesDecorator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/shapes/CMakeLists.txt;39;add_test;/root/repo/tests/shapes/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAdjacency.dir/testAdjacency.cpp.o"
+  "CMakeFiles/testAdjacency.dir/testAdjacency.cpp.o.d"
+  "testAdjacency"
+  "testAdjacency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAdjacency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testComponentLabelling.dir/testComponentLabelling.cpp.o"
+  "CMakeFiles/testComponentLabelling.dir/testComponentLabelling.cpp.o.d"
+  "testComponentLabelling"
+  "testComponentLabelling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testComponentLabelling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
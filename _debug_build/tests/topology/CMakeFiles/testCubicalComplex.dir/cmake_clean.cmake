@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCubicalComplex.dir/testCubicalComplex.cpp.o"
+  "CMakeFiles/testCubicalComplex.dir/testCubicalComplex.cpp.o.d"
+  "testCubicalComplex"
+  "testCubicalComplex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCubicalComplex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDigitalSetToCellularGridConverter.dir/testDigitalSetToCellularGridConverter.cpp.o"
+  "CMakeFiles/testDigitalSetToCellularGridConverter.dir/testDigitalSetToCellularGridConverter.cpp.o.d"
+  "testDigitalSetToCellularGridConverter"
+  "testDigitalSetToCellularGridConverter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDigitalSetToCellularGridConverter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDigitalSurface.dir/testDigitalSurface.cpp.o"
+  "CMakeFiles/testDigitalSurface.dir/testDigitalSurface.cpp.o.d"
+  "testDigitalSurface"
+  "testDigitalSurface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDigitalSurface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
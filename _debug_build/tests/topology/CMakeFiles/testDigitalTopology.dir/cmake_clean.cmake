@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testDigitalTopology.dir/testDigitalTopology.cpp.o"
+  "CMakeFiles/testDigitalTopology.dir/testDigitalTopology.cpp.o.d"
+  "testDigitalTopology"
+  "testDigitalTopology.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testDigitalTopology.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
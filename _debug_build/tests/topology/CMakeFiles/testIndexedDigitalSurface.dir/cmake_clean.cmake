@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testIndexedDigitalSurface.dir/testIndexedDigitalSurface.cpp.o"
+  "CMakeFiles/testIndexedDigitalSurface.dir/testIndexedDigitalSurface.cpp.o.d"
+  "testIndexedDigitalSurface"
+  "testIndexedDigitalSurface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testIndexedDigitalSurface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testKhalimskySpaceND.dir/testKhalimskySpaceND.cpp.o"
+  "CMakeFiles/testKhalimskySpaceND.dir/testKhalimskySpaceND.cpp.o.d"
+  "testKhalimskySpaceND"
+  "testKhalimskySpaceND.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testKhalimskySpaceND.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLabelBoundaries.dir/testLabelBoundaries.cpp.o"
+  "CMakeFiles/testLabelBoundaries.dir/testLabelBoundaries.cpp.o.d"
+  "testLabelBoundaries"
+  "testLabelBoundaries.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLabelBoundaries.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
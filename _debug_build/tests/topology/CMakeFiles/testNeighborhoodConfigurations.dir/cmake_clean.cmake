@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testNeighborhoodConfigurations.dir/testNeighborhoodConfigurations.cpp.o"
+  "CMakeFiles/testNeighborhoodConfigurations.dir/testNeighborhoodConfigurations.cpp.o.d"
+  "testNeighborhoodConfigurations"
+  "testNeighborhoodConfigurations.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testNeighborhoodConfigurations.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testObject.dir/testObject.cpp.o"
+  "CMakeFiles/testObject.dir/testObject.cpp.o.d"
+  "testObject"
+  "testObject.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testObject.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
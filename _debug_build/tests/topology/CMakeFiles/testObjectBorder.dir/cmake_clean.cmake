@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testObjectBorder.dir/testObjectBorder.cpp.o"
+  "CMakeFiles/testObjectBorder.dir/testObjectBorder.cpp.o.d"
+  "testObjectBorder"
+  "testObjectBorder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testObjectBorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testParDirCollapse.dir/testParDirCollapse.cpp.o"
+  "CMakeFiles/testParDirCollapse.dir/testParDirCollapse.cpp.o.d"
+  "testParDirCollapse"
+  "testParDirCollapse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testParDirCollapse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testParallelTrackBoundary.dir/testParallelTrackBoundary.cpp.o"
+  "CMakeFiles/testParallelTrackBoundary.dir/testParallelTrackBoundary.cpp.o.d"
+  "testParallelTrackBoundary"
+  "testParallelTrackBoundary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testParallelTrackBoundary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSCellsFunctor.dir/testSCellsFunctor.cpp.o"
+  "CMakeFiles/testSCellsFunctor.dir/testSCellsFunctor.cpp.o.d"
+  "testSCellsFunctor"
+  "testSCellsFunctor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSCellsFunctor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSimpleExpander.dir/testSimpleExpander.cpp.o"
+  "CMakeFiles/testSimpleExpander.dir/testSimpleExpander.cpp.o.d"
+  "testSimpleExpander"
+  "testSimpleExpander.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSimpleExpander.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSurfaceHelper.dir/testSurfaceHelper.cpp.o"
+  "CMakeFiles/testSurfaceHelper.dir/testSurfaceHelper.cpp.o.d"
+  "testSurfaceHelper"
+  "testSurfaceHelper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSurfaceHelper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
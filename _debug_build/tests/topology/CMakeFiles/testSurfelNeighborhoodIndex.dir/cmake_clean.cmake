@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSurfelNeighborhoodIndex.dir/testSurfelNeighborhoodIndex.cpp.o"
+  "CMakeFiles/testSurfelNeighborhoodIndex.dir/testSurfelNeighborhoodIndex.cpp.o.d"
+  "testSurfelNeighborhoodIndex"
+  "testSurfelNeighborhoodIndex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSurfelNeighborhoodIndex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testUmbrellaComputer.dir/testUmbrellaComputer.cpp.o"
+  "CMakeFiles/testUmbrellaComputer.dir/testUmbrellaComputer.cpp.o.d"
+  "testUmbrellaComputer"
+  "testUmbrellaComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testUmbrellaComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
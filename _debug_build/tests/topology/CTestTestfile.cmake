@@ -0,0 +1,44 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/topology
+# Build directory: /root/repo/_debug_build/tests/topology
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testAdjacency "testAdjacency")
+set_tests_properties(testAdjacency PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testKhalimskySpaceND "testKhalimskySpaceND")
+set_tests_properties(testKhalimskySpaceND PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testCubicalComplex "testCubicalComplex")
+set_tests_properties(testCubicalComplex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testDigitalSurface "testDigitalSurface")
+set_tests_properties(testDigitalSurface PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testDigitalTopology "testDigitalTopology")
+set_tests_properties(testDigitalTopology PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testObject "testObject")
+set_tests_properties(testObject PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testComponentLabelling "testComponentLabelling")
+set_tests_properties(testComponentLabelling PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testObjectBorder "testObjectBorder")
+set_tests_properties(testObjectBorder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testSimpleExpander "testSimpleExpander")
+set_tests_properties(testSimpleExpander PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testSCellsFunctor "testSCellsFunctor")
+set_tests_properties(testSCellsFunctor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testUmbrellaComputer "testUmbrellaComputer")
+set_tests_properties(testUmbrellaComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testSurfaceHelper "testSurfaceHelper")
+set_tests_properties(testSurfaceHelper PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testDigitalSetToCellularGridConverter "testDigitalSetToCellularGridConverter")
+set_tests_properties(testDigitalSetToCellularGridConverter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testNeighborhoodConfigurations "testNeighborhoodConfigurations")
+set_tests_properties(testNeighborhoodConfigurations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testParDirCollapse "testParDirCollapse")
+set_tests_properties(testParDirCollapse PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testSurfelNeighborhoodIndex "testSurfelNeighborhoodIndex")
+set_tests_properties(testSurfelNeighborhoodIndex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testIndexedDigitalSurface "testIndexedDigitalSurface")
+set_tests_properties(testIndexedDigitalSurface PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testParallelTrackBoundary "testParallelTrackBoundary")
+set_tests_properties(testParallelTrackBoundary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
+add_test(testLabelBoundaries "testLabelBoundaries")
+set_tests_properties(testLabelBoundaries PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/topology/CMakeLists.txt;26;add_test;/root/repo/tests/topology/CMakeLists.txt;0;")
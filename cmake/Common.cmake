@@ -58,6 +58,7 @@ OPTION(DEBUG_VERBOSE "Verbose debug messages." OFF)
 OPTION(VERBOSE "Verbose messages." OFF)
 OPTION(COLOR_WITH_ALPHA_ARITH "Consider alpha channel in color arithmetical operations." OFF)
 OPTION(DGTAL_NO_ESCAPED_CHAR_IN_TRACE "Avoid printing special color and font weight terminal escaped char in program output." OFF)
+OPTION(DGTAL_ATOMIC_COUNTED_PTR "Use atomic reference counts in CountedPtr, CountedPtrOrPtr and CowPtr (thread-safe sharing)." OFF)
 
 SET(VERBOSE_DGTAL 0)
 SET(DEBUG_VERBOSE_DGTAL 0)
@@ -79,6 +80,10 @@ IF(COLOR_WITH_ALPHA_ARITH)
   ADD_DEFINITIONS(-DCOLOR_WITH_ALPHA_ARITH)
 ENDIF(COLOR_WITH_ALPHA_ARITH)
 
+IF(DGTAL_ATOMIC_COUNTED_PTR)
+  MESSAGE(STATUS "Atomic reference counts in smart pointers activated")
+ENDIF(DGTAL_ATOMIC_COUNTED_PTR)
+
 # -----------------------------------------------------------------------------
 # Benchmark target
 # -----------------------------------------------------------------------------
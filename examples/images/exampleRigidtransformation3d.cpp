@@ -49,6 +49,7 @@
 #include "DGtal/io/writers/GenericWriter.h"
 //! [include]
 #include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageResampler.h"
 //! [include]
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -91,6 +92,14 @@ int main( int , char** )
       adapter >> "backward_transform.pgm3d";
     trace.endBlock();
   
+    trace.beginBlock ( "Backward - Eulerian model with trilinear interpolation" );
+    //! [resampler]
+      ImageResampler<Image> resampler ( backwardTrans, ImageResampler<Image>::LINEAR );
+      Image resampled = resampler.resample ( image, transformedDomain );
+    //! [resampler]
+      resampled >> "backward_transform_linear.pgm3d";
+    trace.endBlock();
+
     trace.beginBlock( "Forward - Lagrangian model" );
       Image transformed ( transformedDomain );
      //! [forward]
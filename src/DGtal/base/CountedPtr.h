@@ -44,6 +44,9 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#ifdef DGTAL_ATOMIC_COUNTED_PTR
+#include <atomic>
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -71,6 +74,13 @@ namespace DGtal
    * smart_p2 = smart_p1;  // second object is freed, first object is now shared.
    * @endcode
    *
+   * When DGtal is configured with DGTAL_ATOMIC_COUNTED_PTR (see
+   * Config.h), reference counts are atomic: distinct smart pointers
+   * (CountedPtr, CountedPtrOrPtr, CountedConstPtrOrConstPtr, CowPtr)
+   * sharing the same object may then be copied and destroyed
+   * concurrently by several threads, as for std::shared_ptr. A given
+   * smart pointer object must still not be modified concurrently.
+   *
    * @tparam T any data type.
    *
    * Taken from http://ootips.org/yonat/4dev/smart-pointers.html
@@ -101,10 +111,52 @@ namespace DGtal
        * counter.
        */
       Counter(T* p = 0, unsigned c = 1) : ptr(p), count(c) {}
+
+      /// Adds a reference to this counter.
+      void addReference()
+      {
+#ifdef DGTAL_ATOMIC_COUNTED_PTR
+        count.fetch_add( 1, std::memory_order_relaxed );
+#else
+        ++count;
+#endif
+      }
+
+      /**
+       * Removes a reference to this counter.
+       * @return 'true' if it was the last reference.
+       */
+      bool removeReference()
+      {
+#ifdef DGTAL_ATOMIC_COUNTED_PTR
+        // Release the accesses of this thread to the object, acquire
+        // the ones of the other threads before it is deleted.
+        return count.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+#else
+        return --count == 0;
+#endif
+      }
+
+      /// @return the number of references to this counter.
+      unsigned int nbReferences() const
+      {
+#ifdef DGTAL_ATOMIC_COUNTED_PTR
+        // Acquire so that a copy-on-write seeing a unique reference
+        // happens after the accesses of the released references.
+        return count.load( std::memory_order_acquire );
+#else
+        return count;
+#endif
+      }
+
       /// A pointer to a (shared) dynamically allocated object of type T.
       T*          ptr;
       /// The number of CountedPtr pointing to this counter.
+#ifdef DGTAL_ATOMIC_COUNTED_PTR
+      std::atomic<unsigned int> count;
+#else
       unsigned    count;
+#endif
     };
 
 
@@ -203,7 +255,7 @@ namespace DGtal
      */
     bool unique()   const throw()
     {
-      return (myCounter ? myCounter->count == 1 : true);
+      return (myCounter ? myCounter->nbReferences() == 1 : true);
     }
 
     /**
@@ -235,7 +287,7 @@ namespace DGtal
      */
     unsigned int count() const      
     {
-      return myCounter->count;
+      return myCounter->nbReferences();
     }
 
     /**
@@ -265,7 +317,7 @@ private:
     void acquire(Counter* c) throw()
     { // increment the count
         myCounter = c;
-        if (c) ++c->count;
+        if (c) c->addReference();
     }
 
     /**
@@ -278,7 +330,7 @@ private:
     void release()
     { // decrement the count, delete if it is 0
         if (myCounter) {
-            if (--myCounter->count == 0) {
+            if (myCounter->removeReference()) {
                 delete myCounter->ptr;
                 delete myCounter;
             }
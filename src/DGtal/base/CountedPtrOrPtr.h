@@ -300,7 +300,7 @@ namespace DGtal
     bool unique()   const throw()
     {
       return myIsCountedPtr
-	? ( myAny ? counterPtr()->count == 1 : true )
+	? ( myAny ? counterPtr()->nbReferences() == 1 : true )
 	: true;
     }
     
@@ -313,7 +313,7 @@ namespace DGtal
      */
     unsigned int count() const
     {
-      return myIsCountedPtr ? counterPtr()->count : 0; 
+      return myIsCountedPtr ? counterPtr()->nbReferences() : 0; 
     }
 
     /**
@@ -384,7 +384,7 @@ private:
       // Travis is too slow in Debug mode with this ASSERT.
       ASSERT( myIsCountedPtr );
       myAny = static_cast<void*>( c );
-      if (c) ++c->count;
+      if (c) c->addReference();
     }
 
     /**
@@ -401,7 +401,7 @@ private:
       ASSERT( myIsCountedPtr );
       if (myAny) {
         Counter * counter = counterPtr();
-        if (--counter->count == 0) {
+        if (counter->removeReference()) {
           delete counter->ptr;
           delete counter;
         }
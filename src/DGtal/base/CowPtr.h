@@ -61,6 +61,11 @@ namespace DGtal
    * modified. When it is about to be modified, copy it and modify the
    * copy.
    *
+   * With DGTAL_ATOMIC_COUNTED_PTR (see CountedPtr), copies of a CowPtr
+   * may be used by different threads: the object is shared for
+   * reading, and a thread writing through its own copy first detaches
+   * it if the object is still shared.
+   *
    * Taken from http://ootips.org/yonat/4dev/smart-pointers.html
    */
   template <typename T>
@@ -158,7 +163,9 @@ public:
     // ------------------------- Internals ------------------------------------
   private:
     void copy()                            // create a new copy of myPtr
-    {
+    { // The duplication of the shared object happens before the
+      // release of this reference, hence before any thread sees its
+      // own reference as unique and writes to the object.
         if (!myPtr.unique()) {
             T* old_p = myPtr.get();
             myPtr = CountedPtr<T>(new T(*old_p));
@@ -0,0 +1,399 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OpenAddressingMap.h
+ * @author DGtal team
+ *
+ * @date 2016/11/23
+ *
+ * Header file for template class OpenAddressingMap
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OpenAddressingMap_RECURSES)
+#error Recursive header files inclusion detected in OpenAddressingMap.h
+#else // defined(OpenAddressingMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OpenAddressingMap_RECURSES
+
+#if !defined OpenAddressingMap_h
+/** Prevents repeated inclusion of headers. */
+#define OpenAddressingMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingMap
+  /**
+     Description of template class 'OpenAddressingMap' <p> \brief Aim:
+     An unordered associative container Key -> Value, which stores its
+     pairs in one flat array with open addressing (linear probing).
+
+     Lookups probe consecutive slots of the array instead of following
+     the node lists of std::unordered_map or the tree of std::map,
+     and a pair costs no memory allocation. It is well suited to
+     containers of small keys that are mostly queried, like the cells
+     of a CubicalComplex (see CubicalComplex, as its TCellContainer).
+
+     It is a model of boost::PairAssociativeContainer and
+     boost::UniqueAssociativeContainer, with the interface of
+     std::unordered_map for the services it provides. Its
+     ContainerTraits category is UnorderedMapAssociativeCategory, so
+     it works with SetFunctions.
+
+     The load factor is kept below 1/2. Erased pairs leave a tombstone
+     in their slot: erasing does not invalidate iterators nor
+     references to other pairs. Inserting may rehash the array and
+     then invalidates all iterators and references (contrary to
+     std::unordered_map, whose references stay valid).
+
+     Concurrent reads (find, count, operator(), iteration) are safe,
+     as for standard containers.
+
+     @tparam TKey the type of keys (copy constructible).
+     @tparam TValue the type of values (default constructible).
+     @tparam THash a hash functor for keys.
+     @tparam TKeyEqual an equality predicate for keys.
+  */
+  template < typename TKey, typename TValue,
+             typename THash = std::hash< TKey >,
+             typename TKeyEqual = std::equal_to< TKey > >
+  class OpenAddressingMap
+  {
+  public:
+    typedef OpenAddressingMap< TKey, TValue, THash, TKeyEqual > Self;
+    typedef TKey                         key_type;
+    typedef TValue                       mapped_type;
+    typedef std::pair< const TKey, TValue > value_type;
+    typedef THash                        hasher;
+    typedef TKeyEqual                    key_equal;
+    typedef std::size_t                  size_type;
+    typedef std::ptrdiff_t               difference_type;
+    typedef value_type&                  reference;
+    typedef const value_type&            const_reference;
+    typedef value_type*                  pointer;
+    typedef const value_type*            const_pointer;
+
+    /// Forward iterator on the pairs, skipping the free slots.
+    template < typename TMapPtr, typename TPair >
+    class SlotIterator
+      : public boost::iterator_facade< SlotIterator< TMapPtr, TPair >, TPair,
+                                       std::forward_iterator_tag >
+    {
+      friend class OpenAddressingMap;
+      friend class boost::iterator_core_access;
+      template < typename, typename > friend class SlotIterator;
+    public:
+      /// Default iterator. Invalid.
+      SlotIterator() : myMap( 0 ), myIndex( 0 ) {}
+
+      /// Conversion from a mutable iterator.
+      template < typename TOtherMapPtr, typename TOtherPair >
+      SlotIterator( const SlotIterator< TOtherMapPtr, TOtherPair > & other )
+        : myMap( other.myMap ), myIndex( other.myIndex ) {}
+
+    private:
+      SlotIterator( TMapPtr aMap, size_type anIndex )
+        : myMap( aMap ), myIndex( anIndex ) {}
+
+      /// Moves to the first occupied slot at or after the current one.
+      void skip()
+      {
+        while ( myIndex < myMap->myCapacity && myMap->myStates[ myIndex ] != FULL )
+          ++myIndex;
+      }
+
+      void increment()
+      {
+        ++myIndex;
+        skip();
+      }
+
+      template < typename TOtherMapPtr, typename TOtherPair >
+      bool equal( const SlotIterator< TOtherMapPtr, TOtherPair > & other ) const
+      {
+        return myMap == other.myMap && myIndex == other.myIndex;
+      }
+
+      TPair & dereference() const
+      {
+        return myMap->mySlots[ myIndex ];
+      }
+
+      /// The map.
+      TMapPtr myMap;
+      /// The index of the slot.
+      size_type myIndex;
+    };
+
+    typedef SlotIterator< Self*, value_type >             iterator;
+    typedef SlotIterator< const Self*, const value_type > const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param n the number of pairs that may be inserted without rehashing.
+     * @param aHash the hash functor.
+     * @param anEqual the key equality predicate.
+     */
+    explicit OpenAddressingMap( size_type n = 0,
+                                const hasher & aHash = hasher(),
+                                const key_equal & anEqual = key_equal() );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    OpenAddressingMap( const OpenAddressingMap & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    OpenAddressingMap & operator= ( const OpenAddressingMap & other );
+
+    /**
+     * Destructor.
+     */
+    ~OpenAddressingMap();
+
+    /// @return the number of pairs.
+    size_type size() const;
+    /// @return the maximal number of pairs.
+    size_type max_size() const;
+    /// @return 'true' if there is no pair.
+    bool empty() const;
+    /// @return the number of slots.
+    size_type capacity() const;
+    /// @return the hash functor.
+    hasher hash_function() const;
+    /// @return the key equality predicate.
+    key_equal key_eq() const;
+
+    /// @return an iterator on the first pair.
+    iterator begin();
+    /// @return an iterator after the last pair.
+    iterator end();
+    /// @return a const iterator on the first pair.
+    const_iterator begin() const;
+    /// @return a const iterator after the last pair.
+    const_iterator end() const;
+
+    /**
+     * @param aKey any key.
+     * @return an iterator on the pair of key \a aKey, or end().
+     */
+    iterator find( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return a const iterator on the pair of key \a aKey, or end().
+     */
+    const_iterator find( const key_type & aKey ) const;
+
+    /**
+     * @param aKey any key.
+     * @return 1 if \a aKey is in the map, 0 otherwise.
+     */
+    size_type count( const key_type & aKey ) const;
+
+    /**
+     * @param aKey any key.
+     * @return the range of the pairs of key \a aKey (empty or one pair).
+     */
+    std::pair< iterator, iterator > equal_range( const key_type & aKey );
+
+    /**
+     * @param aKey any key.
+     * @return the range of the pairs of key \a aKey (empty or one pair).
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const key_type & aKey ) const;
+
+    /**
+     * Inserts a pair if its key is not already in the map.
+     * @param aValue any pair key/value.
+     * @return an iterator on the pair with this key and 'true' if it
+     * was inserted, 'false' if the key was already in the map.
+     */
+    std::pair< iterator, bool > insert( const value_type & aValue );
+
+    /**
+     * Inserts a pair if its key is not already in the map.
+     * @param hint an iterator, which is ignored.
+     * @param aValue any pair key/value.
+     * @return an iterator on the pair with this key.
+     */
+    iterator insert( const_iterator hint, const value_type & aValue );
+
+    /**
+     * Inserts the pairs of the range [first,last).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template < typename InputIterator >
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * @param aKey any key.
+     * @return a reference on the value associated to \a aKey, which
+     * is inserted with a default value if it is not in the map.
+     */
+    mapped_type & operator[]( const key_type & aKey );
+
+    /**
+     * Erases a pair.
+     * @param position an iterator on a pair of the map.
+     * @return an iterator on the pair following the erased one.
+     */
+    iterator erase( const_iterator position );
+
+    /**
+     * Erases the pair of key \a aKey.
+     * @param aKey any key.
+     * @return the number of erased pairs (0 or 1).
+     */
+    size_type erase( const key_type & aKey );
+
+    /**
+     * Erases the pairs in the range [first,last).
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     * @return last.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /**
+     * Removes all pairs. The capacity is kept.
+     */
+    void clear();
+
+    /**
+     * Prepares the map so that \a n pairs may be stored without rehashing.
+     * @param n a number of pairs.
+     */
+    void reserve( size_type n );
+
+    /**
+     * Swaps the content of this map with the one of \a other.
+     * @param other any other map.
+     */
+    void swap( OpenAddressingMap & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// State of a slot.
+    enum SlotState { EMPTY = 0, FULL = 1, DELETED = 2 };
+
+    /// The number of slots (0 or a power of two).
+    size_type myCapacity;
+    /// The number of pairs.
+    size_type mySize;
+    /// The number of tombstones.
+    size_type myNbDeleted;
+    /// The slots (pairs are constructed in place in FULL slots only).
+    value_type* mySlots;
+    /// The states of the slots.
+    std::vector< unsigned char > myStates;
+    /// The hash functor.
+    hasher myHash;
+    /// The key equality predicate.
+    key_equal myEqual;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the first slot of the probe sequence of \a aKey.
+    size_type firstSlot( const key_type & aKey ) const;
+
+    /// @return the slot of \a aKey, or myCapacity if it is absent.
+    size_type findSlot( const key_type & aKey ) const;
+
+    /// Rebuilds the array with at least \a n slots, removing tombstones.
+    void rehash( size_type n );
+
+    /// Destroys all pairs and frees the slots.
+    void release();
+
+  }; // end of class OpenAddressingMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OpenAddressingMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OpenAddressingMap' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKey, typename TValue, typename THash, typename TKeyEqual >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OpenAddressingMap< TKey, TValue, THash, TKeyEqual > & object );
+
+  /// Defines container traits for OpenAddressingMap<>.
+  template < typename TKey, typename TValue, typename THash, typename TKeyEqual >
+  struct ContainerTraits< OpenAddressingMap< TKey, TValue, THash, TKeyEqual > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/OpenAddressingMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OpenAddressingMap_h
+
+#undef OpenAddressingMap_RECURSES
+#endif // else defined(OpenAddressingMap_RECURSES)
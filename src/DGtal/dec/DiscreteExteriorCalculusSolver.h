@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
@@ -51,6 +52,24 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Sparsity pattern of the last matrix analyzed by a
+     * DiscreteExteriorCalculusSolver (compressed storage indexes).
+     */
+    struct DECSolverPattern
+    {
+      bool analyzed;
+      std::ptrdiff_t rows;
+      std::ptrdiff_t cols;
+      std::vector<std::ptrdiff_t> outerIndexes;
+      std::vector<std::ptrdiff_t> innerIndexes;
+
+      DECSolverPattern() : analyzed(false), rows(0), cols(0) {}
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
   /**
@@ -58,14 +77,30 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * When the problem operator is a sparse matrix and the linear algebra
+   * solver splits compute() into analyzePattern() and factorize() (as
+   * Eigen sparse solvers and MultigridSolver do), the symbolic analysis
+   * is only done again when the sparsity pattern of the operator
+   * changes, e.g. not when only its diagonal or the right hand side
+   * change between the steps of an iterative scheme. Solvers with a
+   * solveWithGuess() method (Eigen iterative solvers, MultigridSolver)
+   * may be warm started from a previous solution. The timings of each
+   * compute() and solve() call, and the iterations of iterative
+   * solvers, are given to an optional statistics hook.
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
    * @tparam duality_in is the input duality of the linear problem.
    * @tparam order_out is the output order of the linear problem.
    * @tparam duality_out is the output duality of the linear problem.
+   * @tparam TOperator is the type of the problem operator, LinearOperator
+   * by default. A StencilOperator (matrix-free) may be used with its
+   * iterative solvers StencilOperator::SolverConjugateGradient and
+   * StencilOperator::SolverBiCGSTAB.
    */
-  template <typename TCalculus, typename TLinearAlgebraSolver, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  template <typename TCalculus, typename TLinearAlgebraSolver, Order order_in, Duality duality_in, Order order_out, Duality duality_out,
+            typename TOperator = LinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> >
   class DiscreteExteriorCalculusSolver
   {
     // ----------------------- Standard services ------------------------------
@@ -78,7 +113,7 @@ namespace DGtal
     typedef TCalculus Calculus;
     typedef TLinearAlgebraSolver LinearAlgebraSolver;
 
-    typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
+    typedef TOperator Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
 
@@ -119,6 +154,56 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem input, starting from an
+     * initial guess when the linear algebra solver supports it (the
+     * guess is ignored by direct solvers).
+     * @param input_kform input k-form.
+     * @param guess_kform initial guess, e.g. the previous solution.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform, const SolutionKForm& guess_kform) const;
+
+    /**
+     * Statistics of a compute() or solve() call. Times are in ms.
+     */
+    struct Statistics
+    {
+      bool solve; ///< 'false' for compute(), 'true' for solve()
+      bool patternReused; ///< compute(): the previous symbolic analysis was reused
+      double analyzeTime; ///< compute(): symbolic analysis time
+      double factorizeTime; ///< compute(): numerical factorization (or whole compute) time
+      double solveTime; ///< solve(): time
+      int iterations; ///< solve(): iterations of iterative solvers, -1 otherwise
+      double error; ///< solve(): estimated relative error of iterative solvers, -1 otherwise
+
+      Statistics();
+    };
+
+    /**
+     * Statistics hook, called after each compute() and solve() with
+     * the statistics of the call and the user data.
+     */
+    typedef void (*StatisticsHook)(const Statistics& statistics, void* data);
+
+    /**
+     * Sets the statistics hook.
+     * @param hook the hook, or NULL to remove it.
+     * @param data user data given to the hook.
+     */
+    void setStatisticsHook(StatisticsHook hook, void* data = NULL);
+
+    /**
+     * @return the statistics of the last compute() or solve() call.
+     */
+    const Statistics& statistics() const;
+
+    /**
+     * When 'true' (default), compute() reuses the symbolic analysis of
+     * the previous operator if their sparsity patterns are equal.
+     */
+    bool myReusePattern;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -128,12 +213,33 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
+    /**
+     * Sparsity pattern of the last analyzed operator.
+     */
+    detail::DECSolverPattern myPattern;
+
+    /**
+     * Statistics hook and its user data.
+     */
+    StatisticsHook myStatisticsHook;
+    void* myStatisticsData;
+
+    /**
+     * Statistics of the last call.
+     */
+    mutable Statistics myStatistics;
+
     // ------------------------- Hidden services ------------------------------
   protected:
 
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Gives the statistics of the last call to the hook.
+     */
+    void reportStatistics() const;
+
   }; // end of class DiscreteExteriorCalculusSolver
 
 
@@ -143,9 +249,9 @@ namespace DGtal
    * @param object the object of class 'DiscreteExteriorCalculusSolver' to write.
    * @return the output stream after the writing.
    */
-  template <typename C, typename S, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  template <typename C, typename S, Order order_in, Duality duality_in, Order order_out, Duality duality_out, typename O>
   std::ostream&
-  operator<<(std::ostream& out, const DiscreteExteriorCalculusSolver<C, S, order_in, duality_in, order_out, duality_out>& object);
+  operator<<(std::ostream& out, const DiscreteExteriorCalculusSolver<C, S, order_in, duality_in, order_out, duality_out, O>& object);
 
 } // namespace DGtal
 
@@ -0,0 +1,338 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MultigridSolver.h
+ * @author DGtal team
+ *
+ * @date 2016/12/05
+ *
+ * Header file for module MultigridSolver.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MultigridSolver_RECURSES)
+#error Recursive header files inclusion detected in MultigridSolver.h
+#else // defined(MultigridSolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MultigridSolver_RECURSES
+
+#if !defined MultigridSolver_h
+/** Prevents repeated inclusion of headers. */
+#define MultigridSolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MultigridSolver
+  /**
+   * Description of template class 'MultigridSolver' <p>
+   * \brief Aim:
+   * Geometric multigrid solver for linear problems on the 0-cells or
+   * on the n-cells of a discrete exterior calculus, e.g. primal or
+   * dual laplace (Poisson) problems on a calculus built from a
+   * digital set. This is a model of concepts::CLinearAlgebraSolver,
+   * hence usable as TLinearAlgebraSolver of
+   * DiscreteExteriorCalculusSolver.
+   *
+   * The calculus must be attached before calling compute(). Each
+   * level of the hierarchy halves the grid along each axis: the cells
+   * of a level are grouped by blocks of 2^n neighbouring cells, each
+   * block giving a cell of the next level. The prolongation from a
+   * level to the finer one is the piecewise constant interpolation on
+   * blocks, smoothed by one damped Jacobi step of the level operator,
+   * the restriction is its transpose and the coarse operators are the
+   * Galerkin products (restriction * operator * prolongation), so that
+   * any operator on the cells (laplace, shifted laplace, ...) is
+   * supported. Levels are smoothed by forward (before coarsening) and
+   * backward (after) Gauss-Seidel sweeps, and the coarsest level is
+   * solved by a sparse LU factorization.
+   *
+   * solve() runs V-cycles until the relative residual is below the
+   * tolerance, or the maximum number of iterations is reached. The
+   * problem should be definite, e.g. the dual laplace of a calculus
+   * with border, or the (singular) primal laplace plus a positive
+   * multiple of the identity.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus, with the
+   * Eigen linear algebra backend.
+   * @tparam order order of the unknown form (0 or dimEmbedded).
+   * @tparam duality duality of the unknown form.
+   */
+  template <typename TCalculus, Order order, Duality duality>
+  class MultigridSolver
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef MultigridSolver<TCalculus, order, duality> Self;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Calculus::dimensionEmbedded );
+    BOOST_STATIC_ASSERT(( order == 0 || order == dimension ));
+
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::Point Point;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::SparseMatrix SparseMatrix;
+    typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, typename SparseMatrix::StorageIndex> RowSparseMatrix;
+
+    /**
+     * Constructor. The calculus must be attached before compute().
+     */
+    MultigridSolver();
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus (aliased).
+     */
+    MultigridSolver(ConstAlias<Calculus> calculus);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Number of Gauss-Seidel sweeps before coarsening.
+     */
+    unsigned int myNbPreSmoothing;
+
+    /**
+     * Number of Gauss-Seidel sweeps after coarsening.
+     */
+    unsigned int myNbPostSmoothing;
+
+    /**
+     * Levels are coarsened until they have at most this number of
+     * cells.
+     */
+    Index myCoarsestSize;
+
+    /**
+     * Attaches the calculus whose cells are the unknowns.
+     * @param calculus the discrete exterior calculus, whose indexes
+     * must be up to date (aliased).
+     */
+    void attachCalculus(ConstAlias<Calculus> calculus);
+
+    /**
+     * Builds the hierarchy of levels of an operator, i.e.
+     * analyzePattern() then factorize().
+     * @param matrix the operator matrix, whose columns are indexed by
+     * the cells of the unknown form and rows by the same cells.
+     * @return a reference to this.
+     */
+    Self& compute(const SparseMatrix& matrix);
+
+    /**
+     * Groups the cells into the levels of the hierarchy. This only
+     * depends on the cells of the unknown form, and may be shared by
+     * several factorize() calls.
+     * @param matrix the operator matrix (only its size is used).
+     * @return a reference to this.
+     */
+    Self& analyzePattern(const SparseMatrix& matrix);
+
+    /**
+     * Builds the operators of the levels of the hierarchy, grouped by
+     * the last analyzePattern() call.
+     * @param matrix the operator matrix.
+     * @return a reference to this.
+     */
+    Self& factorize(const SparseMatrix& matrix);
+
+    /**
+     * Solves the problem with V-cycles, from zero.
+     * @param input the right hand side.
+     * @return the solution.
+     */
+    DenseVector solve(const DenseVector& input) const;
+
+    /**
+     * Solves the problem with V-cycles, from an initial guess.
+     * @param input the right hand side.
+     * @param guess the initial guess.
+     * @return the solution.
+     */
+    DenseVector solveWithGuess(const DenseVector& input, const DenseVector& guess) const;
+
+    /**
+     * @return Eigen::Success if the last compute() and solve() succeeded,
+     * Eigen::NoConvergence if solve() reached the maximum number of
+     * iterations, Eigen::NumericalIssue if compute() failed or solve()
+     * diverged.
+     */
+    Eigen::ComputationInfo info() const;
+
+    /**
+     * Sets the relative residual tolerance (1e-8 by default).
+     * @param tolerance the tolerance.
+     * @return a reference to this.
+     */
+    Self& setTolerance(const Scalar& tolerance);
+
+    /**
+     * Sets the maximum number of V-cycles of solve() (100 by default).
+     * @param max_iterations the maximum number of V-cycles.
+     * @return a reference to this.
+     */
+    Self& setMaxIterations(const Index max_iterations);
+
+    /**
+     * @return the number of V-cycles of the last solve().
+     */
+    Index iterations() const;
+
+    /**
+     * @return the relative residual of the last solve().
+     */
+    Scalar error() const;
+
+    /**
+     * @return the number of levels of the hierarchy (the levels with
+     * an operator after factorize()).
+     */
+    Index nbLevels() const;
+
+    /**
+     * @param level a level of the hierarchy (0 being the finest).
+     * @return the number of cells of the level.
+     */
+    Index levelSize(const Index level) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * A level of the hierarchy.
+     */
+    struct Level
+    {
+      RowSparseMatrix matrix; ///< operator of the level
+      DenseVector inverseDiagonal; ///< inverse of the diagonal of the operator
+      std::vector<Point> coordinates; ///< grid coordinates of the cells
+      SparseMatrix aggregation; ///< piecewise constant prolongation from the next level
+      RowSparseMatrix prolongation; ///< from the next (coarser) level
+      RowSparseMatrix restriction; ///< to the next (coarser) level
+    };
+
+    std::vector<Level> myLevels;
+    std::size_t myDepth; ///< number of levels with an operator
+    Eigen::SparseLU<SparseMatrix> myCoarsestSolver;
+    bool myCoarsestFactorized;
+    Eigen::ComputationInfo myComputeInfo;
+    Scalar myTolerance;
+    Index myMaxIterations;
+    mutable Eigen::ComputationInfo mySolveInfo;
+    mutable Index myIterations;
+    mutable Scalar myError;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Sets the operator of a level and its diagonal.
+     * @param level a level.
+     * @param matrix the operator.
+     * @return 'false' if a diagonal entry is zero.
+     */
+    bool setOperator(Level& level, const SparseMatrix& matrix) const;
+
+    /**
+     * Groups the cells of a level by blocks of 2^n cells.
+     * @param fine a level.
+     * @param[out] coarse_coordinates the coordinates of the blocks.
+     * @return the piecewise constant prolongation from blocks to cells.
+     */
+    SparseMatrix aggregate(const Level& fine, std::vector<Point>& coarse_coordinates) const;
+
+    /**
+     * Gauss-Seidel sweeps.
+     * @param level a level.
+     * @param input the right hand side.
+     * @param[in,out] solution the current solution.
+     * @param nb_sweeps the number of sweeps.
+     * @param forward 'true' to sweep from the first cell to the last one.
+     */
+    void smooth(const Level& level, const DenseVector& input, DenseVector& solution,
+                const unsigned int nb_sweeps, const bool forward) const;
+
+    /**
+     * Runs a V-cycle from a level.
+     * @param level_index a level index.
+     * @param input the right hand side.
+     * @param[in,out] solution the current solution.
+     */
+    void cycle(const std::size_t level_index, const DenseVector& input, DenseVector& solution) const;
+
+  }; // end of class MultigridSolver
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MultigridSolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MultigridSolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus, Order order, Duality duality>
+  std::ostream&
+  operator<<(std::ostream& out, const MultigridSolver<TCalculus, order, duality>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MultigridSolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MultigridSolver_h
+
+#undef MultigridSolver_RECURSES
+#endif // else defined(MultigridSolver_RECURSES)
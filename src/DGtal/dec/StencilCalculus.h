@@ -0,0 +1,424 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StencilCalculus.h
+ * @author DGtal team
+ *
+ * @date 2016/11/28
+ *
+ * Header file for module StencilCalculus.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StencilCalculus_RECURSES)
+#error Recursive header files inclusion detected in StencilCalculus.h
+#else // defined(StencilCalculus_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StencilCalculus_RECURSES
+
+#if !defined StencilCalculus_h
+/** Prevents repeated inclusion of headers. */
+#define StencilCalculus_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <boost/array.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/StencilOperator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StencilCalculus
+  /**
+   * Description of template class 'StencilCalculus' <p>
+   * \brief Aim:
+   * Matrix-free operators of a discrete exterior calculus whose cells
+   * lie in the box of its (closed, non periodic) Khalimsky space,
+   * e.g. the calculus given by
+   * DiscreteExteriorCalculusFactory::createFromDigitalSet on a full
+   * rectangular domain.
+   *
+   * The cells of the box are split by type, i.e. by the set of axes
+   * along which they are open (odd Khalimsky coordinate), and the
+   * cells of each type are laid out in a dense sub-grid, first axis
+   * first. The sub-grids are concatenated by increasing cell
+   * dimension into a single grid, so that the cells of consecutive
+   * dimensions are a range of the grid. A kform is moved into a
+   * GridVector holding this range (gather), where the derivative is a
+   * fixed stencil between sub-grids (the values of the faces, or
+   * cofaces for dual forms, of each cell along each axis) whose
+   * orientations only depend on the cell types, and the hodge
+   * operator is a diagonal scaling. All loops along the first axis
+   * are unit-stride, and grid lines are processed in parallel when
+   * OpenMP is enabled.
+
+   * Operators are created with the same interface as
+   * DiscreteExteriorCalculus (derivative, antiderivative, hodge,
+   * laplace, identity) and give the same results as the assembled
+   * operators, without storing any matrix: each StencilOperator only
+   * stores a few steps and a grid vector of the dimensions it reads
+   * and writes, and the stencil calculus the grid position of each
+   * cell. The hodge factors are stored once per cell type, the cells
+   * whose sizes differ from most cells of their type (e.g. the border
+   * of a full box) being listed apart. Missing cells (not in the
+   * calculus) are zero, and flipped cells are handled by gather and
+   * scatter.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus, with equal
+   * embedded and ambient dimensions.
+   */
+  template <typename TCalculus>
+  class StencilCalculus
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef StencilCalculus<TCalculus> Self;
+
+    BOOST_STATIC_ASSERT(( Calculus::dimensionEmbedded == Calculus::dimensionAmbient ));
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Calculus::dimensionEmbedded );
+
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::Point Point;
+    typedef typename Calculus::Property Property;
+
+    /**
+     * Values of the cells of consecutive dimensions, i.e. of a range
+     * of grid positions (see resizeGrid).
+     */
+    struct GridVector
+    {
+      /// Grid position of the first value.
+      Index origin;
+      /// Value of each grid position from origin.
+      std::vector<Scalar> values;
+
+      GridVector() : origin(0) {}
+    };
+
+    /**
+     * Laplace operator typedefs.
+     */
+    typedef StencilOperator<Self, 0, PRIMAL, 0, PRIMAL> PrimalLaplace;
+    typedef StencilOperator<Self, 0, DUAL, 0, DUAL> DualLaplace;
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus, whose indexes
+     * must be up to date (aliased).
+     */
+    StencilCalculus(ConstAlias<Calculus> calculus);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Identity operator.
+     */
+    template <Order order, Duality duality>
+    StencilOperator<Self, order, duality, order, duality>
+    identity() const;
+
+    /**
+     * Derivative operator from order-forms to (order+1)-forms.
+     */
+    template <Order order, Duality duality>
+    StencilOperator<Self, order, duality, order+1, duality>
+    derivative() const;
+
+    /**
+     * Antiderivative operator from order-forms to (order-1)-forms.
+     */
+    template <Order order, Duality duality>
+    StencilOperator<Self, order, duality, order-1, duality>
+    antiderivative() const;
+
+    /**
+     * Laplace operator from duality 0-forms to duality 0-forms.
+     */
+    template <Duality duality>
+    StencilOperator<Self, 0, duality, 0, duality>
+    laplace() const;
+
+    /**
+     * Hodge operator from duality order-form to opposite duality
+     * (dimEmbedded-order)-forms.
+     */
+    template <Order order, Duality duality>
+    StencilOperator<Self, order, duality, Calculus::dimensionEmbedded-order, OppositeDuality<duality>::duality>
+    hodge() const;
+
+    /**
+     * @return the number of cells of the grid.
+     */
+    std::size_t gridSize() const;
+
+    /**
+     * @param dim a primal dimension.
+     * @return the number of cells of the calculus of dimension @a dim.
+     */
+    Index nbCells(const Dimension dim) const;
+
+    /**
+     * @return 'true' if every cell of the box belongs to the calculus.
+     */
+    bool isFull() const;
+
+    /**
+     * Resizes a grid vector to hold the cells of dimensions @a dim_min
+     * to @a dim_max. Its values are left unspecified.
+     * @param dim_min the first primal dimension.
+     * @param dim_max the last primal dimension.
+     * @param[out] grid the grid vector.
+     */
+    void resizeGrid(const Dimension dim_min, const Dimension dim_max, GridVector& grid) const;
+
+    /**
+     * Moves the values of the cells of dimension @a dim into a grid
+     * vector. Missing cells of this dimension are set to zero, other
+     * values are left unchanged.
+     * @param dim a primal dimension.
+     * @param form the values of the cells, by calculus index.
+     * @param[in,out] grid a grid vector holding the cells of dimension @a dim.
+     */
+    template <typename TVector>
+    void gather(const Dimension dim, const TVector& form, GridVector& grid) const;
+
+    /**
+     * Adds the grid values of the cells of dimension @a dim, times
+     * @a alpha, to a form.
+     * @param dim a primal dimension.
+     * @param grid a grid vector holding the cells of dimension @a dim.
+     * @param alpha scaling factor.
+     * @param[in,out] form the values of the cells, by calculus index.
+     */
+    template <typename TVector>
+    void scatter(const Dimension dim, const GridVector& grid, const Scalar& alpha, TVector& form) const;
+
+    /**
+     * Applies the derivative stencil within a grid vector: the cells
+     * of dimension @a dim are read, and the cells of the output
+     * dimension (@a dim+1 for primal forms, @a dim-1 for dual forms)
+     * are overwritten.
+     * @param dim primal dimension of the input cells.
+     * @param duality duality of the input form.
+     * @param[in,out] grid a grid vector holding both dimensions, zero
+     * on the missing cells of dimension @a dim.
+     */
+    void applyDerivative(const Dimension dim, const Duality duality, GridVector& grid) const;
+
+    /**
+     * Applies the (diagonal) hodge operator on the values of the
+     * cells of dimension @a dim, in place.
+     * @param dim primal dimension of the input cells.
+     * @param duality duality of the input form.
+     * @param[in,out] grid a grid vector holding the cells of dimension
+     * @a dim, zero on the missing ones.
+     */
+    void applyHodge(const Dimension dim, const Duality duality, GridVector& grid) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Number of cell types, a type being the set of open axes of the
+     * cells (bit k set for an odd Khalimsky coordinate along axis k).
+     */
+    BOOST_STATIC_CONSTANT( unsigned int, nbTypes = 1u << dimension );
+
+    /**
+     * Khalimsky coordinates of the first cell of the box.
+     */
+    Point myLowerKCoords;
+
+    /**
+     * Number of cells of each type along each axis.
+     */
+    boost::array<boost::array<Index, dimension>, nbTypes> myExtents;
+
+    /**
+     * Offset between neighbouring cells of each type along each axis.
+     */
+    boost::array<boost::array<Index, dimension>, nbTypes> myStrides;
+
+    /**
+     * Position of the first cell of each type in the grid.
+     */
+    boost::array<Index, nbTypes> myOffsets;
+
+    /**
+     * Position of the first cell of each dimension in the grid, and
+     * the grid size as last element.
+     */
+    boost::array<Index, dimension+2> myDimensionOffsets;
+
+    /**
+     * Number of cells of the grid.
+     */
+    std::size_t myGridSize;
+
+    /**
+     * Grid position of the cells of each dimension, by calculus index.
+     */
+    boost::array<std::vector<Index>, dimension+1> myPositions;
+
+    /**
+     * Sign (-1 for flipped cells) of the cells of each dimension, by
+     * calculus index. Empty when no cell of this dimension is flipped.
+     */
+    boost::array<std::vector<Scalar>, dimension+1> mySigns;
+
+    /**
+     * 1 for the cells of the calculus, 0 for the other cells of the
+     * grid. Empty when all cells belong to the calculus.
+     */
+    std::vector<Scalar> myPresence;
+
+    /**
+     * Grid positions and hodge factors of cells, by position.
+     */
+    typedef std::vector< std::pair<Index, Scalar> > HodgeExceptions;
+
+    /**
+     * Primal and dual hodge factors of most cells of each type.
+     */
+    boost::array<boost::array<Scalar, nbTypes>, 2> myHodgeScalars;
+
+    /**
+     * Primal and dual hodge factors of the cells whose factor is not
+     * the one of their type.
+     */
+    boost::array<HodgeExceptions, 2> myHodgeExceptions;
+
+    /**
+     * Primal and dual hodge factors of each cell of the grid, used
+     * instead of the factors by type when the exceptions would take
+     * more memory. Empty otherwise.
+     */
+    boost::array<std::vector<Scalar>, 2> myHodgeFactors;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    StencilCalculus();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param cell a cell of the box.
+     * @return its type.
+     */
+    unsigned int cellType(const Cell& cell) const;
+
+    /**
+     * @param cell a cell of the box.
+     * @return its grid position.
+     */
+    Index position(const Cell& cell) const;
+
+    /**
+     * @param cell a cell of the calculus.
+     * @param property its property.
+     * @param duality a duality.
+     * @return the coefficient of the cell in the hodge operator of the
+     * forms of this duality.
+     */
+    Scalar hodgeFactor(const Cell& cell, const Property& property, const Duality duality) const;
+
+    /**
+     * @param type a cell type.
+     * @return the number of cells of this type.
+     */
+    Index typeSize(const unsigned int type) const;
+
+    /**
+     * @param grid a grid vector.
+     * @param dim a primal dimension.
+     * @return 'true' if @a grid holds the cells of dimension @a dim.
+     */
+    bool holds(const GridVector& grid, const Dimension dim) const;
+
+    /**
+     * @param type a cell type.
+     * @return the number of open axes of the cells of this type, i.e.
+     * their dimension.
+     */
+    static Dimension typeDimension(const unsigned int type);
+
+  }; // end of class StencilCalculus
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StencilCalculus'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StencilCalculus' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus>
+  std::ostream&
+  operator<<(std::ostream& out, const StencilCalculus<TCalculus>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/StencilCalculus.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StencilCalculus_h
+
+#undef StencilCalculus_RECURSES
+#endif // else defined(StencilCalculus_RECURSES)
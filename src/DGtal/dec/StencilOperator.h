@@ -0,0 +1,451 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StencilOperator.h
+ * @author DGtal team
+ *
+ * @date 2016/11/28
+ *
+ * Header file for module StencilOperator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StencilOperator_RECURSES)
+#error Recursive header files inclusion detected in StencilOperator.h
+#else // defined(StencilOperator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StencilOperator_RECURSES
+
+#if !defined StencilOperator_h
+/** Prevents repeated inclusion of headers. */
+#define StencilOperator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TStencilCalculus>
+  class StencilMatrix;
+}
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// StencilMatrix behaves as the sparse matrices of its calculus.
+    template <typename TStencilCalculus>
+    struct traits< DGtal::StencilMatrix<TStencilCalculus> >
+      : public traits<typename TStencilCalculus::Calculus::SparseMatrix>
+    {};
+  }
+}
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StencilMatrix
+  /**
+   * Description of template class 'StencilMatrix' <p>
+   * \brief Aim:
+   * Matrix-free container of StencilOperator. It holds a sum of terms,
+   * each term being a scalar times a chain of derivatives and hodge
+   * operators, applied on the cell grid of a StencilCalculus.
+   *
+   * It models an Eigen matrix-free operator (only the product with
+   * a dense vector is available), so that it can be given to Eigen
+   * iterative solvers (see StencilOperator::SolverConjugateGradient and
+   * StencilOperator::SolverBiCGSTAB).
+   *
+   * @tparam TStencilCalculus should be StencilCalculus.
+   */
+  template <typename TStencilCalculus>
+  class StencilMatrix : public Eigen::EigenBase< StencilMatrix<TStencilCalculus> >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TStencilCalculus Stencil;
+    typedef typename Stencil::Calculus Calculus;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Scalar RealScalar;
+    typedef typename Calculus::SparseMatrix::StorageIndex StorageIndex;
+    typedef typename Calculus::Index Index;
+    typedef typename Stencil::GridVector GridVector;
+
+    enum
+    {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic,
+      IsRowMajor = false
+    };
+
+    /**
+     * Elementary step of a term.
+     */
+    struct Step
+    {
+      /// 'true' for a derivative, 'false' for a hodge operator.
+      bool derivative;
+      /// Primal dimension of the input cells.
+      Dimension dimension;
+      /// Duality of the input form.
+      Duality duality;
+    };
+
+    /**
+     * Term of the sum: coefficient times the steps, applied in order.
+     */
+    struct Term
+    {
+      Scalar coefficient;
+      std::vector<Step> steps;
+    };
+
+    typedef std::vector<Term> Terms;
+
+    /**
+     * Constructor. The matrix is null.
+     * @param stencil the stencil calculus to use.
+     * @param dim_in primal dimension of the input cells.
+     * @param dim_out primal dimension of the output cells.
+     */
+    StencilMatrix(ConstAlias<Stencil> stencil, const Dimension dim_in, const Dimension dim_out);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to const stencil calculus.
+     */
+    const Stencil* myStencil;
+
+    /**
+     * Primal dimension of the input cells.
+     */
+    Dimension myDimensionIn;
+
+    /**
+     * Primal dimension of the output cells.
+     */
+    Dimension myDimensionOut;
+
+    /**
+     * Terms of the sum.
+     */
+    Terms myTerms;
+
+    /**
+     * Grid vector of the dimensions read and written by the terms,
+     * reused by successive products (iterative solvers apply the same
+     * matrix many times). Hence concurrent products with the same
+     * matrix are not allowed, though each product is itself parallel.
+     */
+    mutable GridVector myGrid;
+
+    /// @return the number of rows (output form length).
+    Index rows() const;
+
+    /// @return the number of columns (input form length).
+    Index cols() const;
+
+    /**
+     * Matrix-free product with a dense vector.
+     * @param x right operand.
+     * @return the product expression, evaluated by applyTo.
+     */
+    template <typename TRhs>
+    Eigen::Product<StencilMatrix, TRhs, Eigen::AliasFreeProduct>
+    operator*(const Eigen::MatrixBase<TRhs>& x) const;
+
+    /**
+     * Computes y += alpha * this * x, column by column.
+     * @param x input dense vectors.
+     * @param y output dense vectors.
+     * @param alpha scaling factor.
+     */
+    template <typename TRhs, typename TDest>
+    void applyTo(const TRhs& x, TDest& y, const Scalar& alpha) const;
+
+    /**
+     * Multiplies all terms by a scalar.
+     * @param scalar factor.
+     */
+    void scale(const Scalar& scalar);
+
+    /**
+     * Appends the terms of another matrix with the same input and
+     * output dimensions.
+     * @param other the matrix to add.
+     * @param scalar factor applied to the terms of @a other.
+     */
+    void add(const StencilMatrix& other, const Scalar& scalar);
+
+    /**
+     * Composition.
+     * @param left operator applied after @a right.
+     * @param right operator applied first.
+     * @return left * right, whose terms are all products of terms.
+     */
+    static StencilMatrix compose(const StencilMatrix& left, const StencilMatrix& right);
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  }; // end of class StencilMatrix
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StencilOperator
+  /**
+   * Description of template class 'StencilOperator' <p>
+   * \brief Aim:
+   * StencilOperator is the matrix-free counterpart of LinearOperator:
+   * a linear operator between discrete kforms which is never assembled
+   * but applied as fixed stencils on the cell grid of a StencilCalculus.
+   *
+   * Stencil operators are created by StencilCalculus (derivative,
+   * hodge, antiderivative, laplace, identity) and combined with the
+   * same operators as LinearOperator (+, -, scalar and internal
+   * multiplication, application on KForm). Their container is a
+   * StencilMatrix, hence they can be given to
+   * DiscreteExteriorCalculusSolver with the iterative solvers
+   * SolverConjugateGradient and SolverBiCGSTAB defined below:
+   *
+   * @code
+   * typedef StencilCalculus<Calculus> Stencil;
+   * typedef Stencil::PrimalLaplace Laplace;
+   * typedef DiscreteExteriorCalculusSolver<Calculus, Laplace::SolverBiCGSTAB, 0, PRIMAL, 0, PRIMAL, Laplace> Solver;
+   * const Stencil stencil(calculus);
+   * const Laplace laplace = stencil.laplace<PRIMAL>();
+   * Solver solver;
+   * solver.compute(laplace); // laplace must outlive the solver
+   * @endcode
+   *
+   * @tparam TStencilCalculus should be StencilCalculus.
+   * @tparam order_in is the input order of the linear operator.
+   * @tparam duality_in is the input duality of the linear operator.
+   * @tparam order_out is the output order of the linear operator.
+   * @tparam duality_out is the output duality of the linear operator.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class StencilOperator
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TStencilCalculus Stencil;
+    typedef typename Stencil::Calculus Calculus;
+
+    BOOST_STATIC_ASSERT(( order_in >= 0 ));
+    BOOST_STATIC_ASSERT(( order_in <= Calculus::dimensionEmbedded ));
+    BOOST_STATIC_ASSERT(( order_out >= 0 ));
+    BOOST_STATIC_ASSERT(( order_out <= Calculus::dimensionEmbedded ));
+
+    ///Container type
+    typedef StencilMatrix<Stencil> Container;
+    ///Calculus scalar type
+    typedef typename Calculus::Scalar Scalar;
+    ///Input KForm type
+    typedef KForm<Calculus, order_in, duality_in> InputKForm;
+    ///Output KForm type
+    typedef KForm<Calculus, order_out, duality_out> OutputKForm;
+
+    ///Matrix-free conjugate gradient solver, for symmetric operators
+    typedef Eigen::ConjugateGradient<Container, Eigen::Lower|Eigen::Upper, Eigen::IdentityPreconditioner> SolverConjugateGradient;
+    ///Matrix-free biconjugate gradient stabilized solver
+    typedef Eigen::BiCGSTAB<Container, Eigen::IdentityPreconditioner> SolverBiCGSTAB;
+
+    /**
+     * Constructor. The operator is null.
+     * @param stencil the stencil calculus to use.
+     */
+    StencilOperator(ConstAlias<Stencil> stencil);
+
+    /**
+     * Constructor.
+     * @param stencil the stencil calculus to use.
+     * @param container the container to copy.
+     */
+    StencilOperator(ConstAlias<Stencil> stencil, const Container& container);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Container holding the terms of the operator.
+     */
+    Container myContainer;
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  }; // end of class StencilOperator
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StencilMatrix'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StencilMatrix' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TStencilCalculus>
+  std::ostream&
+  operator<<(std::ostream& out, const StencilMatrix<TStencilCalculus>& object);
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StencilOperator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StencilOperator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  std::ostream&
+  operator<<(std::ostream& out,
+             const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& object);
+
+  /**
+   * Overloads 'operator+' for adding objects of class 'StencilOperator'.
+   * @param operator_a left operant
+   * @param operator_b right operant
+   * @return operator_a + operator_b.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>
+  operator+(const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& operator_a,
+            const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& operator_b);
+
+  /**
+   * Overloads 'operator-' for substracting objects of class 'StencilOperator'.
+   * @param operator_a left operant
+   * @param operator_b right operant
+   * @return operator_a - operator_b.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>
+  operator-(const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& operator_a,
+            const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& operator_b);
+
+  /**
+   * Overloads 'operator*' for scalar multiplication of objects of class 'StencilOperator'.
+   * @param scalar left operant
+   * @param stencil_operator right operant
+   * @return scalar * stencil_operator.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>
+  operator*(const typename TStencilCalculus::Scalar& scalar,
+            const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& stencil_operator);
+
+  /**
+   * Overloads 'operator*' for internal multiplication of objects of class 'StencilOperator'.
+   * @param operator_left left operant
+   * @param operator_right right operant
+   * @return operator_left * operator_right.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_fold, Duality duality_fold, Order order_out, Duality duality_out>
+  StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>
+  operator*(const StencilOperator<TStencilCalculus, order_fold, duality_fold, order_out, duality_out>& operator_left,
+            const StencilOperator<TStencilCalculus, order_in, duality_in, order_fold, duality_fold>& operator_right);
+
+  /**
+   * Overloads 'operator*' for application of objects of class 'StencilOperator' on objects of class 'KForm'.
+   * @param stencil_operator left operant
+   * @param input_form right operant
+   * @return stencil_operator * input_form.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  KForm<typename TStencilCalculus::Calculus, order_out, duality_out>
+  operator*(const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& stencil_operator,
+            const KForm<typename TStencilCalculus::Calculus, order_in, duality_in>& input_form);
+
+  /**
+   * Overloads 'operator-' for unary additive inverse of objects of class 'StencilOperator'.
+   * @param stencil_operator operant
+   * @return -stencil_operator.
+   */
+  template <typename TStencilCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>
+  operator-(const StencilOperator<TStencilCalculus, order_in, duality_in, order_out, duality_out>& stencil_operator);
+
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// Product of a StencilMatrix with a dense vector.
+    template <typename TStencilCalculus, typename TRhs>
+    struct generic_product_impl<DGtal::StencilMatrix<TStencilCalculus>, TRhs, SparseShape, DenseShape, GemvProduct>
+      : generic_product_impl_base< DGtal::StencilMatrix<TStencilCalculus>, TRhs,
+                                   generic_product_impl<DGtal::StencilMatrix<TStencilCalculus>, TRhs> >
+    {
+      typedef typename Product<DGtal::StencilMatrix<TStencilCalculus>, TRhs>::Scalar Scalar;
+
+      template <typename TDest>
+      static void scaleAndAddTo(TDest& dst, const DGtal::StencilMatrix<TStencilCalculus>& lhs,
+                                const TRhs& rhs, const Scalar& alpha)
+      {
+        lhs.applyTo(rhs, dst, alpha);
+      }
+    };
+  }
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/StencilOperator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StencilOperator_h
+
+#undef StencilOperator_RECURSES
+#endif // else defined(StencilOperator_RECURSES)
@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/ClosedFormEigenDecomposition.h"
 //////////////////////////////////////////////////////////////////////////////
 
 // @since 0.8 In DGtal::functors
@@ -58,19 +59,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     class IINormalDirectionFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IINormalDirectionFunctor<TSpace> Self;
+      typedef IINormalDirectionFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef RealVector Quantity;
       typedef Quantity Value;
@@ -95,8 +100,7 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
 #ifdef DEBUG
@@ -132,19 +136,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     class IITangentDirectionFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IITangentDirectionFunctor<TSpace> Self;
+      typedef IITangentDirectionFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef RealVector Quantity;
       typedef Quantity Value;
@@ -170,8 +178,7 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
 #ifdef DEBUG
@@ -205,19 +212,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     class IIFirstPrincipalDirectionFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IIFirstPrincipalDirectionFunctor<TSpace> Self;
+      typedef IIFirstPrincipalDirectionFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef RealVector Quantity;
       typedef Quantity Value;
@@ -243,8 +254,7 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
 #ifdef DEBUG
@@ -284,19 +294,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     class IISecondPrincipalDirectionFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IISecondPrincipalDirectionFunctor<TSpace> Self;
+      typedef IISecondPrincipalDirectionFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef RealVector Quantity;
       typedef Quantity Value;
@@ -322,8 +336,7 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
 #ifdef DEBUG
@@ -362,19 +375,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     class IIPrincipalDirectionsFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IIPrincipalDirectionsFunctor<TSpace> Self;
+      typedef IIPrincipalDirectionsFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef std::pair<RealVector,RealVector> Quantity;
       typedef Quantity Value;
@@ -400,8 +417,7 @@ namespace DGtal {
       */
       Value operator()( const Argument& arg ) const
       {
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
 #ifdef DEBUG
@@ -566,19 +582,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     struct IIGaussianCurvature3DFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IIGaussianCurvature3DFunctor<TSpace> Self;
+      typedef IIGaussianCurvature3DFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef Component Quantity;
       typedef Quantity Value;
@@ -598,8 +618,7 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
         ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1])) 
@@ -649,19 +668,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     struct IIFirstPrincipalCurvature3DFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IIFirstPrincipalCurvature3DFunctor<TSpace> Self;
+      typedef IIFirstPrincipalCurvature3DFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef Component Quantity;
       typedef Quantity Value;
@@ -681,8 +704,7 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
         ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1])) 
@@ -731,19 +753,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     struct IISecondPrincipalCurvature3DFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IISecondPrincipalCurvature3DFunctor<TSpace> Self;
+      typedef IISecondPrincipalCurvature3DFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef Component Quantity;
       typedef Quantity Value;
@@ -763,8 +789,7 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
         ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1])) 
@@ -812,19 +837,23 @@ namespace DGtal {
     *
     * @tparam TSpace a model of CSpace, for instance SpaceND.
     * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+    * @tparam TLinearAlgebraTool the eigen solver, EigenDecomposition by
+    * default, or ClosedFormEigenDecomposition in 2D and 3D.
     *
     * @see IntegralInvariantCovarianceEstimator
     */
-    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension> >
+    template  <typename TSpace, typename TMatrix=SimpleMatrix< typename TSpace::RealVector::Component, TSpace::dimension, TSpace::dimension>,
+               typename TLinearAlgebraTool=EigenDecomposition< TSpace::dimension, typename TSpace::RealVector::Component, TMatrix > >
     struct IIPrincipalCurvatures3DFunctor
     {
       // ----------------------- Standard services ------------------------------
     public:
-      typedef IIPrincipalCurvatures3DFunctor<TSpace> Self;
+      typedef IIPrincipalCurvatures3DFunctor<TSpace, TMatrix, TLinearAlgebraTool> Self;
       typedef TSpace Space;
       typedef typename Space::RealVector RealVector;
       typedef typename RealVector::Component Component;
       typedef TMatrix Matrix;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef Matrix Argument;
       typedef std::pair<Component, Component> Quantity;
       typedef Quantity Value;
@@ -845,8 +874,7 @@ namespace DGtal {
       {
         Argument cp_arg = arg;
         cp_arg *= dh5;
-        EigenDecomposition<Space::dimension, Component, Matrix>
-          ::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
+        LinearAlgebraTool::getEigenDecomposition( cp_arg, eigenVectors, eigenValues );
 
         ASSERT ( !std::isnan(eigenValues[0]) ); // NaN
         ASSERT ( (std::abs(eigenValues[0]) <= std::abs(eigenValues[1])) 
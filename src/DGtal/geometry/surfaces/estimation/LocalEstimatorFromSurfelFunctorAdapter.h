@@ -51,6 +51,7 @@
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/topology/SurfelNeighborhoodIndex.h"
 #include "DGtal/geometry/volumes/distance/CMetricSpace.h"
 #include "DGtal/base/BasicFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/estimationFunctors/CLocalEstimatorFromSurfelFunctor.h"
@@ -92,6 +93,23 @@ namespace DGtal
    * function in the ambient space (not a geodesic one for instance) on
    * canonical embedding of surfel elements (cf CanonicSCellEmbedder).
    *
+   * The neighborhoods are gathered with a SurfelNeighborhoodIndex of
+   * the surface, built by init() unless one is given with
+   * setNeighborhoodIndex(). They are visited in the same order as a
+   * DistanceBreadthFirstVisitor would, but without allocating a visitor
+   * per surfel. Several adapters using the same metric, embedding and
+   * radius (e.g. Monge jet fitting, sphere fitting and spherical Hough
+   * estimators) may share an index whose cache is enabled at this
+   * radius (see SurfelNeighborhoodIndex::enableCache), so that each
+   * neighborhood is gathered only once.
+   *
+   * Although eval() is const, it is not thread-safe: it feeds the
+   * surfel functor and gathers with a workspace owned by the adapter
+   * (or, when the cache of the index is enabled at this radius, fills
+   * the cache of the shared index). Use one adapter (and functor) per
+   * thread, and do not enable the cache of an index shared between
+   * threads.
+   *
    *  @tparam TDigitalSurfaceContainer any model of digital surface container concept (CDigitalSurfaceContainer)
    *  @tparam TMetric any model of CMetricSpace to be used in the neighborhood construction.
    *  @tparam TFunctorOnSurfel an estimator on surfel set (model of CLocalEstimatorFromSurfelFunctor)
@@ -137,16 +155,32 @@ namespace DGtal
 
     ///Surfel type
     typedef typename DigitalSurfaceContainer::Surfel Surfel;
-    
+
+    ///Index of surfels and of their adjacency, used for gathering neighborhoods
+    typedef SurfelNeighborhoodIndex< DigitalSurfaceContainer, Value > NeighborhoodIndex;
     
   private:
 
     ///Embedded and type definitions
     typedef typename FunctorOnSurfel::SCellEmbedder Embedder;
-    typedef std::function< typename Metric::Value ( typename Metric::Point ) > MetricToPoint;
-    typedef functors::Composer<Embedder, MetricToPoint, Value> VertexFunctor;
-    typedef DistanceBreadthFirstVisitor< Surface, 
-                                         VertexFunctor> Visitor;
+    typedef typename Metric::Point MetricPoint;
+    typedef typename NeighborhoodIndex::Index Index;
+
+    /// Distance from an indexed surfel to a center, given their
+    /// embeddings.
+    struct IndexDistance
+    {
+      IndexDistance( const Metric & aMetric, const std::vector<MetricPoint> & points,
+                     const MetricPoint & center )
+        : myMetric( &aMetric ), myPoints( &points ), myCenter( center ) {}
+      Value operator()( Index i ) const
+      {
+        return myMetric->operator()( myCenter, (*myPoints)[ i ] );
+      }
+      const Metric * myMetric;
+      const std::vector<MetricPoint> * myPoints;
+      MetricPoint myCenter;
+    };
 
 
   public:
@@ -181,7 +215,8 @@ namespace DGtal
      */
     LocalEstimatorFromSurfelFunctorAdapter ( const LocalEstimatorFromSurfelFunctorAdapter & other ):
       mySurface(other.mySurface), myFunctor(other.myFunctor), myMetric(other.myMetric),
-      myEmbedder(other.myEmbedder), myConvFunctor(other.myConvFunctor)
+      myEmbedder(other.myEmbedder), myConvFunctor(other.myConvFunctor),
+      myIndex(other.myIndex), myPoints(other.myPoints)
     {  }
     
 
@@ -198,6 +233,8 @@ namespace DGtal
       myMetric = other.myMetric;
       myEmbedder = other.myEmbedder;
       myConvFunctor = other.myConvFunctor;
+      myIndex = other.myIndex;
+      myPoints = other.myPoints;
       return *this;
     }
     
@@ -243,6 +280,22 @@ namespace DGtal
                     ConstAlias<ConvolutionFunctor> aConvolutionFunctor,
                     const Value radius);
 
+    /**
+     * Sets the index used for gathering neighborhoods, e.g. to share
+     * it (and its cache) between several estimators. Otherwise, init()
+     * builds its own index. The object is then invalid until init()
+     * is called.
+     *
+     * @param anIndex an index of the attached surface, aliased in this.
+     */
+    void setNeighborhoodIndex( ConstAlias<NeighborhoodIndex> anIndex );
+
+    /**
+     * @return the index used for gathering neighborhoods.
+     * @pre must be called after init
+     */
+    const NeighborhoodIndex & neighborhoodIndex() const;
+
     /**
      * Initialisation of estimator parameters.
      *
@@ -257,6 +310,7 @@ namespace DGtal
     /**
      * @return the estimated quantity at *it
      * @param [in] it the surfel iterator at which we evaluate the quantity.
+     * @note Not thread-safe (see the class description).
      */
     template< typename SurfelConstIterator>
     Quantity eval(const SurfelConstIterator& it) const;
@@ -318,6 +372,16 @@ namespace DGtal
     ///Ball radius
     Value myRadius;
 
+    ///Index of the surfels of the surface and of their adjacency
+    CountedConstPtrOrConstPtr<NeighborhoodIndex> myIndex;
+
+    ///Embedding of each indexed surfel
+    std::vector<MetricPoint> myPoints;
+
+    ///Work buffers of the gathers, so that adapters sharing an index
+    ///do not share them
+    mutable typename NeighborhoodIndex::Workspace myWorkspace;
+
   }; // end of class LocalEstimatorFromSurfelFunctorAdapter
 
   /**
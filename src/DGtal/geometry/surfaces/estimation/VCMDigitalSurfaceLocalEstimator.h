@@ -91,9 +91,10 @@ namespace DGtal
     typedef TSeparableMetric                          Metric; ///< the chosen metric
     typedef TKernelFunction                   KernelFunction; ///< the kernel function
     typedef TVCMGeometricFunctor         VCMGeometricFunctor; ///< the geometric functor (normal, principal directions)
-    /// the type of computing the Voronoi covariance measure on a digital surface.
-    typedef VoronoiCovarianceMeasureOnDigitalSurface<DigitalSurfaceContainer, Metric, KernelFunction>
-    VCMOnSurface;
+    /// the type of computing the Voronoi covariance measure on a
+    /// digital surface, as chosen by the geometric functor (which
+    /// also selects its eigen solver).
+    typedef typename VCMGeometricFunctor::VCMOnDigitalSurface VCMOnSurface;
     typedef typename VCMOnSurface::Surface           Surface; ///< the digital surface
 
     // ----------------------- model of CDigitalSurfaceLocalEstimator ----------------
@@ -45,6 +45,7 @@
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/ClosedFormEigenDecomposition.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
@@ -80,9 +81,14 @@ namespace DGtal
    *
    * @tparam TKernelFunction the type of the kernel function chi_r used
    * for integrating the VCM, a map: Point -> Scalar.
+   *
+   * @tparam TLinearAlgebraTool the eigen solver used for diagonalizing
+   * the VCM, EigenDecomposition by default, or
+   * ClosedFormEigenDecomposition in 2D and 3D.
    */
   template <typename TDigitalSurfaceContainer, typename TSeparableMetric,
-            typename TKernelFunction>
+            typename TKernelFunction,
+            typename TLinearAlgebraTool = EigenDecomposition< TDigitalSurfaceContainer::KSpace::dimension, double > >
   class VoronoiCovarianceMeasureOnDigitalSurface
   {
     BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer< TDigitalSurfaceContainer > ));
@@ -101,7 +107,7 @@ namespace DGtal
     typedef VoronoiCovarianceMeasure<Space,Metric>      VCM;  ///< the Voronoi Covariance Measure
     typedef typename VCM::Scalar                     Scalar;  ///< the "real number" type
     typedef typename Surface::ConstIterator   ConstIterator;  ///< the iterator for traversing the surface
-    typedef EigenDecomposition<KSpace::dimension,Scalar> LinearAlgebraTool;  ///< diagonalizer (nD).
+    typedef TLinearAlgebraTool            LinearAlgebraTool;  ///< diagonalizer (nD).
     typedef typename VCM::VectorN                   VectorN;  ///< n-dimensional R-vector
     typedef typename VCM::MatrixNN                 MatrixNN;  ///< nxn R-matrix
 
@@ -289,10 +295,10 @@ namespace DGtal
    * @param object the object of class 'VoronoiCovarianceMeasureOnDigitalSurface' to write.
    * @return the output stream after the writing.
    */
-  template <typename TDigitalSurfaceContainer, typename TSeparableMetric, typename TKernelFunction>
+  template <typename TDigitalSurfaceContainer, typename TSeparableMetric, typename TKernelFunction, typename TLinearAlgebraTool>
   std::ostream&
   operator<< ( std::ostream & out, 
-               const VoronoiCovarianceMeasureOnDigitalSurface<TDigitalSurfaceContainer, TSeparableMetric, TKernelFunction> & object );
+               const VoronoiCovarianceMeasureOnDigitalSurface<TDigitalSurfaceContainer, TSeparableMetric, TKernelFunction, TLinearAlgebraTool> & object );
 
 } // namespace DGtal
 
@@ -49,6 +49,7 @@
 #include <vector>
 #include "DGtal/math/linalg/SimpleMatrix.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/ClosedFormEigenDecomposition.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -76,14 +77,18 @@ namespace DGtal
      *
      * @tparam TSurfel type of surfels
      * @tparam TEmbedder type of functors which embed surfel to @f$ \mathbb{R}^3@f$
+     * @tparam TLinearAlgebraTool the 3x3 eigen solver,
+     * EigenDecomposition by default, or ClosedFormEigenDecomposition.
      */
-    template <typename TSurfel, typename TEmbedder>
+    template <typename TSurfel, typename TEmbedder,
+              typename TLinearAlgebraTool = EigenDecomposition<3, double> >
     class TensorVotingFeatureExtraction
     {
     public:
 
       typedef TSurfel Surfel;
       typedef TEmbedder SCellEmbedder;
+      typedef TLinearAlgebraTool LinearAlgebraTool;
       typedef typename SCellEmbedder::RealPoint RealPoint;
       typedef double Quantity;
 
@@ -157,7 +162,7 @@ namespace DGtal
         RealPoint eigenvalues;
 
         myAccum /= myArea;
-        EigenDecomposition<3, double>::getEigenDecomposition( myAccum, eigenvectors, eigenvalues);
+        LinearAlgebraTool::getEigenDecomposition( myAccum, eigenvectors, eigenvalues);
   
 #ifdef DEBUG
         for( Dimension i_dim = 1; i_dim < 3; ++i_dim )
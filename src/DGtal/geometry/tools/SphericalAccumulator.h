@@ -83,6 +83,18 @@ namespace DGtal
    * the representative direction for each bin and the bin with
    * maximal number of samples.
    *
+   * Large sets of directions (e.g. normal vectors estimated on a
+   * digital surface) can be inserted at once using addDirections(). If
+   * DGtal has been built with OpenMP support, directions are binned in
+   * parallel into per-thread partial accumulators which are then
+   * merged. Two accumulators sharing the same decomposition can also
+   * be merged using merge().
+   *
+   * Bin coordinates of a direction are obtained without any
+   * trigonometric function call: spherical angles are replaced by
+   * monotonic pseudo-angles, and the bin boundaries are located in
+   * constant time using lookup tables precomputed at construction.
+   *
    * Furthermore, you can send the accumulator to a Viewer3D to see
    * the bin geometry and values:
    * @code
@@ -148,6 +160,35 @@ namespace DGtal
      */
     void addDirection(const Vector &aDir);
 
+    /**
+     * Add a range of directions into the accumulator. The result is
+     * the same as calling addDirection() on each element of the range
+     * (up to the summation order of representative directions).
+     *
+     * If DGtal has been built with OpenMP support (WITH_OPENMP flag
+     * set to "true"), the range is split among threads, each thread
+     * fills its own partial bins and partial bins are merged at the
+     * end.
+     *
+     * @tparam TConstIterator random access iterator on directions.
+     * @param itb an iterator on the first direction.
+     * @param ite an iterator after the last direction.
+     */
+    template <typename TConstIterator>
+    void addDirections(const TConstIterator &itb,
+                       const TConstIterator &ite);
+
+    /**
+     * Merge an other accumulator into this one: bin counts, number
+     * of samples and representative directions are summed, and the
+     * maximal bin is updated.
+     *
+     * @pre @a other must have been constructed with the same number
+     * of slices.
+     * @param other the accumulator to merge into this one.
+     */
+    void merge(const SphericalAccumulator &other);
+
     /**
      * Given a normalized direction, this method computes the bin
      * coordinates.
@@ -345,6 +386,12 @@ namespace DGtal
       myBinNumber = other.myBinNumber;
       myMaxBinPhi = other.myMaxBinPhi;
       myMaxBinTheta = other.myMaxBinTheta;
+      myNthetaPerSlice = other.myNthetaPerSlice;
+      myPhiThresholds = other.myPhiThresholds;
+      myPhiBuckets = other.myPhiBuckets;
+      myThetaThresholds = other.myThetaThresholds;
+      myThetaBuckets = other.myThetaBuckets;
+      myThetaOffsets = other.myThetaOffsets;
     }
 
     /**
@@ -355,7 +402,7 @@ namespace DGtal
      */
     SphericalAccumulator & operator= ( const SphericalAccumulator & other )
     {
-      if (this!=other)
+      if (this != &other)
       {
         myNphi = other.myNphi;
         myNtheta = other.myNtheta;
@@ -364,7 +411,13 @@ namespace DGtal
         myTotal = other.myTotal;
         myBinNumber = other.myBinNumber;
         myMaxBinPhi = other.myMaxBinPhi;
-        myMaxBinTheta = other.myMaxBinTheta; 
+        myMaxBinTheta = other.myMaxBinTheta;
+        myNthetaPerSlice = other.myNthetaPerSlice;
+        myPhiThresholds = other.myPhiThresholds;
+        myPhiBuckets = other.myPhiBuckets;
+        myThetaThresholds = other.myThetaThresholds;
+        myThetaBuckets = other.myThetaBuckets;
+        myThetaOffsets = other.myThetaOffsets;
       }
       return *this;
     }
@@ -398,6 +451,25 @@ namespace DGtal
     ///Theta coordinate of the max bin
     Size myMaxBinTheta;
 
+    ///Number of valid bins in each phi slice
+    std::vector<Size> myNthetaPerSlice;
+
+    ///Pseudo-angles of the boundaries between consecutive phi slices
+    std::vector<double> myPhiThresholds;
+
+    ///First candidate phi slice for each pseudo-angle bucket
+    std::vector<Size> myPhiBuckets;
+
+    ///Pseudo-angles of the boundaries between theta bins (all slices)
+    std::vector<double> myThetaThresholds;
+
+    ///First candidate theta bin for each pseudo-angle bucket (all slices)
+    std::vector<Size> myThetaBuckets;
+
+    ///Offset of each slice in myThetaThresholds (twice this offset
+    ///in myThetaBuckets)
+    std::vector<Size> myThetaOffsets;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -413,6 +485,70 @@ namespace DGtal
         // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes the tables used to map directions to bins.
+     */
+    void initLookupTables();
+
+    /**
+     * Computes a pseudo-angle of the 2D vector (x,y), i.e. a value in
+     * [0,4) which increases monotonically with the polar angle of
+     * (x,y) in [0, 2pi) (diamond angle).
+     *
+     * @param x first coordinate.
+     * @param y second coordinate.
+     * @return the pseudo-angle of (x,y) (0 for the null vector).
+     */
+    static double pseudoAngle(const double x, const double y);
+
+    /**
+     * Given a sorted array of pseudo-angle thresholds and its bucket
+     * lookup table, returns the number of thresholds lower or equal
+     * to @a p.
+     *
+     * @param p a pseudo-angle in [0, @a range].
+     * @param range the range of pseudo-angles.
+     * @param thresholds pointer to the sorted thresholds.
+     * @param nbThresholds number of thresholds.
+     * @param buckets pointer to the bucket table.
+     * @param nbBuckets number of buckets.
+     * @return the number of thresholds lower or equal to @a p.
+     */
+    static Size lookup(const double p, const double range,
+                       const double *thresholds, const Size nbThresholds,
+                       const Size *buckets, const Size nbBuckets);
+
+    /**
+     * Fills a bucket lookup table for sorted thresholds.
+     *
+     * @param range the range of pseudo-angles.
+     * @param thresholds pointer to the sorted thresholds.
+     * @param nbThresholds number of thresholds.
+     * @param buckets pointer to the bucket table to fill.
+     * @param nbBuckets number of buckets.
+     */
+    static void fillBuckets(const double range,
+                            const double *thresholds, const Size nbThresholds,
+                            Size *buckets, const Size nbBuckets);
+
+    /**
+     * @param aDir a (non null) direction.
+     * @return the index in myAccumulator of the bin containing @a aDir.
+     */
+    Size binIndex(const Vector &aDir) const;
+
+    /**
+     * Adds partial bin counts and directions to the accumulator and
+     * updates the maximal bin.
+     *
+     * @param counts partial bin counts (same layout as myAccumulator).
+     * @param dirs partial bin directions.
+     * @param total number of samples in the partial bins.
+     */
+    void mergeBins(const std::vector<Quantity> &counts,
+                   const std::vector<Vector> &dirs,
+                   const Quantity total);
+
   }; // end of class SphericalAccumulator
 
 
@@ -90,6 +90,13 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * The 1D problems of each step are processed by blocks of
+   * LineBlockSize consecutive lines, the lines of a block being
+   * neighbors along the first axis (for steps along other axes) so
+   * that they share cache lines. Blocks are processed in parallel
+   * when OpenMP is enabled, each with its own site buffers. The
+   * result does not depend on the processing order.
+   *
    * This class is a model of concepts::CConstImage.
    *
    * @see &nbsp; \ref toricVol
@@ -158,6 +165,9 @@ namespace DGtal
     /// Periodicity specification type.
     typedef std::array< bool, Space::dimension > PeriodicitySpec;
 
+    /// Number of consecutive 1D problems processed as a single task.
+    static const std::size_t LineBlockSize = 16;
+
     /**
      * Constructor.
      *
@@ -339,9 +349,31 @@ namespace DGtal
      *
      * @param row starting point of the 1D process.
      * @param dim dimension of the update.
+     * @param Sites a buffer for the sites (cleared by the method).
+     * @param boundedSites a buffer for the sites projected into the
+     * domain (cleared by the method).
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             std::vector<Point> & Sites,
+                             std::vector<Point> & boundedSites) const;
+
+    /**
+     * @param dim a dimension.
+     * @return the number of 1D problems along dimension @a dim,
+     * i.e. the number of lines of the domain parallel to axis @a dim.
+     */
+    std::size_t nbLines( const Dimension dim ) const;
+
+    /**
+     * Lines parallel to axis @a dim are numbered with the first
+     * other axis varying fastest.
+     *
+     * @param aLine the index of a line, less than nbLines( @a dim ).
+     * @param dim a dimension.
+     * @return the starting point (lowest coordinate along @a dim) of the line.
+     */
+    Point lineStartingPoint( std::size_t aLine, const Dimension dim ) const;
 
     /**
      * Project point coordinates into the domain, taking into account
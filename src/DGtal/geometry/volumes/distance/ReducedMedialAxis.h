@@ -45,6 +45,9 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
@@ -85,6 +88,12 @@ namespace DGtal
    * @note Following ReverseDistanceTransformation, the input shape is
    * defined as points with negative power distance.
    *
+   * The medial axis may also be extracted as a compact list of balls
+   * (pairs of center and weight) with
+   * getReducedMedialAxisBallsFromPowerMap(), which scans the rows of
+   * the power map in parallel (with OpenMP). Such a list can be given
+   * to ReverseDistanceTransformationBySlabs to reconstruct the shape.
+   *
    * @tparam TPowerMap any specialized PowerMap type @tparam
    * TImageContainer any model of CImage to store the medial axis
    * points (default: ImageContainerBySTLVector).
@@ -99,6 +108,17 @@ namespace DGtal
     //MA Container
     typedef Image<TImageContainer> Type;
 
+    typedef typename TPowerMap::Point Point;
+    typedef typename TPowerMap::Weight Weight;
+
+    /// A medial axis ball: its center and its weight.
+    typedef std::pair<Point, Weight> Ball;
+    /// A list of medial axis balls.
+    typedef std::vector<Ball> BallList;
+
+    /// Number of consecutive rows scanned as a single task.
+    static const std::size_t RowBlockSize = 16;
+
     /**
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$.
@@ -113,19 +133,102 @@ namespace DGtal
     {
       TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
 
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(),
-             itend = aPowerMap.domain().end(); it != itend; ++it)
-        {
-          const auto v  = aPowerMap( *it );
-          const auto pv = aPowerMap.projectPoint( v );
+      const BallList balls = getReducedMedialAxisBallsFromPowerMap( aPowerMap );
+      for ( typename BallList::const_iterator it = balls.begin(), itend = balls.end();
+            it != itend; ++it )
+        computedMA->setValue( it->first, it->second );
 
-          if ( aPowerMap.metricPtr()->powerDistance( *it, v, aPowerMap.weightImagePtr()->operator()( pv ) )
-                      < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            computedMA->setValue( v, aPowerMap.weightImagePtr()->operator()( pv ) );
+      return Type( computedMA );
+    }
+
+    /**
+     * Extract reduced medial axis from a power map, as a list of
+     * balls sorted by centers (lexicographic order), each center
+     * appearing once. Rows of the power map are scanned in parallel.
+     * This methods is in @f$ O(|powerMap|)@f$.
+     *
+     * @param aPowerMap the input powerMap
+     *
+     * @return the list of medial axis balls.
+     */
+    static
+    BallList getReducedMedialAxisBallsFromPowerMap(const TPowerMap &aPowerMap)
+    {
+      typedef typename TPowerMap::PowerSeparableMetric::Value Value;
+      const Dimension dimension = TPowerMap::Space::dimension;
+      BallList balls;
+      if ( aPowerMap.domain().isEmpty() )
+        return balls;
+
+      const Point lower  = aPowerMap.domain().lowerBound();
+      const Point upper  = aPowerMap.domain().upperBound();
+      const Point extent = upper - lower + Point::diagonal( 1 );
+      std::size_t rows = 1;
+      for ( Dimension k = 1; k < dimension; ++k )
+        rows *= static_cast<std::size_t>( extent[ k ] );
+      const std::size_t nbBlocks = ( rows + RowBlockSize - 1 ) / RowBlockSize;
+
+      //Balls found in each block of rows.
+      std::vector<BallList> blockBalls( nbBlocks );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for ( std::ptrdiff_t b = 0; b < static_cast<std::ptrdiff_t>( nbBlocks ); ++b )
+        {
+          const std::size_t first = static_cast<std::size_t>( b ) * RowBlockSize;
+          const std::size_t last  = std::min( rows, first + RowBlockSize );
+          for ( std::size_t r = first; r < last; ++r )
+            {
+              Point pt = lower;
+              std::size_t rem = r;
+              for ( Dimension k = 1; k < dimension; ++k )
+                {
+                  pt[ k ] += static_cast<typename Point::Coordinate>( rem % extent[ k ] );
+                  rem /= extent[ k ];
+                }
+              for ( ; pt[ 0 ] <= upper[ 0 ]; ++pt[ 0 ] )
+                {
+                  const Point v  = aPowerMap( pt );
+                  const Point pv = aPowerMap.projectPoint( v );
+                  const Weight w = aPowerMap.weightImagePtr()->operator()( pv );
+                  if ( aPowerMap.metricPtr()->powerDistance( pt, v, w ) < NumberTraits<Value>::ZERO
+                       && ( blockBalls[ b ].empty() || blockBalls[ b ].back().first != v ) )
+                    blockBalls[ b ].push_back( Ball( v, w ) );
+                }
+            }
         }
 
-      return Type( computedMA );
+      std::size_t size = 0;
+      for ( std::size_t b = 0; b < nbBlocks; ++b )
+        size += blockBalls[ b ].size();
+      balls.reserve( size );
+      for ( std::size_t b = 0; b < nbBlocks; ++b )
+        balls.insert( balls.end(), blockBalls[ b ].begin(), blockBalls[ b ].end() );
+
+      //A center may be found from several points.
+      std::sort( balls.begin(), balls.end(), CenterLess() );
+      balls.erase( std::unique( balls.begin(), balls.end(), CenterEqual() ), balls.end() );
+      return balls;
     }
+
+  private:
+    /// Compares balls by centers.
+    struct CenterLess
+    {
+      bool operator()( const Ball & a, const Ball & b ) const
+      {
+        return a.first < b.first;
+      }
+    };
+
+    /// Tells if balls have the same center.
+    struct CenterEqual
+    {
+      bool operator()( const Ball & a, const Ball & b ) const
+      {
+        return a.first == b.first;
+      }
+    };
   }; // end of class ReducedMedialAxis
 
 
@@ -0,0 +1,227 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ReverseDistanceTransformationBySlabs.h
+ * @author DGtal team
+ *
+ * @date 2016/11/18
+ *
+ * Header file for template class ReverseDistanceTransformationBySlabs
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testReverseDistanceTransformationBySlabs.cpp
+ */
+
+#if defined(ReverseDistanceTransformationBySlabs_RECURSES)
+#error Recursive header files inclusion detected in ReverseDistanceTransformationBySlabs.h
+#else // defined(ReverseDistanceTransformationBySlabs_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ReverseDistanceTransformationBySlabs_RECURSES
+
+#if !defined ReverseDistanceTransformationBySlabs_h
+/** Prevents repeated inclusion of headers. */
+#define ReverseDistanceTransformationBySlabs_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/PowerMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ReverseDistanceTransformationBySlabs
+  /**
+   * Description of template class 'ReverseDistanceTransformationBySlabs' <p>
+   * \brief Aim: Reconstruction of a shape from a list of weighted
+   * points (balls), e.g. the ones given by
+   * ReducedMedialAxis::getReducedMedialAxisBallsFromPowerMap, slab by
+   * slab along the last axis of the domain.
+   *
+   * As for ReverseDistanceTransformation, a point belongs to the
+   * reconstructed shape if its power distance to some ball is
+   * negative. Here, the domain is cut into slabs of a given
+   * thickness along the last axis. For each slab, only the balls
+   * intersecting it are considered, and a PowerMap is computed on the
+   * slab extended to their centers. Hence, the memory only depends on
+   * the slab thickness and on the size of the balls, not on the
+   * whole domain extent, and points are output slab after slab, in
+   * the domain order.
+   *
+   * The domain is considered non-periodic and ball centers must lie
+   * in the domain.
+   *
+   * @code
+   * typedef ReducedMedialAxis< PowerMap<DTImage, Z3i::L2PowerMetric> > RDMA;
+   * const RDMA::BallList balls = RDMA::getReducedMedialAxisBallsFromPowerMap( power );
+   * ReverseDistanceTransformationBySlabs<Z3i::L2PowerMetric> rdt( domain, l2power, 32 );
+   * std::vector<Z3i::Point> shape;
+   * rdt.reconstruct( balls.begin(), balls.end(), std::back_inserter( shape ) );
+   * @endcode
+   *
+   * @tparam TPSeparableMetric model of concepts::CPowerSeparableMetric.
+   * @tparam TWeight the type of ball weights.
+   */
+  template < typename TPSeparableMetric,
+             typename TWeight = typename TPSeparableMetric::Weight >
+  class ReverseDistanceTransformationBySlabs
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CPowerSeparableMetric<TPSeparableMetric> ));
+
+    ///Separable Metric type
+    typedef TPSeparableMetric PowerSeparableMetric;
+    typedef typename PowerSeparableMetric::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Point::Coordinate Abscissa;
+    typedef HyperRectDomain<Space> Domain;
+    typedef TWeight Weight;
+    typedef typename PowerSeparableMetric::Value Value;
+
+    /// A ball: its center and its weight.
+    typedef std::pair<Point, Weight> Ball;
+
+    /// The weight image of a slab.
+    typedef ImageContainerBySTLVector<Domain, Weight> WeightImage;
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the domain of the reconstruction (aliased).
+     * @param aMetric a power separable metric instance (aliased).
+     * @param aSlabThickness the number of hyperplanes of a slab
+     * (along the last axis), at least 1.
+     */
+    ReverseDistanceTransformationBySlabs( ConstAlias<Domain> aDomain,
+                                          ConstAlias<PowerSeparableMetric> aMetric,
+                                          Abscissa aSlabThickness = 32 );
+
+    /**
+     * Default destructor
+     */
+    ~ReverseDistanceTransformationBySlabs() = default;
+
+    /**
+     * @return the domain of the reconstruction.
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * @return the number of hyperplanes of a slab.
+     */
+    Abscissa slabThickness() const
+    {
+      return mySlabThickness;
+    }
+
+    /**
+     * Reconstructs the shape defined by a list of balls: outputs, slab
+     * by slab and in the domain order, the points of the domain with
+     * negative power distance to some ball.
+     *
+     * @tparam TBallIterator a forward iterator on Ball.
+     * @tparam TOutputIterator an output iterator on Point.
+     *
+     * @param itb an iterator on the first ball.
+     * @param ite an iterator past the last ball.
+     * @param out an output iterator receiving the points of the shape.
+     * @return the output iterator after the last point.
+     */
+    template <typename TBallIterator, typename TOutputIterator>
+    TOutputIterator reconstruct( TBallIterator itb, TBallIterator ite,
+                                 TOutputIterator out ) const;
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * @param aBall a ball whose center is in the domain.
+     * @return the range of coordinates along the last axis of the
+     * points of the domain in the ball (empty if lower > upper).
+     */
+    std::pair<Abscissa, Abscissa> extentAlongLastAxis( const Ball & aBall ) const;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the reconstruction domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the separable metric instance
+    const PowerSeparableMetric * myMetricPtr;
+
+    ///Number of hyperplanes of a slab
+    Abscissa mySlabThickness;
+
+  }; // end of class ReverseDistanceTransformationBySlabs
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ReverseDistanceTransformationBySlabs'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ReverseDistanceTransformationBySlabs' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSep, typename TWeight>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ReverseDistanceTransformationBySlabs<TSep, TWeight> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformationBySlabs.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ReverseDistanceTransformationBySlabs_h
+
+#undef ReverseDistanceTransformationBySlabs_RECURSES
+#endif // else defined(ReverseDistanceTransformationBySlabs_RECURSES)
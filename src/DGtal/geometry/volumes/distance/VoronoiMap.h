@@ -100,7 +100,9 @@ namespace DGtal
    * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
    * to "true"), the computation is done in parallel (multithreaded)
    * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * @f$ O(h.d.n^d / p)@f$. The point predicate and the metric are
+   * then called from several threads at once, so they must be
+   * thread-safe (e.g. no lazily filled cache without locking).
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -201,7 +203,7 @@ namespace DGtal
      * which the computation is performed.
      *
      * @param predicate a pointer to the point predicate to define the
-     * Voronoi sites (false points).
+     * Voronoi sites (false points), thread-safe with OpenMP.
      *
      * @param aMetric a pointer to the separable metric instance.
      */
@@ -225,7 +227,7 @@ namespace DGtal
      * which the computation is performed.
      *
      * @param predicate a pointer to the point predicate to define the
-     * Voronoi sites (false points).
+     * Voronoi sites (false points), thread-safe with OpenMP.
      *
      * @param aMetric a pointer to the separable metric instance.
      *
@@ -0,0 +1,438 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BitmapMarkSet.h
+ * @author DGtal team
+ *
+ * @date 2016/11/08
+ *
+ * Header file for template class BitmapMarkSet
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BitmapMarkSet_RECURSES)
+#error Recursive header files inclusion detected in BitmapMarkSet.h
+#else // defined(BitmapMarkSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BitmapMarkSet_RECURSES
+
+#if !defined BitmapMarkSet_h
+/** Prevents repeated inclusion of headers. */
+#define BitmapMarkSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DomainPointIndexer
+  /**
+     Description of template class 'DomainPointIndexer' <p> \brief
+     Aim: Maps the points of a HyperRectDomain to the integers [0,size())
+     and back, with a Linearizer. It is an indexer for BitmapMarkSet.
+
+     @tparam TDomain a HyperRectDomain.
+  */
+  template <typename TDomain>
+  class DomainPointIndexer
+  {
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Element;
+    typedef typename Domain::Point Point;
+    typedef Linearizer<Domain, ColMajorStorage> Linear;
+    typedef std::size_t Index;
+
+    /**
+       Constructor.
+       @param domain the domain of the indexed points.
+    */
+    DomainPointIndexer( const Domain & domain )
+      : myLowerBound( domain.lowerBound() ),
+        myExtent( domain.upperBound() - domain.lowerBound() + Point::diagonal( 1 ) ),
+        mySize( domain.size() )
+    {}
+
+    /// @return the number of indexed points.
+    Index size() const { return mySize; }
+
+    /// @return 'true' if the point @a p is in the domain.
+    bool isIndexed( const Element & p ) const
+    {
+      for ( Dimension k = 0; k < Point::dimension; k++ )
+        if ( p[ k ] < myLowerBound[ k ] || p[ k ] - myLowerBound[ k ] >= myExtent[ k ] )
+          return false;
+      return true;
+    }
+
+    /// @return the index of the point @a p (which must be in the domain).
+    Index index( const Element & p ) const
+    {
+      return static_cast<Index>( Linear::getIndex( p, myLowerBound, myExtent ) );
+    }
+
+    /// @return the point of index @a i.
+    Element element( Index i ) const
+    {
+      return Linear::getPoint( i, myLowerBound, myExtent );
+    }
+
+  private:
+    Point myLowerBound;
+    Point myExtent;
+    Index mySize;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskySCellIndexer
+  /**
+     Description of template class 'KhalimskySCellIndexer' <p> \brief
+     Aim: Maps the signed cells of a Khalimsky space to the integers
+     [0,size()) and back: the Khalimsky coordinates are linearized
+     within the bounds of the space and the sign is the lowest bit.
+     It is an indexer for BitmapMarkSet, useful for the vertices of a
+     DigitalSurface.
+
+     @tparam TKSpace a model of CCellularGridSpaceND.
+  */
+  template <typename TKSpace>
+  class KhalimskySCellIndexer
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell Element;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Space Space;
+    typedef HyperRectDomain<Space> KDomain;
+    typedef Linearizer<KDomain, ColMajorStorage> Linear;
+    typedef std::size_t Index;
+
+    /**
+       Constructor.
+       @param K the Khalimsky space (cloned).
+    */
+    KhalimskySCellIndexer( const KSpace & K )
+      : myK( K ), myLowerBound( K.uKCoords( K.lowerCell() ) ),
+        myExtent( K.uKCoords( K.upperCell() ) - K.uKCoords( K.lowerCell() )
+                  + Point::diagonal( 1 ) )
+    {
+      mySize = 2;
+      for ( Dimension k = 0; k < Point::dimension; k++ )
+        mySize *= static_cast<Index>( myExtent[ k ] );
+    }
+
+    /// @return the number of indexed cells.
+    Index size() const { return mySize; }
+
+    /// @return 'true' if the cell @a c lies in the space bounds.
+    bool isIndexed( const Element & c ) const
+    {
+      const Point & p = c.preCell().coordinates;
+      for ( Dimension k = 0; k < Point::dimension; k++ )
+        if ( p[ k ] < myLowerBound[ k ] || p[ k ] - myLowerBound[ k ] >= myExtent[ k ] )
+          return false;
+      return true;
+    }
+
+    /// @return the index of the signed cell @a c.
+    Index index( const Element & c ) const
+    {
+      return 2 * static_cast<Index>( Linear::getIndex( c.preCell().coordinates,
+                                                       myLowerBound, myExtent ) )
+        + ( c.preCell().positive ? 1 : 0 );
+    }
+
+    /// @return the signed cell of index @a i.
+    Element element( Index i ) const
+    {
+      return myK.sCell( Linear::getPoint( i / 2, myLowerBound, myExtent ),
+                        ( i & 1 ) != 0 ? KSpace::POS : KSpace::NEG );
+    }
+
+  private:
+    KSpace myK;
+    Point myLowerBound;
+    Point myExtent;
+    Index mySize;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BitmapMarkSet
+  /**
+     Description of template class 'BitmapMarkSet' <p> \brief Aim: A
+     set of elements which can be indexed by the integers [0,N) (points
+     of a HyperRectDomain, cells of a bounded Khalimsky space), stored
+     as a bitmap of N bits.
+
+     It offers the subset of the std::set interface used by the graph
+     visitors (insert, find, erase, count, iteration), so it can be used
+     as the mark set of BreadthFirstVisitor or
+     DistanceBreadthFirstVisitor in place of the default vertex set:
+     membership tests and insertions are then a bit access instead of
+     a tree search or hashing. Iteration visits the elements by
+     increasing index and skips empty words, but is proportional to N/64.
+
+     Since it has no default constructor, a visitor using it must be
+     given the (empty) mark set at construction.
+
+     @code
+     typedef BitmapMarkSet< DomainPointIndexer<Domain> > MarkSet;
+     BreadthFirstVisitor< Object, MarkSet > visitor( object, p,
+       MarkSet( DomainPointIndexer<Domain>( domain ) ) );
+     @endcode
+
+     @tparam TIndexer the type mapping elements to indices and back,
+     e.g. DomainPointIndexer or KhalimskySCellIndexer. It must provide
+     the types Element and Index, and methods size(), index(e),
+     element(i) and isIndexed(e).
+  */
+  template <typename TIndexer>
+  class BitmapMarkSet
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef BitmapMarkSet<TIndexer> Self;
+    typedef TIndexer Indexer;
+    typedef typename Indexer::Element Element;
+    typedef typename Indexer::Index Index;
+    typedef Element value_type;
+    typedef Element key_type;
+    typedef std::size_t size_type;
+    typedef DGtal::uint64_t Word;
+
+    /// Read-only forward iterator on the elements of the set.
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Element value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Element* pointer;
+      typedef const Element& reference;
+
+      ConstIterator() : mySet( 0 ), myIndex( 0 ), myDecoded( false ) {}
+      /**
+         Constructor.
+         @param set the set (0 for the past-the-end iterator).
+         @param i an index.
+         @param seek when 'true', moves to the first element of index
+         not smaller than @a i, otherwise @a i must be in the set.
+      */
+      ConstIterator( const BitmapMarkSet* set, Index i, bool seek )
+        : mySet( set ), myIndex( ( set != 0 && seek ) ? set->nextIndex( i ) : i ),
+          myDecoded( false )
+      {}
+      reference operator*() const { return element(); }
+      pointer operator->() const { return &element(); }
+      ConstIterator & operator++()
+      {
+        myIndex = mySet->nextIndex( myIndex + 1 );
+        myDecoded = false;
+        return *this;
+      }
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+      bool operator==( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+      bool operator!=( const ConstIterator & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+      /// @return the index of the pointed element.
+      Index index() const { return myIndex; }
+
+    private:
+      /// @return the pointed element, computed from its index on demand.
+      const Element & element() const
+      {
+        if ( ! myDecoded )
+          {
+            myElement = mySet->myIndexer.element( myIndex );
+            myDecoded = true;
+          }
+        return myElement;
+      }
+
+      const BitmapMarkSet* mySet;
+      Index myIndex;
+      mutable Element myElement;
+      mutable bool myDecoded;
+    };
+
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The set is empty.
+       @param indexer the indexer of the elements (cloned).
+    */
+    BitmapMarkSet( const Indexer & indexer );
+
+    /**
+       Destructor.
+    */
+    ~BitmapMarkSet();
+
+    // ----------------------- Set services --------------------------------
+  public:
+
+    /// @return the indexer of the elements.
+    const Indexer & indexer() const;
+
+    /// @return the number of elements of the set.
+    size_type size() const;
+
+    /// @return 'true' if the set is empty.
+    bool empty() const;
+
+    /// Removes all elements.
+    void clear();
+
+    /**
+       @param e any element.
+       @return 1 if @a e is in the set, 0 otherwise.
+    */
+    size_type count( const Element & e ) const;
+
+    /**
+       Inserts an element.
+       @param e an element whose index is in [0,indexer().size()).
+       @return the iterator on @a e and 'true' if it was not in the set.
+    */
+    std::pair<Iterator, bool> insert( const Element & e );
+
+    /**
+       Inserts a range of elements.
+       @param b an iterator on the first element.
+       @param e an iterator past the last element.
+    */
+    template <typename TInputIterator>
+    void insert( TInputIterator b, TInputIterator e );
+
+    /**
+       @param e any element.
+       @return an iterator on @a e, or end() if it is not in the set.
+    */
+    ConstIterator find( const Element & e ) const;
+
+    /**
+       Removes the element pointed by @a it.
+       @param it an iterator on an element of the set.
+    */
+    void erase( ConstIterator it );
+
+    /**
+       Removes an element.
+       @param e any element.
+       @return the number of removed elements (0 or 1).
+    */
+    size_type erase( const Element & e );
+
+    /// @return an iterator on the element of smallest index.
+    ConstIterator begin() const;
+
+    /// @return the past-the-end iterator.
+    ConstIterator end() const;
+
+    /**
+       Swaps the content of this set with @a other (O(1) for the bits).
+       @param other another set.
+    */
+    void swap( BitmapMarkSet & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The indexer of elements.
+    Indexer myIndexer;
+    /// The bits, 64 per word.
+    std::vector<Word> myBits;
+    /// The number of elements.
+    size_type mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// @return the smallest index of an element not smaller than @a i, or indexer().size().
+    Index nextIndex( Index i ) const;
+
+    /// @return 'true' if the bit @a i is set.
+    bool test( Index i ) const;
+
+  }; // end of class BitmapMarkSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BitmapMarkSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BitmapMarkSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIndexer>
+  std::ostream&
+  operator<< ( std::ostream & out, const BitmapMarkSet<TIndexer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/BitmapMarkSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BitmapMarkSet_h
+
+#undef BitmapMarkSet_RECURSES
+#endif // else defined(BitmapMarkSet_RECURSES)
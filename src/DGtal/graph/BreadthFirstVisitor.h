@@ -72,6 +72,11 @@ namespace DGtal
   free to navigate on each layer.
  
   @tparam TGraph the type of the graph (models of CUndirectedSimpleLocalGraph).
+
+  @tparam TMarkSet the type that is used to store marked vertices, a
+  set of Vertex. When the vertices can be indexed (points of a
+  HyperRectDomain, cells of a Khalimsky space), a BitmapMarkSet avoids
+  tree searches or hashing; it must then be given to the constructor.
  
   @code
      Graph g( ... );
@@ -166,6 +171,31 @@ namespace DGtal
     BreadthFirstVisitor( ConstAlias<Graph> graph, 
                          VertexIterator b, VertexIterator e );
 
+    /**
+     * Constructor from a point and an initial mark set. Useful for
+     * mark sets without default constructor (e.g. BitmapMarkSet).
+     * The vertices already in @a marks are never visited.
+     * @param graph the graph in which the breadth first traversal takes place.
+     * @param p any vertex of the graph.
+     * @param marks the initial set of marked vertices (cloned).
+     */
+    BreadthFirstVisitor( ConstAlias<Graph> graph, const Vertex & p,
+                         const MarkSet & marks );
+
+    /**
+       Constructor from iterators and an initial mark set (see above).
+
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the breadth first traversal takes place.
+       @param b the begin iterator in a container of vertices. 
+       @param e the end iterator in a container of vertices. 
+       @param marks the initial set of marked vertices (cloned).
+    */
+    template <typename VertexIterator>
+    BreadthFirstVisitor( ConstAlias<Graph> graph, 
+                         VertexIterator b, VertexIterator e,
+                         const MarkSet & marks );
+
 
     /**
        @return a const reference on the graph that is traversed.
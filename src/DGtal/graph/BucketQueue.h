@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BucketQueue.h
+ * @author DGtal team
+ *
+ * @date 2016/11/08
+ *
+ * Header file for template class BucketQueue
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BucketQueue_RECURSES)
+#error Recursive header files inclusion detected in BucketQueue.h
+#else // defined(BucketQueue_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BucketQueue_RECURSES
+
+#if !defined BucketQueue_h
+/** Prevents repeated inclusion of headers. */
+#define BucketQueue_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <queue>
+#include <boost/type_traits/is_integral.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BucketQueue
+  /**
+     Description of template class 'BucketQueue' <p> \brief Aim: A
+     priority queue of nodes (pairs element/priority) whose priorities
+     are integers, implemented as an array of buckets, one per
+     priority value between the lowest and the highest priorities of
+     the queued nodes.
+
+     It has the interface of std::priority_queue used by
+     DistanceBreadthFirstVisitor (top() returns a node of lowest
+     priority), but push() and pop() are O(1) amortized and buckets
+     reuse their memory. It is efficient when the spread of
+     priorities of the queued nodes is small, e.g. topological or
+     integer (squared) distances in a breadth-first propagation.
+
+     @tparam TNode the type of node, a std::pair-like type whose member
+     'second' is the priority (of integral type).
+  */
+  template <typename TNode>
+  class BucketQueue
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef BucketQueue<TNode> Self;
+    typedef TNode Node;
+    typedef TNode value_type;
+    typedef typename TNode::second_type Priority;
+    typedef std::size_t size_type;
+    typedef std::vector<Node> Bucket;
+
+    BOOST_STATIC_ASSERT(( boost::is_integral<Priority>::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The queue is empty.
+    */
+    BucketQueue();
+
+    /**
+       Destructor.
+    */
+    ~BucketQueue();
+
+    // ----------------------- Queue services --------------------------------
+  public:
+
+    /// @return 'true' if the queue is empty.
+    bool empty() const;
+
+    /// @return the number of nodes in the queue.
+    size_type size() const;
+
+    /**
+       @return a node of lowest priority (the most recently pushed one
+       among them). NB: valid only if not empty().
+    */
+    const Node & top() const;
+
+    /**
+       Adds a node.
+       @param node any node.
+    */
+    void push( const Node & node );
+
+    /**
+       Removes the node returned by top(). NB: valid only if not empty().
+    */
+    void pop();
+
+    /**
+       Swaps the content of this queue with @a other.
+       @param other another queue.
+    */
+    void swap( BucketQueue & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The buckets, the first one has priority myLowest and is not
+    /// empty (unless the queue is empty).
+    std::deque<Bucket> myBuckets;
+    /// The priority of the first bucket.
+    Priority myLowest;
+    /// The number of queued nodes.
+    size_type mySize;
+    /// Emptied buckets, kept to reuse their memory.
+    std::vector<Bucket> myFreeBuckets;
+
+  }; // end of class BucketQueue
+
+
+  /**
+     Selects the type of queue used by DistanceBreadthFirstVisitor: a
+     std::priority_queue (the default, any scalar distance).
+  */
+  struct PriorityNodeQueueSelector
+  {
+    template <typename TNode>
+    struct Select { typedef std::priority_queue<TNode> Type; };
+  };
+
+  /**
+     Selects the type of queue used by DistanceBreadthFirstVisitor: a
+     BucketQueue (integral distances).
+  */
+  struct BucketNodeQueueSelector
+  {
+    template <typename TNode>
+    struct Select { typedef BucketQueue<TNode> Type; };
+  };
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BucketQueue'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BucketQueue' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TNode>
+  std::ostream&
+  operator<< ( std::ostream & out, const BucketQueue<TNode> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/BucketQueue.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BucketQueue_h
+
+#undef BucketQueue_RECURSES
+#endif // else defined(BucketQueue_RECURSES)
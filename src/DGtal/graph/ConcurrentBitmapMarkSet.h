@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrentBitmapMarkSet.h
+ * @author DGtal team
+ *
+ * @date 2016/11/27
+ *
+ * Header file for template class ConcurrentBitmapMarkSet
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConcurrentBitmapMarkSet_RECURSES)
+#error Recursive header files inclusion detected in ConcurrentBitmapMarkSet.h
+#else // defined(ConcurrentBitmapMarkSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrentBitmapMarkSet_RECURSES
+
+#if !defined ConcurrentBitmapMarkSet_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrentBitmapMarkSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include "DGtal/base/Common.h"
+#include "DGtal/graph/BitmapMarkSet.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConcurrentBitmapMarkSet
+  /**
+     Description of template class 'ConcurrentBitmapMarkSet' <p>
+     \brief Aim: A set of elements indexed by the integers [0,N) (see
+     BitmapMarkSet), in which several threads may insert elements
+     and test membership at the same time.
+
+     The set is a bitmap of N bits, of which only the non-empty 64-bit
+     words are stored, in a hash table with open addressing (linear
+     probing). Keys and words are atomic: a word is claimed with a
+     compare-and-swap of its key, and an element is marked with an
+     atomic 'or' of its bit, which also tells if it was already
+     marked. Elements with close indices (e.g. neighbouring surfels
+     along the first axis, see KhalimskySCellIndexer) share words, so
+     the memory is proportional to the number of marked elements
+     rather than to N, which may be huge for large Khalimsky spaces.
+
+     The table is never resized during concurrent insertions: the
+     caller announces how many insertions may follow with reserve(),
+     outside any parallel section. This fits level-synchronous
+     traversals, which know the size of the next frontier in advance
+     (see Surfaces::parallelTrackBoundary).
+
+     @code
+     typedef KhalimskySCellIndexer<KSpace> Indexer;
+     ConcurrentBitmapMarkSet<Indexer> marks( Indexer( K ) );
+     marks.reserve( frontier.size() * 4 );
+     #pragma omp parallel for
+     for ( ... )
+       if ( marks.insert( s ) ) ... // s is marked for the first time
+     @endcode
+
+     @tparam TIndexer the type mapping elements to indices, e.g.
+     DomainPointIndexer or KhalimskySCellIndexer. It must provide the
+     types Element and Index, and the methods index(e) and isIndexed(e).
+  */
+  template <typename TIndexer>
+  class ConcurrentBitmapMarkSet
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef ConcurrentBitmapMarkSet<TIndexer> Self;
+    typedef TIndexer Indexer;
+    typedef typename Indexer::Element Element;
+    typedef typename Indexer::Index Index;
+    typedef std::size_t size_type;
+    typedef DGtal::uint64_t Word;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The set is empty.
+       @param indexer the indexer of the elements (cloned).
+       @param n the number of insertions that may be done before the
+       first call to reserve.
+    */
+    ConcurrentBitmapMarkSet( const Indexer & indexer, size_type n = 0 );
+
+    /**
+       Destructor.
+    */
+    ~ConcurrentBitmapMarkSet();
+
+    // ----------------------- Set services --------------------------------
+  public:
+
+    /// @return the indexer of the elements.
+    const Indexer & indexer() const;
+
+    /// @return the number of stored (non-empty) words.
+    size_type nbWords() const;
+
+    /// @return the number of slots of the hash table.
+    size_type capacity() const;
+
+    /**
+       Prepares the set so that @a n more elements may be inserted
+       without resizing the table. Not thread-safe: it must be called
+       outside concurrent insertions.
+       @param n a number of insertions.
+    */
+    void reserve( size_type n );
+
+    /// Removes all elements. Not thread-safe.
+    void clear();
+
+    /**
+       Marks an element, whose index must be in [0,indexer().size()).
+       Thread-safe with other calls to insert and count, provided the
+       number of insertions since the last call to reserve does not
+       exceed its argument.
+       @param e any element.
+       @return 'true' if @a e was not marked before, 'false' otherwise.
+    */
+    bool insert( const Element & e );
+
+    /**
+       Thread-safe with insert.
+       @param e any element.
+       @return 1 if @a e is marked, 0 otherwise.
+    */
+    size_type count( const Element & e ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The indexer of elements.
+    Indexer myIndexer;
+    /// The keys of the slots (word index + 1, 0 for a free slot).
+    std::vector< std::atomic<Word> > myKeys;
+    /// The bits of the slots.
+    std::vector< std::atomic<Word> > myBits;
+    /// The number of used slots.
+    std::atomic<size_type> myNbWords;
+    /// The number of bits of the slot indices (the capacity is 2^myLogCapacity).
+    unsigned int myLogCapacity;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the first slot of the probe sequence of @a key.
+    size_type firstSlot( Word key ) const;
+
+    /// Rebuilds the table with 2^logCapacity slots.
+    void rehash( unsigned int logCapacity );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConcurrentBitmapMarkSet ( const ConcurrentBitmapMarkSet & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConcurrentBitmapMarkSet & operator= ( const ConcurrentBitmapMarkSet & other );
+
+  }; // end of class ConcurrentBitmapMarkSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConcurrentBitmapMarkSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConcurrentBitmapMarkSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIndexer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConcurrentBitmapMarkSet<TIndexer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/graph/ConcurrentBitmapMarkSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConcurrentBitmapMarkSet_h
+
+#undef ConcurrentBitmapMarkSet_RECURSES
+#endif // else defined(ConcurrentBitmapMarkSet_RECURSES)
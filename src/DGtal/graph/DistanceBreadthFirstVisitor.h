@@ -46,6 +46,7 @@
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
+#include "DGtal/graph/BucketQueue.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -89,7 +90,15 @@ namespace DGtal
   neighbors.
 
   @tparam TMarkSet the type that is used to store marked
-  vertices. Should be a set of Vertex, hence a model of CSet.
+  vertices. Should be a set of Vertex, hence a model of CSet. When
+  the vertices can be indexed (points of a HyperRectDomain, cells of
+  a Khalimsky space), a BitmapMarkSet avoids tree searches or hashing;
+  it must then be given to the constructor.
+
+  @tparam TNodeQueueSelector selects the priority queue of nodes:
+  PriorityNodeQueueSelector (std::priority_queue, the default) or
+  BucketNodeQueueSelector (BucketQueue, for integral distances, with
+  O(1) push and pop).
  
   @code
      #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
@@ -201,12 +210,13 @@ while ( ! visitor.finished() )
    */
   template < typename TGraph, 
              typename TVertexFunctor,
-             typename TMarkSet = typename TGraph::VertexSet >
+             typename TMarkSet = typename TGraph::VertexSet,
+             typename TNodeQueueSelector = PriorityNodeQueueSelector >
   class DistanceBreadthFirstVisitor
   {
     // ----------------------- Associated types ------------------------------
   public:
-    typedef DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet> Self;
+    typedef DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet,TNodeQueueSelector> Self;
     typedef TGraph Graph;
     typedef TVertexFunctor VertexFunctor;
     typedef TMarkSet MarkSet;
@@ -259,8 +269,9 @@ while ( ! visitor.finished() )
       }
     };
 
-    /// Internal data structure for computing the distance ordering expansion.
-    typedef std::priority_queue< Node > NodeQueue;
+    /// Internal data structure for computing the distance ordering
+    /// expansion (a std::priority_queue by default).
+    typedef typename TNodeQueueSelector::template Select< Node >::Type NodeQueue;
     /// Internal data structure for storing vertices.
     typedef std::vector< Vertex > VertexList;
 
@@ -309,6 +320,38 @@ while ( ! visitor.finished() )
                      const VertexFunctor & distance,
                      VertexIterator b, VertexIterator e );
 
+    /**
+     * Constructor from a point, a vertex functor object and an
+     * initial mark set. Useful for mark sets without default
+     * constructor (e.g. BitmapMarkSet). The vertices already in @a
+     * marks are never visited.
+     * @param graph the graph in which the distance ordering traversal takes place (aliased).
+     * @param distance the distance object, a functor Vertex -> Scalar (cloned).
+     * @param p any vertex of the graph.
+     * @param marks the initial set of marked vertices (cloned).
+     */
+    DistanceBreadthFirstVisitor( ConstAlias<Graph> graph, 
+                     const VertexFunctor & distance,
+                     const Vertex & p,
+                     const MarkSet & marks );
+
+    /**
+       Constructor from a graph, a vertex functor, two iterators
+       specifying a range and an initial mark set (see above).
+       
+       @tparam VertexIterator any type of single pass iterator on vertices.
+       @param graph the graph in which the distance ordering traversal takes place (aliased).
+       @param distance the distance object, a functor Vertex -> Scalar (cloned).
+       @param b the begin iterator in a container of vertices. 
+       @param e the end iterator in a container of vertices. 
+       @param marks the initial set of marked vertices (cloned).
+    */
+    template <typename VertexIterator>
+    DistanceBreadthFirstVisitor( const Graph & graph, 
+                     const VertexFunctor & distance,
+                     VertexIterator b, VertexIterator e,
+                     const MarkSet & marks );
+
 
     /**
        @return a const reference on the graph that is traversed.
@@ -531,10 +574,10 @@ while ( ! visitor.finished() )
    * @param object the object of class 'DistanceBreadthFirstVisitor' to write.
    * @return the output stream after the writing.
    */
-  template < typename TGraph, typename TVertexFunctor, typename TMarkSet >
+  template < typename TGraph, typename TVertexFunctor, typename TMarkSet, typename TNodeQueueSelector >
   std::ostream&
   operator<< ( std::ostream & out, 
-               const DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet> & object );
+               const DistanceBreadthFirstVisitor<TGraph,TVertexFunctor,TMarkSet,TNodeQueueSelector> & object );
 
 } // namespace DGtal
 
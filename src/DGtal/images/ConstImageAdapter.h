@@ -255,6 +255,15 @@ public:
     {
         return myImagePtr;
     }
+
+    /**
+     * Returns the functor f applied to the values of the image container.
+     * @return a const reference on the value functor.
+     */
+    const TFunctorV & getValueFunctor() const
+    {
+        return *myFV;
+    }
     
     /**
      * Allows to define a default value returned when point 
@@ -53,6 +53,7 @@
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageSpanEvaluator.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
@@ -183,6 +184,10 @@ namespace DGtal
    * In a window corresponding to the domain of @a aImg, 
    * copy the values of @a aFun into @a aImg
    *
+   * When @a aImg is an ImageContainerBySTLVector, it is filled
+   * scanline by scanline (see HyperRectDomain::scanlines), writing
+   * directly into its storage.
+   *
    * @param aImg (returned) image
    * @param aFun a unary functor
    *
@@ -195,6 +200,12 @@ namespace DGtal
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
+   * When @a aImg1 is an ImageContainerBySTLVector with the same
+   * domain as @a aImg2, and @a aImg2 can be evaluated by spans (see
+   * ImageSpanEvaluator), e.g. a chain of ConstImageAdapter over an
+   * ImageContainerBySTLVector, the copy is done span by span with
+   * copyImageBySpans.
+   *
    * @param aImg1 the image to fill
    * @param aImg2 the image to copy
    *
@@ -0,0 +1,261 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageResampler.h
+ * @author DGtal team
+ *
+ * @date 2016/11/15
+ *
+ * Header file for template class ImageResampler
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageResampler_RECURSES)
+#error Recursive header files inclusion detected in ImageResampler.h
+#else // defined(ImageResampler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageResampler_RECURSES
+
+#if !defined ImageResampler_h
+/** Prevents repeated inclusion of headers. */
+#define ImageResampler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageResampler
+  /**
+     Description of template class 'ImageResampler' <p>
+     \brief Aim: Resamples an image through an affine transformation
+     (e.g. a rigid transformation), following the backward (Eulerian)
+     model: the value of each point \a q of the target image is the
+     value of the source image at the real point \a M \a q + \a b,
+     either the value of the closest point (NEAREST) or the n-linear
+     interpolation of the values of the 2^n surrounding points
+     (LINEAR). Points outside the source domain have a background
+     value.
+
+     The target image is filled tile by tile (a tile being a block of
+     TileWidth x TileHeight points in the first two axes), tiles being
+     processed in parallel with OpenMP. Along each row of a tile, the
+     source point is moved by adding the first column of \a M: there
+     is a single matrix product per row, none per point.
+
+     With NEAREST interpolation and a backward rigid transformation,
+     the result is the one of a ConstImageAdapter with this
+     transformation, up to rounding errors of the incremental stepping
+     (for points whose source coordinates are within a few ulps of a
+     half-integer), and except that points mapped outside the source
+     domain get the background value.
+
+     @code
+     typedef functors::BackwardRigidTransformation3D<Z3i::Space> BackwardTrans;
+     BackwardTrans backward( RealPoint( 5, 5, 5 ), RealVector( 1, 0, 1 ), M_PI_4, RealVector( 3, -3, 3 ) );
+     ImageResampler<Image> resampler( backward, ImageResampler<Image>::LINEAR );
+     Image transformed = resampler.resample( image, transformedDomain );
+     @endcode
+
+     @tparam TImage an ImageContainerBySTLVector, whose values are
+     arithmetic types for LINEAR interpolation.
+
+     @see RigidTransformation2D.h, RigidTransformation3D.h
+  */
+  template <typename TImage>
+  class ImageResampler
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef ImageResampler<TImage> Self;
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Value Value;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Integer Integer;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Space::dimension );
+    typedef SimpleMatrix<double, dimension, dimension> Matrix;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Image, ImageContainerBySTLVector<Domain, Value> >::value ));
+
+    /// The interpolation of source values.
+    enum Interpolation { NEAREST, LINEAR };
+
+    /// The size of tiles along the first axis.
+    BOOST_STATIC_CONSTANT( Integer, TileWidth = 64 );
+    /// The size of tiles along the second axis.
+    BOOST_STATIC_CONSTANT( Integer, TileHeight = 16 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor from an affine transformation.
+
+       @param aMatrix the linear part \a M of the transformation.
+       @param aTranslation the translation part \a b of the transformation.
+       @param anInterpolation the interpolation of source values.
+       @param aBackground the value of points mapped outside the source domain.
+    */
+    ImageResampler( const Matrix & aMatrix, const RealVector & aTranslation,
+                    Interpolation anInterpolation = NEAREST,
+                    const Value & aBackground = Value() );
+
+    /**
+       Constructor from a transformation mapping target points to
+       source points, e.g. a BackwardRigidTransformation2D or
+       BackwardRigidTransformation3D. The transformation must be
+       affine: its matrix and translation are computed from the images
+       of the origin and of the unit vectors.
+
+       @tparam TBackwardTransform a type with a method RealPoint
+       realTransform( const RealPoint & ) const.
+       @param aTransform the backward transformation.
+       @param anInterpolation the interpolation of source values.
+       @param aBackground the value of points mapped outside the source domain.
+    */
+    template <typename TBackwardTransform>
+    ImageResampler( const TBackwardTransform & aTransform,
+                    Interpolation anInterpolation = NEAREST,
+                    const Value & aBackground = Value() );
+
+    /**
+       Destructor.
+    */
+    ~ImageResampler();
+
+    // ----------------------- Resampling services ----------------------------
+  public:
+
+    /// @return the linear part of the transformation.
+    const Matrix & matrix() const;
+
+    /// @return the translation part of the transformation.
+    const RealVector & translation() const;
+
+    /// @return the interpolation of source values.
+    Interpolation interpolation() const;
+
+    /// @param anInterpolation the new interpolation of source values.
+    void setInterpolation( Interpolation anInterpolation );
+
+    /// @return the value of points mapped outside the source domain.
+    const Value & background() const;
+
+    /// @param aBackground the value of points mapped outside the source domain.
+    void setBackground( const Value & aBackground );
+
+    /**
+       @param aPoint any target point.
+       @return the source point \a M aPoint + \a b.
+    */
+    RealPoint sourcePoint( const Point & aPoint ) const;
+
+    /**
+       Fills the whole target image with the resampled source image.
+       @param aSource the source image.
+       @param[in,out] aTarget the target image, whose domain is kept.
+    */
+    void resample( const Image & aSource, Image & aTarget ) const;
+
+    /**
+       @param aSource the source image.
+       @param aDomain the domain of the target image.
+       @return the resampled source image on @a aDomain.
+    */
+    Image resample( const Image & aSource, const Domain & aDomain ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       Resamples the row of @a n points starting at @a aFirst.
+       @param aSource the source image.
+       @param aFirst the first target point of the row.
+       @param n the number of points of the row.
+       @param[out] values the @a n values of the row.
+    */
+    void resampleRow( const Image & aSource, const Point & aFirst, Integer n,
+                      Value * values ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The linear part of the transformation.
+    Matrix myMatrix;
+    /// The translation part of the transformation.
+    RealVector myTranslation;
+    /// The interpolation of source values.
+    Interpolation myInterpolation;
+    /// The value of points mapped outside the source domain.
+    Value myBackground;
+
+  }; // end of class ImageResampler
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageResampler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageResampler' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageResampler<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageResampler.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageResampler_h
+
+#undef ImageResampler_RECURSES
+#endif // else defined(ImageResampler_RECURSES)
@@ -0,0 +1,266 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageSpanEvaluator.h
+ * @author DGtal team
+ *
+ * @date 2016/11/16
+ *
+ * Header file for template class ImageSpanEvaluator and function
+ * copyImageBySpans.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageSpanEvaluator_RECURSES)
+#error Recursive header files inclusion detected in ImageSpanEvaluator.h
+#else // defined(ImageSpanEvaluator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageSpanEvaluator_RECURSES
+
+#if !defined ImageSpanEvaluator_h
+/** Prevents repeated inclusion of headers. */
+#define ImageSpanEvaluator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <algorithm>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageAdapter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageSpanEvaluator
+  /**
+     Description of template class 'ImageSpanEvaluator' <p>
+     \brief Aim: Evaluates an image (a model of CConstImage) along
+     spans, i.e. runs of consecutive points along the first axis.
+
+     The generic version evaluates the image point by point. It is
+     specialized for:
+     - ImageContainerBySTLVector, whose spans are contiguous ranges of
+       the underlying vector (the ones walked by a SpanIterator along
+       axis 0), copied in one go;
+     - ConstImageAdapter and ImageAdapter whose domain functor is
+       functors::Identity (i.e. domain restrictions with value functors
+       like thresholds, casts or colormaps) over a HyperRectDomain
+       image: the span of the underlying image is evaluated by chunks
+       in a buffer, then the value functor is applied to the whole
+       chunk.
+
+     Hence, a chain of such adapters over an ImageContainerBySTLVector
+     is evaluated span by span as a single tight loop per adapter,
+     without any domain check nor functor call per point for the
+     domain part. The static member \a isDense tells if spans are
+     evaluated this way.
+
+     @tparam TImage a model of CConstImage.
+
+     @see copyImageBySpans, imageFromImage
+  */
+  template <typename TImage>
+  struct ImageSpanEvaluator
+  {
+    typedef TImage Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Integer;
+
+    /// 'true' if spans are evaluated in bulk.
+    BOOST_STATIC_CONSTANT( bool, isDense = false );
+
+    /**
+       Evaluates the image at the points aFirst + i * e_0, i in [0,n).
+       @param anImage the image.
+       @param aFirst the first point of the span, in the image domain.
+       @param n the number of points, all in the image domain.
+       @param[out] values a pointer on (at least) @a n values.
+    */
+    static void evaluate( const Image & anImage, Point aFirst, Integer n, Value * values )
+    {
+      for ( Integer i = 0; i < n; i++, ++aFirst[ 0 ] )
+        values[ i ] = anImage( aFirst );
+    }
+  };
+
+  namespace detail
+  {
+    /// The number of values buffered when evaluating adapters by spans.
+    static const std::ptrdiff_t IMAGE_SPAN_CHUNK_SIZE = 256;
+
+    /**
+     * Evaluates by spans an adapter @a anAdapter with identity domain
+     * functor over the image @a anImage, with value functor @a aFunctor.
+     * The points outside the image domain have value @a aDefault.
+     */
+    template <typename TAdapter, typename TImage, typename TFunctor>
+    struct AdapterSpanEvaluator
+    {
+      typedef typename TAdapter::Point Point;
+      typedef typename TAdapter::Value Value;
+      typedef typename Point::Coordinate Integer;
+      typedef ImageSpanEvaluator<TImage> ImageEvaluator;
+      typedef typename TImage::Value ImageValue;
+
+      BOOST_STATIC_CONSTANT( bool, isDense =
+                             ( ImageEvaluator::isDense
+                               && boost::is_same< typename TImage::Domain,
+                               HyperRectDomain< typename TImage::Domain::Space > >::value ) );
+
+      static void evaluate( const TImage & anImage, const TFunctor & aFunctor,
+                            const Value & aDefault, Point aFirst, Integer n, Value * values )
+      {
+        Point last = aFirst;
+        last[ 0 ] += n - 1;
+        if ( ! ( anImage.domain().isInside( aFirst ) && anImage.domain().isInside( last ) ) )
+          {
+            // The span leaves the image domain: point by point.
+            for ( Integer i = 0; i < n; i++, ++aFirst[ 0 ] )
+              values[ i ] = anImage.domain().isInside( aFirst )
+                ? aFunctor( anImage( aFirst ) ) : aDefault;
+            return;
+          }
+        ImageValue buffer[ IMAGE_SPAN_CHUNK_SIZE ];
+        for ( Integer i = 0; i < n; )
+          {
+            const Integer m = std::min( n - i, static_cast<Integer>( IMAGE_SPAN_CHUNK_SIZE ) );
+            ImageEvaluator::evaluate( anImage, aFirst, m, buffer );
+            for ( Integer j = 0; j < m; j++ )
+              values[ i + j ] = aFunctor( buffer[ j ] );
+            aFirst[ 0 ] += m;
+            i += m;
+          }
+      }
+    };
+  } // namespace detail
+
+  /**
+     Evaluation by spans of an ImageContainerBySTLVector.
+     @see ImageSpanEvaluator
+  */
+  template <typename TDomain, typename TValue>
+  struct ImageSpanEvaluator< ImageContainerBySTLVector<TDomain, TValue> >
+  {
+    typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Integer;
+
+    BOOST_STATIC_CONSTANT( bool, isDense = true );
+
+    static void evaluate( const Image & anImage, const Point & aFirst, Integer n, Value * values )
+    {
+      const typename Image::ConstIterator it = anImage.begin() + anImage.linearized( aFirst );
+      std::copy( it, it + n, values );
+    }
+  };
+
+  /**
+     Evaluation by spans of a ConstImageAdapter with identity domain functor.
+     @see ImageSpanEvaluator
+  */
+  template <typename TImageContainer, typename TNewDomain, typename TNewValue, typename TFunctorV>
+  struct ImageSpanEvaluator< ConstImageAdapter<TImageContainer, TNewDomain, functors::Identity,
+                                               TNewValue, TFunctorV> >
+  {
+    typedef ConstImageAdapter<TImageContainer, TNewDomain, functors::Identity,
+                              TNewValue, TFunctorV> Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Integer;
+    typedef detail::AdapterSpanEvaluator<Image, TImageContainer, TFunctorV> Evaluator;
+
+    BOOST_STATIC_CONSTANT( bool, isDense = Evaluator::isDense );
+
+    static void evaluate( const Image & anImage, const Point & aFirst, Integer n, Value * values )
+    {
+      Evaluator::evaluate( *anImage.getPointer(), anImage.getValueFunctor(),
+                           anImage.getDefaultValue(), aFirst, n, values );
+    }
+  };
+
+  /**
+     Evaluation by spans of an ImageAdapter with identity domain functor.
+     @see ImageSpanEvaluator
+  */
+  template <typename TImageContainer, typename TNewDomain, typename TNewValue,
+            typename TFunctorV, typename TFunctorVm1>
+  struct ImageSpanEvaluator< ImageAdapter<TImageContainer, TNewDomain, functors::Identity,
+                                          TNewValue, TFunctorV, TFunctorVm1> >
+  {
+    typedef ImageAdapter<TImageContainer, TNewDomain, functors::Identity,
+                         TNewValue, TFunctorV, TFunctorVm1> Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Point::Coordinate Integer;
+    typedef detail::AdapterSpanEvaluator<Image, TImageContainer, TFunctorV> Evaluator;
+
+    BOOST_STATIC_CONSTANT( bool, isDense = Evaluator::isDense );
+
+    static void evaluate( const Image & anImage, const Point & aFirst, Integer n, Value * values )
+    {
+      Evaluator::evaluate( *anImage.getPointer(), anImage.getValueFunctor(),
+                           anImage.getDefaultValue(), aFirst, n, values );
+    }
+  };
+
+  /**
+     Copies the values of @a anImage into @a aTarget, span by span
+     along the first axis (see ImageSpanEvaluator). The points of the
+     target domain must be in the domain of @a anImage.
+
+     The spans may be evaluated in parallel (with OpenMP), provided
+     the functors of @a anImage may be called concurrently.
+
+     @tparam TDomain the domain of the target image.
+     @tparam TValue the value type of the target image (not bool).
+     @tparam TImage a model of CConstImage whose values are convertible to TValue.
+
+     @param[in,out] aTarget the image to fill.
+     @param anImage the image to copy.
+     @param inParallel when 'true', spans are evaluated in parallel.
+  */
+  template <typename TDomain, typename TValue, typename TImage>
+  void copyImageBySpans( ImageContainerBySTLVector<TDomain, TValue> & aTarget,
+                         const TImage & anImage, bool inParallel = false );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageSpanEvaluator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageSpanEvaluator_h
+
+#undef ImageSpanEvaluator_RECURSES
+#endif // else defined(ImageSpanEvaluator_RECURSES)
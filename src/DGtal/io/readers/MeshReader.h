@@ -44,6 +44,7 @@
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/CompactMesh.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -57,8 +58,9 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
- * into accouts the optional color faces.
+ * OFF, OFS and PLY surface mesh. It allows to import a Mesh (or a
+ * CompactMesh for PLY files) object and takes into accouts the
+ * optional color faces.
  * 
  * The importation can be done automatically according the input file
  * extension with the operator << 
@@ -126,6 +128,52 @@ public:
   
   static  bool  importOFSFile(const std::string & filename, 
 			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false, double scale=1.0) throw(DGtal::IOException);
+
+
+ /** 
+  * Main method to import PLY meshes file (Polygon File Format) in
+  * ASCII, binary little-endian or binary big-endian encoding.
+  *
+  * Vertex coordinates are read from the "x", "y" and "z" properties
+  * of the "vertex" element, faces from the "vertex_indices" (or
+  * "vertex_index") list property of the "face" element and the
+  * optional face colors from its "red", "green", "blue" and "alpha"
+  * properties. Other elements and properties are skipped.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported correctly.
+  */
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false) throw(DGtal::IOException);
+
+ /** 
+  * Main method to import PLY meshes file into a CompactMesh (see
+  * importPLYFile(const std::string &, Mesh<TPoint> &, bool)). Face
+  * colors are imported only if @a aMesh stores face colors.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported correctly.
+  */
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::CompactMesh<TPoint> & aMesh, bool invertVertexOrder=false) throw(DGtal::IOException);
+
+private:
+
+ /** 
+  * Generic PLY importer for Mesh and CompactMesh.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert the order of imported points.
+  * @return true if the mesh has been imported correctly.
+  */
+  template <typename TMesh>
+  static  bool  importPLY(const std::string & filename, 
+                          TMesh & aMesh, bool invertVertexOrder) throw(DGtal::IOException);
   
   
   
@@ -149,6 +197,17 @@ public:
   template <typename TPoint>
   bool
   operator<< (  Mesh<TPoint> & mesh, const std::string &filename );
+
+  /**
+   *  'operator<<' for importing objects of class 'CompactMesh' (PLY
+   *  files only).
+   * @param mesh a mesh 
+   * @param filename a filename 
+   * @return true if the mesh has been imported correctly.
+   */
+  template <typename TPoint>
+  bool
+  operator<< (  CompactMesh<TPoint> & mesh, const std::string &filename );
   
   
 
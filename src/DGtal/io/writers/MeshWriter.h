@@ -45,6 +45,7 @@
 #include <boost/static_assert.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/CompactMesh.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -54,11 +55,18 @@ namespace DGtal
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh or CompactMesh object) in different
+   * format as OFF, OBJ and PLY (ASCII or binary little-endian).
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
    * 
+   * Vertices and faces are formatted by chunks of consecutive
+   * elements. If DGtal has been built with OpenMP support (WITH_OPENMP
+   * flag set to "true"), chunks are formatted in parallel and written
+   * in order, so that the output does not depend on the number of
+   * threads.
+   * 
    * Example of typical use: 
    * First you have to add the following include files:
    * @snippet tests/io/writers/testMeshWriter.cpp MeshWriterUseIncludes
@@ -119,7 +127,99 @@ namespace DGtal
     static bool export2OBJ_colors(std::ostream &out, std::ostream &outMTL,
                                   const std::string nameMTLFile,
                                   const  Mesh<TPoint>  &aMesh) throw(DGtal::IOException);
-    
+
+    /** 
+     * Export a Mesh towards a PLY format. By default the face colors
+     * are exported (if they are stored in the Mesh object).
+     * 
+     * @param out the output stream of the exported PLY object (must
+     * be opened in binary mode if @a binary is true).
+     * @param aMesh the Mesh object to be exported.
+     * @param binary true to export in binary little-endian PLY,
+     * false to export in ASCII PLY (default true).
+     * @param exportColor true to try to export the face colors if they are stored in the Mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh,
+                           bool binary=true, bool exportColor=true) throw(DGtal::IOException);
+
+    /** 
+     * Export a CompactMesh towards a OFF format. By default the face
+     * colors are exported (if they are stored in the mesh object).
+     * 
+     * @param out the output stream of the exported OFF object.
+     * @param aMesh the CompactMesh object to be exported.
+     * @param exportColor true to try to export the face colors if they are stored in the mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    static bool export2OFF(std::ostream &out, const  CompactMesh<TPoint>  &aMesh, 
+                           bool exportColor=true) throw(DGtal::IOException);
+
+    /** 
+     * Export a CompactMesh towards a OBJ format (without colors).
+     * 
+     * @param out the output stream of the exported OBJ object.
+     * @param aMesh the CompactMesh object to be exported.
+     * @return true if no errors occur.
+     */
+    static bool export2OBJ(std::ostream &out, const  CompactMesh<TPoint>  &aMesh) throw(DGtal::IOException);
+
+    /** 
+     * Export a CompactMesh towards a PLY format. By default the face
+     * colors are exported (if they are stored in the mesh object).
+     * 
+     * @param out the output stream of the exported PLY object (must
+     * be opened in binary mode if @a binary is true).
+     * @param aMesh the CompactMesh object to be exported.
+     * @param binary true to export in binary little-endian PLY,
+     * false to export in ASCII PLY (default true).
+     * @param exportColor true to try to export the face colors if they are stored in the mesh object (default true). 
+     * @return true if no errors occur.
+     */
+    static bool export2PLY(std::ostream &out, const  CompactMesh<TPoint>  &aMesh,
+                           bool binary=true, bool exportColor=true) throw(DGtal::IOException);
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Number of vertices or faces formatted in a single chunk.
+    static const std::size_t myChunkSize = 16384;
+
+    /**
+     * Formats the elements [0, nb) by chunks (in parallel if OpenMP is
+     * enabled) and writes the chunks in order to @a out.
+     *
+     * @tparam TFormatter a type providing a method "void
+     * operator()(std::ostream &, std::size_t) const" which formats
+     * one element.
+     * @param out the output stream.
+     * @param nb the number of elements.
+     * @param formatter the element formatter.
+     */
+    template <typename TFormatter>
+    static void writeChunks(std::ostream &out, const std::size_t nb,
+                            const TFormatter &formatter);
+
+    /**
+     * Generic export of the vertices and faces of a mesh (Mesh or
+     * CompactMesh) in OFF format.
+     */
+    template <typename TMesh>
+    static void writeOFF(std::ostream &out, const TMesh &aMesh, bool exportColor);
+
+    /**
+     * Generic export of the vertices and faces of a mesh (Mesh or
+     * CompactMesh) in OBJ format.
+     */
+    template <typename TMesh>
+    static void writeOBJ(std::ostream &out, const TMesh &aMesh);
+
+    /**
+     * Generic export of a mesh (Mesh or CompactMesh) in PLY format.
+     */
+    template <typename TMesh>
+    static void writePLY(std::ostream &out, const TMesh &aMesh,
+                         bool binary, bool exportColor);
     
   };
   
@@ -130,7 +230,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
@@ -144,6 +244,21 @@ namespace DGtal
 
 
 
+  /**
+   *  'operator>>' for exporting objects of class 'CompactMesh'.
+   *  This operator automatically selects the good method according to
+   *  the filename extension (off, obj, ply).
+   *  
+   * @param aMesh the mesh to be exported.
+   * @param aFilename the filename of the file to be exported. 
+   * @return true, if the export was successful. 
+   */
+  template <typename TPoint>
+  bool
+  operator >> (  CompactMesh<TPoint> & aMesh,  const std::string & aFilename  );
+
+
+
   /**
    *  'operator>>' for exporting objects of class 'Mesh' in OFF format.
    *  
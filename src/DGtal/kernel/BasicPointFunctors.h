@@ -708,7 +708,7 @@ namespace functors
   {
   public:
     typedef typename TDomain::Space  Space;
-    typedef typename TDomain::Size Size;
+    typedef typename Space::Size Size;
     typedef typename Space::Dimension Dimension;
     typedef typename Space::Point Point;
 
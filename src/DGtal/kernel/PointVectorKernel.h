@@ -0,0 +1,361 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointVectorKernel.h
+ * @author DGtal team
+ *
+ * @date 2016/11/20
+ *
+ * Header file for SIMD component-wise kernels on the containers of
+ * PointVector. PointVector itself keeps its generic loops, since the
+ * kernels showed no speedup on it (see benchmarkPointVector).
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointVectorKernel_RECURSES)
+#error Recursive header files inclusion detected in PointVectorKernel.h
+#else // defined(PointVectorKernel_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointVectorKernel_RECURSES
+
+#if !defined PointVectorKernel_h
+/** Prevents repeated inclusion of headers. */
+#define PointVectorKernel_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <array>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+
+/**
+ * SSE2 lanes are used for the component-wise operations of
+ * PointVectorKernel on std::array of double, float and int32 components,
+ * unless DGTAL_NO_SIMD is defined.
+ */
+#if ( defined(__SSE2__) || defined(_M_X64) ) && !defined(DGTAL_NO_SIMD)
+#define DGTAL_POINTVECTOR_SSE2
+#include <emmintrin.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class PointVectorGenericKernel
+    /**
+     * Description of template class 'PointVectorGenericKernel' <p>
+     * \brief Aim: Component-wise operations of PointVector, written as
+     * loops over the components of any container. The loops have a
+     * compile-time trip count and are unrolled by the compiler.
+     *
+     * Floating-point results are the ones of a component by component
+     * evaluation, in increasing order of the components (e.g. for dot).
+     *
+     * @tparam dim the dimension.
+     * @tparam TComponent the component type.
+     * @tparam TContainer the container of the components.
+     */
+    template <Dimension dim, typename TComponent, typename TContainer>
+    struct PointVectorGenericKernel
+    {
+      typedef TComponent Component;
+      typedef TContainer Container;
+
+      /// r = a + b
+      static void plus( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          r[ i ] = a[ i ] + b[ i ];
+      }
+
+      /// r = a - b
+      static void minus( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          r[ i ] = a[ i ] - b[ i ];
+      }
+
+      /// r = inf(a, b), with std::min.
+      static void inf( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          r[ i ] = std::min( a[ i ], b[ i ] );
+      }
+
+      /// r = sup(a, b), with std::max.
+      static void sup( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < dim; ++i )
+          r[ i ] = std::max( a[ i ], b[ i ] );
+      }
+
+      /// @return true if no component of b is less than the one of a.
+      static bool isLower( const Container & a, const Container & b )
+      {
+        bool lower = true;
+        for ( Dimension i = 0; i < dim; ++i )
+          lower = lower && ! ( b[ i ] < a[ i ] );
+        return lower;
+      }
+
+      /// @return true if no component of b is greater than the one of a.
+      static bool isUpper( const Container & a, const Container & b )
+      {
+        return PointVectorGenericKernel::isLower( b, a );
+      }
+
+      /// @return the dot product of a and b.
+      static Component dot( const Container & a, const Container & b )
+      {
+        Component d = NumberTraits<Component>::ZERO;
+        for ( Dimension i = 0; i < dim; ++i )
+          d += a[ i ] * b[ i ];
+        return d;
+      }
+
+      /// @return the sum of the squared components of a, as a double.
+      static double squaredNorm( const Container & a )
+      {
+        double n = 0.0;
+        for ( Dimension i = 0; i < dim; ++i )
+          {
+            const double c = NumberTraits<Component>::castToDouble( a[ i ] );
+            n += c * c;
+          }
+        return n;
+      }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class PointVectorKernel
+    /**
+     * Description of template class 'PointVectorKernel' <p>
+     * \brief Aim: Component-wise operations on the containers of
+     * PointVector. This is PointVectorGenericKernel, except for std::array of double,
+     * float and DGtal::int32_t components when SSE2 is available:
+     * components are then processed by SIMD lanes (2 for double, 4 for
+     * float and int32), the remaining components being processed one
+     * by one (e.g. dimension 3 for double is one pair of lanes and a
+     * single component, float and int32 need dimension 4 or more:
+     * below, their components are all processed by the generic loops).
+     * 64-bit integers have no SSE2 minimum nor comparison, hence are
+     * left to the generic kernel.
+     *
+     * Results are identical to the ones of PointVectorGenericKernel:
+     * lanes compute exactly the same operations, minimum and maximum
+     * follow std::min and std::max (including for NaN), and sums of
+     * products are accumulated in order.
+     *
+     * @tparam dim the dimension.
+     * @tparam TComponent the component type.
+     * @tparam TContainer the container of the components.
+     */
+    template <Dimension dim, typename TComponent, typename TContainer>
+    struct PointVectorKernel
+      : public PointVectorGenericKernel<dim, TComponent, TContainer>
+    {};
+
+#ifdef DGTAL_POINTVECTOR_SSE2
+
+    /**
+     * SSE2 lanes of a component type: the type of a register, the
+     * number of lanes and the lane-wise operations.
+     * @tparam TComponent the component type.
+     */
+    template <typename TComponent>
+    struct SSE2Lanes;
+
+    template <>
+    struct SSE2Lanes<double>
+    {
+      typedef __m128d Register;
+      static const Dimension size = 2;
+      static Register load( const double * p ) { return _mm_loadu_pd( p ); }
+      static void store( double * p, Register r ) { _mm_storeu_pd( p, r ); }
+      static Register plus( Register a, Register b ) { return _mm_add_pd( a, b ); }
+      static Register minus( Register a, Register b ) { return _mm_sub_pd( a, b ); }
+      static Register times( Register a, Register b ) { return _mm_mul_pd( a, b ); }
+      // std::min(a,b) is (b < a) ? b : a, and _mm_min_pd(x,y) is (x < y) ? x : y.
+      static Register inf( Register a, Register b ) { return _mm_min_pd( b, a ); }
+      // std::max(a,b) is (a < b) ? b : a, and _mm_max_pd(x,y) is (x > y) ? x : y.
+      static Register sup( Register a, Register b ) { return _mm_max_pd( b, a ); }
+      /// @return true if a lane of a is less than the one of b.
+      static bool anyLess( Register a, Register b ) { return _mm_movemask_pd( _mm_cmplt_pd( a, b ) ) != 0; }
+    };
+
+    template <>
+    struct SSE2Lanes<float>
+    {
+      typedef __m128 Register;
+      static const Dimension size = 4;
+      static Register load( const float * p ) { return _mm_loadu_ps( p ); }
+      static void store( float * p, Register r ) { _mm_storeu_ps( p, r ); }
+      static Register plus( Register a, Register b ) { return _mm_add_ps( a, b ); }
+      static Register minus( Register a, Register b ) { return _mm_sub_ps( a, b ); }
+      static Register times( Register a, Register b ) { return _mm_mul_ps( a, b ); }
+      static Register inf( Register a, Register b ) { return _mm_min_ps( b, a ); }
+      static Register sup( Register a, Register b ) { return _mm_max_ps( b, a ); }
+      static bool anyLess( Register a, Register b ) { return _mm_movemask_ps( _mm_cmplt_ps( a, b ) ) != 0; }
+    };
+
+    template <>
+    struct SSE2Lanes<DGtal::int32_t>
+    {
+      typedef __m128i Register;
+      static const Dimension size = 4;
+      static Register load( const DGtal::int32_t * p ) { return _mm_loadu_si128( reinterpret_cast<const __m128i *>( p ) ); }
+      static void store( DGtal::int32_t * p, Register r ) { _mm_storeu_si128( reinterpret_cast<__m128i *>( p ), r ); }
+      static Register plus( Register a, Register b ) { return _mm_add_epi32( a, b ); }
+      static Register minus( Register a, Register b ) { return _mm_sub_epi32( a, b ); }
+      static Register inf( Register a, Register b )
+      {
+        const Register bLess = _mm_cmplt_epi32( b, a );
+        return _mm_or_si128( _mm_and_si128( bLess, b ), _mm_andnot_si128( bLess, a ) );
+      }
+      static Register sup( Register a, Register b )
+      {
+        const Register aLess = _mm_cmplt_epi32( a, b );
+        return _mm_or_si128( _mm_and_si128( aLess, b ), _mm_andnot_si128( aLess, a ) );
+      }
+      static bool anyLess( Register a, Register b ) { return _mm_movemask_epi8( _mm_cmplt_epi32( a, b ) ) != 0; }
+    };
+
+    /**
+     * Component-wise operations on std::array by SSE2 lanes, the
+     * remaining components being processed by the generic kernel
+     * loops.
+     */
+    template <Dimension dim, typename TComponent>
+    struct PointVectorSSE2Kernel
+      : public PointVectorGenericKernel<dim, TComponent, std::array<TComponent, dim> >
+    {
+      typedef TComponent Component;
+      typedef std::array<TComponent, dim> Container;
+      typedef SSE2Lanes<TComponent> Lanes;
+      typedef typename Lanes::Register Register;
+      /// Number of components processed by lanes.
+      static const Dimension packed = dim - dim % Lanes::size;
+
+      static void plus( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < packed; i += Lanes::size )
+          Lanes::store( &r[ i ], Lanes::plus( Lanes::load( &a[ i ] ), Lanes::load( &b[ i ] ) ) );
+        for ( Dimension i = packed; i < dim; ++i )
+          r[ i ] = a[ i ] + b[ i ];
+      }
+
+      static void minus( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < packed; i += Lanes::size )
+          Lanes::store( &r[ i ], Lanes::minus( Lanes::load( &a[ i ] ), Lanes::load( &b[ i ] ) ) );
+        for ( Dimension i = packed; i < dim; ++i )
+          r[ i ] = a[ i ] - b[ i ];
+      }
+
+      static void inf( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < packed; i += Lanes::size )
+          Lanes::store( &r[ i ], Lanes::inf( Lanes::load( &a[ i ] ), Lanes::load( &b[ i ] ) ) );
+        for ( Dimension i = packed; i < dim; ++i )
+          r[ i ] = std::min( a[ i ], b[ i ] );
+      }
+
+      static void sup( Container & r, const Container & a, const Container & b )
+      {
+        for ( Dimension i = 0; i < packed; i += Lanes::size )
+          Lanes::store( &r[ i ], Lanes::sup( Lanes::load( &a[ i ] ), Lanes::load( &b[ i ] ) ) );
+        for ( Dimension i = packed; i < dim; ++i )
+          r[ i ] = std::max( a[ i ], b[ i ] );
+      }
+
+      static bool isLower( const Container & a, const Container & b )
+      {
+        bool lower = true;
+        for ( Dimension i = 0; i < packed; i += Lanes::size )
+          lower = lower && ! Lanes::anyLess( Lanes::load( &b[ i ] ), Lanes::load( &a[ i ] ) );
+        for ( Dimension i = packed; i < dim; ++i )
+          lower = lower && ! ( b[ i ] < a[ i ] );
+        return lower;
+      }
+
+      static bool isUpper( const Container & a, const Container & b )
+      {
+        return PointVectorSSE2Kernel::isLower( b, a );
+      }
+    };
+
+    /**
+     * Floating-point components: products are computed by lanes, then
+     * summed in order, as in the generic kernel.
+     */
+    template <Dimension dim, typename TComponent>
+    struct PointVectorSSE2FloatingKernel
+      : public PointVectorSSE2Kernel<dim, TComponent>
+    {
+      typedef PointVectorSSE2Kernel<dim, TComponent> Base;
+      typedef typename Base::Component Component;
+      typedef typename Base::Container Container;
+      typedef typename Base::Lanes Lanes;
+
+      static Component dot( const Container & a, const Container & b )
+      {
+        Container p;
+        for ( Dimension i = 0; i < Base::packed; i += Lanes::size )
+          Lanes::store( &p[ i ], Lanes::times( Lanes::load( &a[ i ] ), Lanes::load( &b[ i ] ) ) );
+        for ( Dimension i = Base::packed; i < dim; ++i )
+          p[ i ] = a[ i ] * b[ i ];
+        Component d = NumberTraits<Component>::ZERO;
+        for ( Dimension i = 0; i < dim; ++i )
+          d += p[ i ];
+        return d;
+      }
+    };
+
+    template <Dimension dim>
+    struct PointVectorKernel<dim, double, std::array<double, dim> >
+      : public PointVectorSSE2FloatingKernel<dim, double>
+    {};
+
+    template <Dimension dim>
+    struct PointVectorKernel<dim, float, std::array<float, dim> >
+      : public PointVectorSSE2FloatingKernel<dim, float>
+    {};
+
+    template <Dimension dim>
+    struct PointVectorKernel<dim, DGtal::int32_t, std::array<DGtal::int32_t, dim> >
+      : public PointVectorSSE2Kernel<dim, DGtal::int32_t>
+    {};
+
+#endif // DGTAL_POINTVECTOR_SSE2
+
+  } // namespace detail
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointVectorKernel_h
+
+#undef PointVectorKernel_RECURSES
+#endif // else defined(PointVectorKernel_RECURSES)
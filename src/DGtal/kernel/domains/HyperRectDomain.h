@@ -42,12 +42,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/kernel/domains/HyperRectDomain_Iterator.h"
+#include "DGtal/kernel/domains/HyperRectDomain_ScanlineRange.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/base/CConstBidirectionalRange.h"
 
@@ -107,7 +109,13 @@ namespace DGtal
     typedef typename Space::Integer Integer;
     typedef typename Space::Vector Vector;
     typedef typename Space::Dimension Dimension;
-    typedef typename Space::Size Size;
+    /// Type used to represent sizes of the domain and linearized
+    /// indices of its points: 64 bits when coordinates are built-in
+    /// integers, whatever their width, so that huge domains of
+    /// 32-bit points can be counted and linearized without overflow.
+    typedef typename std::conditional< std::is_integral< typename Space::Size >::value,
+                                       DGtal::uint64_t,
+                                       typename Space::Size >::type Size;
     typedef typename Point::Coordinate Coordinate; // TODO REVOIR LES NOMS.... RECUPERER DANS SPACE
 
     BOOST_STATIC_CONSTANT(Dimension, dimension = Space::dimension); 
@@ -120,6 +128,10 @@ namespace DGtal
     
     typedef functors::IsWithinPointPredicate<Point> Predicate;
 
+    ///Typedef of the range of scanlines (runs along the first axis)
+    typedef HyperRectDomain_ScanlineRange<Point, Size> ConstScanlineRange;
+    typedef typename ConstScanlineRange::Scanline Scanline;
+
     /**
      * Default Constructor.
      */
@@ -539,7 +551,36 @@ namespace DGtal
       { 
         return ConstSubRange(*this, permutation, startingPoint);
       }
-    
+
+    /**
+     * Returns the range of the scanlines of the domain, i.e. its runs
+     * of points along the first axis, with the linear indices of
+     * their first points in the domain (as in Linearizer and
+     * ImageContainerBySTLVector).
+     *
+     * @return the scanline range of the domain.
+     * @see HyperRectDomain_ScanlineRange
+     */
+    ConstScanlineRange scanlines() const
+      {
+        return ConstScanlineRange( myLowerBound, myUpperBound, myLowerBound, myUpperBound );
+      }
+
+    /**
+     * Returns the range of the scanlines of the sub-domain
+     * [aLower,aUpper] intersected with the domain, with the linear
+     * indices of their first points in the domain.
+     *
+     * @param aLower the lower bound of the sub-domain.
+     * @param aUpper the upper bound of the sub-domain.
+     * @return the scanline range of the sub-domain.
+     */
+    ConstScanlineRange scanlines( const Point & aLower, const Point & aUpper ) const
+      {
+        return ConstScanlineRange( myLowerBound, myUpperBound,
+                                   aLower.sup( myLowerBound ), aUpper.inf( myUpperBound ) );
+      }
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -555,7 +596,7 @@ namespace DGtal
         typename Vector::ConstIterator it, itEnd; 
         for ( it = e.begin(), itEnd = e.end(); it != itEnd; ++it)
           {
-            res *= *it; 
+            res *= static_cast<Size>( *it );
           }
         return res; 
       }
@@ -221,24 +221,16 @@ namespace DGtal
     /**
      * Implements the next() method to scan the domain points dimension by dimension
      * (lexicographic order).
+     *
+     * The carry over the other coordinates, at the end of a row, is
+     * done by nextRow().
      **/
     void nextLexicographicOrder()
       {
         ++myPoint[0];
         if (( TPoint::dimension > 1 ) &&
             ( myPoint[0] > myupper[0] ) )
-          {
-            Dimension current_pos = 0;
-            do
-              {
-                myPoint[current_pos] = mylower[current_pos];
-                current_pos++;
-                if ( current_pos < TPoint::dimension )
-                  ++myPoint[current_pos];
-              }
-            while (( current_pos + 1 < TPoint::dimension ) &&
-                ( myPoint[ current_pos ]  >  myupper[ current_pos ] ) );
-          }
+          nextRow();
       }
 
     /**
@@ -264,24 +256,16 @@ namespace DGtal
     /**
      * Implements the prev() method to scan the domain points dimension by dimension
      * (lexicographic order).
+     *
+     * The carry over the other coordinates, at the beginning of a row,
+     * is done by prevRow().
      **/
     void prevLexicographicOrder()
       {
         --myPoint[0];
         if (( TPoint::dimension > 1 ) &&
             ( myPoint[0]  <  mylower[0] ) )
-          {
-            Dimension current_pos = 0;
-            do
-              {
-                myPoint[ current_pos ] = myupper[ current_pos ];
-                ++current_pos;
-                if ( current_pos < TPoint::dimension )
-                  --myPoint[ current_pos ];
-              }
-            while (( current_pos + 1 < TPoint::dimension ) &&
-                ( myPoint[ current_pos ]  <  mylower[ current_pos ] ) );
-          }
+          prevRow();
       }
 
     /**
@@ -305,6 +289,42 @@ namespace DGtal
       }
 
   private:
+    /**
+     * Moves the point from after the end of its row to the beginning
+     * of the next row.
+     **/
+    void nextRow()
+      {
+        Dimension current_pos = 0;
+        do
+          {
+            myPoint[current_pos] = mylower[current_pos];
+            current_pos++;
+            if ( current_pos < TPoint::dimension )
+              ++myPoint[current_pos];
+          }
+        while (( current_pos + 1 < TPoint::dimension ) &&
+            ( myPoint[ current_pos ]  >  myupper[ current_pos ] ) );
+      }
+
+    /**
+     * Moves the point from before the beginning of its row to the end
+     * of the previous row.
+     **/
+    void prevRow()
+      {
+        Dimension current_pos = 0;
+        do
+          {
+            myPoint[ current_pos ] = myupper[ current_pos ];
+            ++current_pos;
+            if ( current_pos < TPoint::dimension )
+              --myPoint[ current_pos ];
+          }
+        while (( current_pos + 1 < TPoint::dimension ) &&
+            ( myPoint[ current_pos ]  <  mylower[ current_pos ] ) );
+      }
+
     ///Current Point in the domain
     TPoint myPoint;
     ///Copies of the Domain limits
@@ -0,0 +1,373 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HyperRectDomain_ScanlineRange.h
+ * @author DGtal team
+ *
+ * @date 2016/11/21
+ *
+ * Header file for classes HyperRectDomain_Scanline and
+ * HyperRectDomain_ScanlineRange.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HyperRectDomain_ScanlineRange_RECURSES)
+#error Recursive header files inclusion detected in HyperRectDomain_ScanlineRange.h
+#else // defined(HyperRectDomain_ScanlineRange_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HyperRectDomain_ScanlineRange_RECURSES
+
+#if !defined HyperRectDomain_ScanlineRange_h
+/** Prevents repeated inclusion of headers. */
+#define HyperRectDomain_ScanlineRange_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // struct HyperRectDomain_Scanline
+  /**
+   * Description of struct 'HyperRectDomain_Scanline' <p>
+   * Aim: A run of consecutive points along the first axis of a
+   * HyperRectDomain, i.e. the points start + i * e_0 for i in
+   * [0,length), together with the linear index of @a start in a
+   * reference domain (first axis varying fastest, as in
+   * ImageContainerBySTLVector). The i-th point of the run has index
+   * offset + i.
+   */
+  template <typename TPoint, typename TSize>
+  struct HyperRectDomain_Scanline
+  {
+    /// First point of the run.
+    TPoint start;
+    /// Number of points of the run.
+    TSize length;
+    /// Linear index of the first point in the reference domain.
+    TSize offset;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class HyperRectDomain_ScanlineRange
+  /**
+   * Description of class 'HyperRectDomain_ScanlineRange' <p>
+   * Aim: The range of the scanlines (see HyperRectDomain_Scanline)
+   * of a box [lower,upper] included in a reference box, in
+   * lexicographic order. Points of a domain are then scanned with
+   * plain integer increments along each scanline:
+   *
+   * @code
+   * for ( auto const & line : domain.scanlines() )
+   *   {
+   *     Point p = line.start;
+   *     for ( Size i = 0; i < line.length; ++i, ++p[ 0 ] )
+   *       data[ line.offset + i ] = f( p );
+   *   }
+   * @endcode
+   *
+   * Scanlines are also accessed by their index in [0,size()), so that
+   * the range can be partitioned for parallel processing, e.g. with
+   * OpenMP over the indices or with part(), which splits the range in
+   * consecutive parts of balanced sizes.
+   *
+   * @tparam TPoint the point type.
+   * @tparam TSize the type of sizes and linear indices.
+   *
+   * @see HyperRectDomain::scanlines
+   */
+  template <typename TPoint, typename TSize>
+  class HyperRectDomain_ScanlineRange
+  {
+  public:
+    typedef TPoint Point;
+    typedef TSize Size;
+    typedef typename TPoint::Dimension Dimension;
+    typedef typename TPoint::Coordinate Coordinate;
+    typedef HyperRectDomain_Scanline<TPoint, TSize> Scanline;
+    BOOST_STATIC_CONSTANT( Dimension, dimension = TPoint::dimension );
+
+    /**
+     * Forward iterator on the scanlines of the range. Moving to the
+     * next scanline increments the second coordinate and the offset,
+     * the other coordinates being carried only at the end of a plane.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Scanline value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Scanline* pointer;
+      typedef const Scanline& reference;
+
+      ConstIterator()
+        : myRange( 0 ), myIndex( 0 )
+      {}
+
+      ConstIterator( const HyperRectDomain_ScanlineRange & aRange, Size anIndex )
+        : myRange( &aRange ), myIndex( anIndex )
+      {
+        if ( anIndex < aRange.size() )
+          myScanline = aRange[ anIndex ];
+      }
+
+      const Scanline & operator*() const
+      {
+        return myScanline;
+      }
+
+      const Scanline * operator->() const
+      {
+        return &myScanline;
+      }
+
+      /// @return the index of the scanline in the range.
+      Size index() const
+      {
+        return myIndex;
+      }
+
+      ConstIterator & operator++()
+      {
+        ++myIndex;
+        if ( dimension > 1 )
+          {
+            ++myScanline.start[ 1 ];
+            myScanline.offset += myRange->myStride[ 1 ];
+            if ( myScanline.start[ 1 ] > myRange->myUpper[ 1 ] )
+              nextPlane();
+          }
+        return *this;
+      }
+
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp = *this;
+        operator++();
+        return tmp;
+      }
+
+      bool operator==( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      bool operator!=( const ConstIterator & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+    private:
+      /// Carries the coordinates 1, 2, ... when leaving a plane.
+      void nextPlane()
+      {
+        for ( Dimension k = 1; k + 1 < dimension
+                && myScanline.start[ k ] > myRange->myUpper[ k ]; ++k )
+          {
+            myScanline.offset -= myRange->myStride[ k ]
+              * static_cast<Size>( myRange->myUpper[ k ] - myRange->myLower[ k ] + 1 );
+            myScanline.start[ k ] = myRange->myLower[ k ];
+            ++myScanline.start[ k + 1 ];
+            myScanline.offset += myRange->myStride[ k + 1 ];
+          }
+      }
+
+      /// The range.
+      const HyperRectDomain_ScanlineRange * myRange;
+      /// The index of the current scanline.
+      Size myIndex;
+      /// The current scanline.
+      Scanline myScanline;
+    }; // End of class ConstIterator
+
+    typedef ConstIterator Iterator;
+
+    /**
+     * Constructor.
+     * @param aReferenceLower the lower bound of the reference domain.
+     * @param aReferenceUpper the upper bound of the reference domain.
+     * @param aLower the lower bound of the scanned box.
+     * @param aUpper the upper bound of the scanned box, which is empty
+     * if some coordinate of @a aUpper is lower than the one of @a aLower.
+     *
+     * The scanned box must be included in the reference domain.
+     */
+    HyperRectDomain_ScanlineRange( const Point & aReferenceLower, const Point & aReferenceUpper,
+                                   const Point & aLower, const Point & aUpper )
+      : myLower( aLower ), myUpper( aUpper ), myNbScanlines( 1 ), myLength( 0 ),
+        myOrigin( 0 )
+    {
+      for ( Dimension k = 0; k < dimension; ++k )
+        {
+          myStride[ k ] = k == 0 ? Size( 1 ) : myStride[ k - 1 ]
+            * static_cast<Size>( aReferenceUpper[ k - 1 ] - aReferenceLower[ k - 1 ] + 1 );
+          if ( aUpper[ k ] < aLower[ k ] )
+            myNbScanlines = 0;
+          else if ( k > 0 )
+            myNbScanlines *= static_cast<Size>( aUpper[ k ] - aLower[ k ] + 1 );
+          myOrigin += static_cast<Size>( aLower[ k ] - aReferenceLower[ k ] ) * myStride[ k ];
+        }
+      if ( myNbScanlines > 0 )
+        myLength = static_cast<Size>( aUpper[ 0 ] - aLower[ 0 ] + 1 );
+    }
+
+    /// @return the number of scanlines.
+    Size size() const
+    {
+      return myNbScanlines;
+    }
+
+    /// @return 'true' if the range has no scanline.
+    bool empty() const
+    {
+      return myNbScanlines == 0;
+    }
+
+    /// @return the number of points of each scanline.
+    Size length() const
+    {
+      return myLength;
+    }
+
+    /// @return the lower bound of the scanned box.
+    const Point & lowerBound() const
+    {
+      return myLower;
+    }
+
+    /// @return the upper bound of the scanned box.
+    const Point & upperBound() const
+    {
+      return myUpper;
+    }
+
+    /**
+     * @param anIndex an index in [0,size()).
+     * @return the scanline of index @a anIndex, scanlines being
+     * ordered lexicographically on their coordinates 1, 2, ...
+     */
+    Scanline operator[]( Size anIndex ) const
+    {
+      ASSERT( anIndex < myNbScanlines );
+      Scanline s;
+      s.start = myLower;
+      s.length = myLength;
+      s.offset = myOrigin;
+      for ( Dimension k = 1; k < dimension; ++k )
+        {
+          const Size extent = static_cast<Size>( myUpper[ k ] - myLower[ k ] + 1 );
+          const Size c = anIndex % extent;
+          anIndex /= extent;
+          s.start[ k ] += static_cast<Coordinate>( c );
+          s.offset += c * myStride[ k ];
+        }
+      return s;
+    }
+
+    /**
+     * @param aPart an index in [0,nbParts).
+     * @param nbParts the number of parts (positive).
+     * @return the indices [first,last) of the scanlines of the part
+     * @a aPart, when splitting the range in @a nbParts consecutive
+     * parts whose sizes differ by at most one.
+     */
+    std::pair<Size, Size> part( Size aPart, Size nbParts ) const
+    {
+      ASSERT( aPart < nbParts );
+      const Size q = myNbScanlines / nbParts;
+      const Size r = myNbScanlines % nbParts;
+      const Size first = aPart * q + ( aPart < r ? aPart : r );
+      return std::make_pair( first, first + q + ( aPart < r ? 1 : 0 ) );
+    }
+
+    /// @return an iterator on the first scanline.
+    ConstIterator begin() const
+    {
+      return ConstIterator( *this, 0 );
+    }
+
+    /**
+     * @param anIndex an index in [0,size()].
+     * @return an iterator on the scanline of index @a anIndex.
+     */
+    ConstIterator begin( Size anIndex ) const
+    {
+      return ConstIterator( *this, anIndex );
+    }
+
+    /// @return the iterator after the last scanline.
+    ConstIterator end() const
+    {
+      return ConstIterator( *this, myNbScanlines );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const
+    {
+      out << "[HyperRectDomain_ScanlineRange " << myLower << " " << myUpper
+          << " nb=" << myNbScanlines << " length=" << myLength << "]";
+    }
+
+  private:
+    /// The lower bound of the scanned box.
+    Point myLower;
+    /// The upper bound of the scanned box.
+    Point myUpper;
+    /// The strides of the reference domain.
+    Size myStride[ dimension ];
+    /// The number of scanlines.
+    Size myNbScanlines;
+    /// The number of points of each scanline.
+    Size myLength;
+    /// The linear index of myLower in the reference domain.
+    Size myOrigin;
+  }; // End of class HyperRectDomain_ScanlineRange
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HyperRectDomain_ScanlineRange'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HyperRectDomain_ScanlineRange' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TSize>
+  std::ostream&
+  operator<< ( std::ostream & out, const HyperRectDomain_ScanlineRange<TPoint, TSize> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} //namespace
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HyperRectDomain_ScanlineRange_h
+
+#undef HyperRectDomain_ScanlineRange_RECURSES
+#endif // else defined(HyperRectDomain_ScanlineRange_RECURSES)
@@ -84,6 +84,11 @@ namespace DGtal
    *
    * The storage order can be specified by template (default is colum-major ordered).
    *
+   * Indices are computed with the domain size type (see
+   * HyperRectDomain::Size), which is 64 bits wide even for 32-bit
+   * coordinates: domains with more than 2^32 points are supported
+   * without changing the point type.
+   *
    * Example:
    * @code
    * typedef SpaceND<2>             Space;
@@ -110,7 +115,7 @@ namespace DGtal
       typedef HyperRectDomain<TSpace> Domain; ///< The domain type.
       typedef typename TSpace::Point Point;   ///< The point type.
       typedef Point Extent;                   ///< The domain's extent type.
-      typedef typename TSpace::Size  Size;    ///< The space's size type.
+      typedef typename Domain::Size  Size;    ///< The linearized index type (64 bits, independent of the coordinate type).
 
       /** Linearized index of a point, given the domain lower-bound and extent.
        *
@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial.h
+ * @author DGtal team
+ *
+ * @date 2016/11/14
+ *
+ * Header file for template class CompiledMPolynomial
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial.h
+#else // defined(CompiledMPolynomial_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial_RECURSES
+
+#if !defined CompiledMPolynomial_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial
+  /**
+     Description of template class 'CompiledMPolynomial' <p>
+     \brief Aim: A flat, read-only copy of a multivariate polynomial
+     (see MPolynomial), for evaluating it quickly at many points.
+
+     An MPolynomial in \e n variables is a tree of polynomials: its
+     coefficients are polynomials in \e n - 1 variables, and so on.
+     The compiled polynomial stores this tree level by level in flat
+     arrays: a node of level \e l is the range of its coefficients in
+     level \e l + 1, the nodes of the last level being ranges in a
+     single array of ring coefficients. Evaluation is a nested Horner
+     scheme over these arrays, unrolled at compile time, without any
+     temporary polynomial nor virtual call.
+
+     Besides evaluation at a point, the polynomial may be evaluated
+     along a whole line parallel to an axis (see evaluateLine()): it
+     is first restricted to this line, then evaluated at regularly
+     spaced points with forward differences (one addition per degree
+     and per point). Forward differences are restarted from exact
+     values every AnchorPeriod points, which bounds the accumulation
+     of rounding errors.
+
+     Values may differ from the ones of MPolynomial in the last bits,
+     since MPolynomial evaluates sums of powers instead of Horner
+     schemes.
+
+     @code
+     MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 ) + ...;
+     CompiledMPolynomial<3, double> C( P );
+     double v = C( Z3i::RealPoint( 0.5, 1.0, 2.0 ) );
+     std::vector<double> values( 100 );
+     C.evaluateLine( Z3i::RealPoint( -5.0, 1.0, 2.0 ), 0, 0.1, 100, &values[ 0 ] );
+     @endcode
+
+     @tparam n the number of variables or indeterminates.
+     @tparam TRing the type of the coefficients and of the values,
+     generally float or double.
+  */
+  template < int n, typename TRing >
+  class CompiledMPolynomial
+  {
+    BOOST_STATIC_ASSERT(( n >= 1 ));
+
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef CompiledMPolynomial<n, TRing> Self;
+    typedef TRing Ring;
+    /// The index of a node or of a coefficient.
+    typedef DGtal::uint32_t Index;
+    /// The range [first,second) of the coefficients of a node in the next level.
+    typedef std::pair<Index, Index> Range;
+
+    /// Forward differences are restarted every AnchorPeriod points in evaluateLine().
+    static const std::size_t AnchorPeriod = 32;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Default constructor. The compiled polynomial is zero.
+    */
+    CompiledMPolynomial();
+
+    /**
+       Constructor. Compiles the given polynomial.
+       @tparam TAlloc the allocator of the polynomial.
+       @param p any polynomial in n variables.
+    */
+    template <typename TAlloc>
+    CompiledMPolynomial( const MPolynomial<n, Ring, TAlloc> & p );
+
+    /**
+       Compiles the given polynomial.
+       @tparam TAlloc the allocator of the polynomial.
+       @param p any polynomial in n variables.
+    */
+    template <typename TAlloc>
+    void init( const MPolynomial<n, Ring, TAlloc> & p );
+
+    /**
+       @param k any variable in 0..n-1.
+       @return the degree of the polynomial in the variable @a k (-1
+       for the zero polynomial).
+    */
+    int degree( Dimension k ) const;
+
+    /**
+       @return the number of stored coefficients.
+    */
+    std::size_t size() const;
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+       @tparam TPoint any point type with n coordinates accessible
+       with operator[] and convertible to Ring.
+       @param x any point.
+       @return the value of the polynomial at @a x.
+    */
+    template <typename TPoint>
+    Ring operator()( const TPoint & x ) const;
+
+    /**
+       Restricts the polynomial to the line passing through @a origin
+       and parallel to axis @a axis: the result is a polynomial in the
+       variable @a axis, the other variables being fixed to the
+       coordinates of @a origin.
+
+       @tparam TPoint any point type with n coordinates.
+       @param origin any point of the line.
+       @param axis the variable of the restriction.
+       @param[out] coefs the coefficients of the restriction, by
+       increasing degree (degree( axis ) + 1 coefficients).
+    */
+    template <typename TPoint>
+    void restriction( const TPoint & origin, Dimension axis,
+                      std::vector<Ring> & coefs ) const;
+
+    /**
+       Evaluates the polynomial at the points origin + i * step *
+       e_axis, for i in [0,count).
+
+       @tparam TPoint any point type with n coordinates.
+       @param origin the first point.
+       @param axis the direction of the line.
+       @param step the distance between two consecutive points.
+       @param count the number of points.
+       @param[out] values a pointer on (at least) @a count values.
+    */
+    template <typename TPoint>
+    void evaluateLine( const TPoint & origin, Dimension axis, Ring step,
+                       std::size_t count, Ring * values ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The nodes of each level, level 0 having a single node.
+    std::vector<Range> myRanges[ n ];
+    /// The coefficients of the nodes of the last level.
+    std::vector<Ring> myCoefficients;
+    /// The degree of the polynomial in each variable.
+    int myDegrees[ n ];
+
+  }; // end of class CompiledMPolynomial
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial' to write.
+   * @return the output stream after the writing.
+   */
+  template <int n, typename TRing>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial<n, TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial_h
+
+#undef CompiledMPolynomial_RECURSES
+#endif // else defined(CompiledMPolynomial_RECURSES)
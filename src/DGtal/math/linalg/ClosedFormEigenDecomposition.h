@@ -0,0 +1,220 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ClosedFormEigenDecomposition.h
+ * @author DGtal team
+ *
+ * @date 2016/11/10
+ *
+ * This file provides the closed-form eigen decomposition of 2x2 and
+ * 3x3 real symmetric matrices, one at a time or by batches.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ClosedFormEigenDecomposition_RECURSES)
+#error Recursive header files inclusion detected in ClosedFormEigenDecomposition.h
+#else // defined(ClosedFormEigenDecomposition_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ClosedFormEigenDecomposition_RECURSES
+
+#if !defined ClosedFormEigenDecomposition_h
+/** Prevents repeated inclusion of headers. */
+#define ClosedFormEigenDecomposition_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Closed-form eigen solver of a real symmetric NxN matrix given by
+     * its upper triangle, only specialized for N=2 and N=3.
+     *
+     * @tparam N the size of the matrix.
+     * @tparam TComponent a floating-point type.
+     */
+    template <DGtal::Dimension N, typename TComponent>
+    struct SymmetricEigenKernel;
+
+    /**
+     * Closed-form eigen solver of a real symmetric 2x2 matrix.
+     */
+    template <typename TComponent>
+    struct SymmetricEigenKernel<2, TComponent>
+    {
+      /**
+       * @param[in] a the coefficients a00, a01, a11.
+       * @param[out] values the eigenvalues, in ascending order.
+       * @param[out] vectors the eigenvectors, vectors[ 2*j + i ] being
+       * the i-th component of the eigenvector of values[ j ].
+       */
+      static void solve( const TComponent a[ 3 ],
+                         TComponent values[ 2 ], TComponent vectors[ 4 ] );
+    };
+
+    /**
+     * Closed-form eigen solver of a real symmetric 3x3 matrix, using
+     * the trigonometric solution of the characteristic polynomial and
+     * a robust computation of the eigenvectors (D. Eberly, "A Robust
+     * Eigensolver for 3x3 Symmetric Matrices", Geometric Tools, 2014).
+     */
+    template <typename TComponent>
+    struct SymmetricEigenKernel<3, TComponent>
+    {
+      /**
+       * @param[in] a the coefficients a00, a01, a02, a11, a12, a22.
+       * @param[out] values the eigenvalues, in ascending order.
+       * @param[out] vectors the eigenvectors, vectors[ 3*j + i ] being
+       * the i-th component of the eigenvector of values[ j ].
+       */
+      static void solve( const TComponent a[ 6 ],
+                         TComponent values[ 3 ], TComponent vectors[ 9 ] );
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ClosedFormEigenDecomposition
+  /**
+   * Description of template class 'ClosedFormEigenDecomposition' <p>
+   * \brief Aim: This class provides methods to compute the eigen
+   * decomposition of a 2x2 or 3x3 real symmetric matrix in closed
+   * form, i.e. without iterations. It is a faster replacement of
+   * EigenDecomposition for covariance matrices in dimension 2 and 3,
+   * with the same interface.
+   *
+   * Eigenvalues are the roots of the characteristic polynomial,
+   * computed with trigonometric formulas after scaling the matrix by
+   * its largest coefficient. Eigenvectors are computed robustly, even
+   * for multiple eigenvalues, as cross products of the rows of A -
+   * lambda I and by solving a 2x2 system in the orthogonal complement
+   * of the first eigenvector.
+   *
+   * It also provides a batched interface getEigenDecompositions(),
+   * processing many matrices stored as a structure of arrays (one
+   * array per coefficient), in parallel with OpenMP.
+   *
+   * This class provides static services and is not really supposed to
+   * be instantiated.
+   *
+   * @code
+   * typedef ClosedFormEigenDecomposition<3,double> LinearAlgebraTool;
+   * LinearAlgebraTool::Matrix A; // some symmetric matrix
+   * LinearAlgebraTool::Matrix V;
+   * LinearAlgebraTool::Vector d;
+   * LinearAlgebraTool::getEigenDecomposition( A, V, d );
+   * @endcode
+   *
+   * @tparam TN the size TN of the matrix TN x TN, 2 or 3.
+   *
+   * @tparam TComponent the type of each component of the matrix,
+   * should be some double or float type.
+   *
+   * @tparam TMatrix a model of CMatrix, for instance SimpleMatrix.
+   *
+   * @see EigenDecomposition
+   */
+  template  <DGtal::Dimension TN, typename TComponent, typename TMatrix=SimpleMatrix<TComponent, TN, TN> >
+  class ClosedFormEigenDecomposition
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CEuclideanRing<TComponent> ));
+    BOOST_STATIC_ASSERT(( TN == 2 || TN == 3 ));
+
+    // ----------------------- Public types -----------------------------------
+  public:
+    typedef TComponent Component;                    ///< the type of each coefficient, i.e. scalar
+    static const DGtal::Dimension M = TN;
+    static const DGtal::Dimension N = TN;
+    typedef Component                   Quantity;    ///< the type of scalar (i.e. Component)
+    typedef PointVector<N,Component>    RowVector;   ///< the type for row vectors (1xN)
+    typedef PointVector<M,Component>    ColumnVector;///< the type for column vectors (Nx1)
+    typedef ColumnVector                Vector;      ///< an alias for column vectors (Nx1)
+    typedef TMatrix Matrix;      ///< the type for matrices (NxN)
+
+    // ----------------------- Static constants ------------------------------
+  public:
+    /// Usual static constant for dimension.
+    static const DGtal::Dimension dimension = TN;
+    /// Static constant for dimension - 1.
+    static const DGtal::Dimension dimensionMinusOne = TN - 1;
+    /// Number of coefficients of the upper triangle of a matrix.
+    static const DGtal::Dimension nbCoefficients = TN * ( TN + 1 ) / 2;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * \brief Compute both eigen vectors and eigen values from an
+     * input symmetric matrix (only its upper triangle is read).
+     *
+     * @param[in]  matrix        matrix whose eigen values/vectors are computed (size = dimension * dimension).
+     * @param[out] eigenVectors  matrix of eigenvectors (size = dimension * dimension). Eigenvectors are put in column.
+     * @param[out] eigenValues   vector of eigenvalues (size = dimension), sorted in ascending order (smallest to highest).
+     */
+    static void getEigenDecomposition( const Matrix& matrix, Matrix& eigenVectors, Vector& eigenValues );
+
+    /**
+     * \brief Compute eigen values and vectors of \a n symmetric
+     * matrices given as a structure of arrays.
+     *
+     * The upper triangles of the matrices are read row by row from
+     * the nbCoefficients arrays \a coefficients, i.e. (a00, a01, a11)
+     * in 2D and (a00, a01, a02, a11, a12, a22) in 3D: coefficients[ c ][ k ]
+     * is the c-th coefficient of the k-th matrix. Matrices are
+     * processed in parallel when OpenMP is available.
+     *
+     * @param[in] n the number of matrices.
+     * @param[in] coefficients nbCoefficients arrays of size \a n.
+     * @param[out] eigenValues dimension arrays of size \a n,
+     * eigenValues[ j ][ k ] is the j-th eigenvalue (in ascending order)
+     * of the k-th matrix.
+     * @param[out] eigenVectors dimension*dimension arrays of size \a n,
+     * eigenVectors[ dimension*j + i ][ k ] is the i-th component of the j-th
+     * eigenvector of the k-th matrix. May be 0 when only eigenvalues
+     * are needed.
+     */
+    static void getEigenDecompositions( std::size_t n,
+                                        const Component * const * coefficients,
+                                        Component * const * eigenValues,
+                                        Component * const * eigenVectors );
+
+  }; // end of class ClosedFormEigenDecomposition
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/linalg/ClosedFormEigenDecomposition.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ClosedFormEigenDecomposition_h
+
+#undef ClosedFormEigenDecomposition_RECURSES
+#endif // else defined(ClosedFormEigenDecomposition_RECURSES)
@@ -0,0 +1,454 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BoundaryMesher.h
+ * @author DGtal team
+ *
+ * @date 2016/11/04
+ *
+ * Header file for module BoundaryMesher.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BoundaryMesher_RECURSES)
+#error Recursive header files inclusion detected in BoundaryMesher.h
+#else // defined(BoundaryMesher_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BoundaryMesher_RECURSES
+
+#if !defined BoundaryMesher_h
+/** Prevents repeated inclusion of headers. */
+#define BoundaryMesher_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    template <typename TMesher, typename TSource>
+    struct BoundaryMesherVoxelCollector;
+    template <typename TMesher, typename TKSpace>
+    struct BoundaryMesherSurfelCollector;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BoundaryMesher
+  /**
+   * Description of template class 'BoundaryMesher' <p> \brief Aim:
+   * Builds the indexed surface mesh of the boundary of a 3D digital
+   * object (given by a point predicate, by an image and an iso value,
+   * or by a digital surface) in parallel.
+   *
+   * Three kinds of meshes are produced:
+   *
+   * - PRIMAL_QUADS: one quad per boundary surfel, whose vertices are
+   *   the pointels of the surfel (the classical blocky boundary);
+   * - PRIMAL_TRIANGLES: the same surface where each quad is split in
+   *   two triangles;
+   * - DUAL_TRIANGLES: one vertex per boundary surfel and, around each
+   *   pointel, the polygons joining the surfels incident to it,
+   *   triangulated as fans (a marching-cubes like surface). When
+   *   several polygons are possible at a pointel, they are chosen
+   *   according to the interior or exterior surfel adjacency (see
+   *   SurfelAdjacency). With an image, each vertex is linearly
+   *   interpolated between the two voxel centers at the iso value (as
+   *   ImageLinearCellEmbedder does), otherwise it is the surfel
+   *   center.
+   *
+   * Voxels outside the domain are considered as outside the object,
+   * so the resulting mesh is always closed. Faces are oriented so that
+   * their normals (right-hand rule) point toward the exterior.
+   *
+   * The domain is cut along the last axis into slabs of constant
+   * thickness which are processed independently (with OpenMP if
+   * available). Each vertex belongs to one slab, which deduplicates
+   * it with its own hash map; a slab only refers to its own vertices
+   * and to the ones of the previous slab. Vertex indices are then
+   * obtained by a prefix sum over the slabs. The result only depends
+   * on the slab thickness, not on the number of threads.
+   *
+   * Meshes may be built in memory (Mesh or CompactMesh, whose vertex
+   * type is built from the three real coordinates) or streamed to an
+   * OFF file chunk by chunk, without ever storing the whole mesh.
+   *
+   * @code
+   * BoundaryMesher<Z3i::Space> mesher( domain, BoundaryMesher<Z3i::Space>::DUAL_TRIANGLES );
+   * Mesh<Z3i::RealPoint> mesh;
+   * mesher.makeMesh( mesh, image, 128.0 );       // voxels above 128 are inside
+   * mesher.exportOFF( "surface.off", image, 128.0 ); // streaming export
+   * @endcode
+   *
+   * @tparam TSpace a 3D digital space (a model of CSpace).
+   *
+   * @see Mesh CompactMesh Surfaces ImageLinearCellEmbedder
+   */
+  template <typename TSpace>
+  class BoundaryMesher
+  {
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+
+    // ----------------------- associated types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Integer Integer;
+    typedef HyperRectDomain<Space> Domain;
+    typedef PointVector<3, double> RealPoint;
+    /// Type of the vertex keys (linearized Khalimsky coordinates).
+    typedef DGtal::uint64_t Key;
+
+    /// The kind of mesh that is built.
+    enum MeshKind { PRIMAL_QUADS, PRIMAL_TRIANGLES, DUAL_TRIANGLES };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the domain of the object (outside voxels are
+     * considered as exterior).
+     * @param aKind the kind of mesh to build.
+     * @param interiorAdjacency when 'true' (resp. 'false'), the dual
+     * polygons follow the interior (resp. exterior) surfel adjacency.
+     * @param slabThickness the number of voxel layers of each slab (>0).
+     */
+    BoundaryMesher( const Domain & aDomain,
+                    MeshKind aKind = PRIMAL_QUADS,
+                    bool interiorAdjacency = true,
+                    Integer slabThickness = 8 );
+
+    /**
+     * Destructor.
+     */
+    ~BoundaryMesher();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Sets the number of slabs processed at once in streaming mode,
+     * which bounds the memory used by exportOFF.
+     *
+     * @param nb the number of slabs per chunk (>0).
+     */
+    void setSlabsPerChunk( unsigned int nb );
+
+    /**
+     * @return the number of slabs the domain is cut into.
+     */
+    std::size_t nbSlabs() const;
+
+    /**
+     * @return the number of vertices of each face of the built meshes.
+     */
+    unsigned int faceSize() const;
+
+    /**
+     * Builds the mesh of the boundary of the set of points satisfying
+     * a predicate.
+     *
+     * @tparam TMesh either Mesh or CompactMesh.
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param[out] aMesh the mesh where vertices and faces are added.
+     * @param aPredicate the characteristic function of the object.
+     */
+    template <typename TMesh, typename TPointPredicate>
+    void makeMesh( TMesh & aMesh, const TPointPredicate & aPredicate ) const;
+
+    /**
+     * Builds the mesh of the boundary of the set of voxels whose
+     * value is strictly greater than @a isoValue. In dual mode,
+     * vertices are interpolated at the iso value.
+     *
+     * @tparam TMesh either Mesh or CompactMesh.
+     * @tparam TImage a model of concepts::CConstImage with scalar values.
+     * @param[out] aMesh the mesh where vertices and faces are added.
+     * @param anImage the image.
+     * @param isoValue the iso value.
+     */
+    template <typename TMesh, typename TImage>
+    void makeMesh( TMesh & aMesh, const TImage & anImage,
+                   double isoValue ) const;
+
+    /**
+     * Builds the primal mesh (quads or triangles) of a digital surface
+     * whose surfels are oriented as in Surfaces::sMakeBoundary (the
+     * direct incident spel is the interior one) and lie within the
+     * domain. The dual kind is not available for this input: an
+     * InputException is thrown if the mesher was built with
+     * DUAL_TRIANGLES.
+     *
+     * @tparam TMesh either Mesh or CompactMesh.
+     * @tparam TDigitalSurface a DigitalSurface type.
+     * @param[out] aMesh the mesh where vertices and faces are added.
+     * @param aSurface the digital surface.
+     */
+    template <typename TMesh, typename TDigitalSurface>
+    void makeSurfaceMesh( TMesh & aMesh, const TDigitalSurface & aSurface ) const;
+
+    /**
+     * Streams the mesh of the boundary of the set of points satisfying
+     * a predicate to an OFF file. Vertices are written as soon as a
+     * chunk of slabs is done, faces go through a temporary file
+     * (filename.faces) appended at the end.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param filename the name of the OFF file.
+     * @param aPredicate the characteristic function of the object.
+     * @return 'true' if the file was written.
+     */
+    template <typename TPointPredicate>
+    bool exportOFF( const std::string & filename,
+                    const TPointPredicate & aPredicate ) const;
+
+    /**
+     * Streams the iso-surface mesh of an image to an OFF file (see
+     * makeMesh and exportOFF).
+     *
+     * @tparam TImage a model of concepts::CConstImage with scalar values.
+     * @param filename the name of the OFF file.
+     * @param anImage the image.
+     * @param isoValue the iso value.
+     * @return 'true' if the file was written.
+     */
+    template <typename TImage>
+    bool exportOFF( const std::string & filename, const TImage & anImage,
+                    double isoValue ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The domain.
+    Domain myDomain;
+    /// The kind of mesh.
+    MeshKind myKind;
+    /// The surfel adjacency of dual polygons.
+    bool myInteriorAdjacency;
+    /// The slab thickness.
+    Integer mySlabThickness;
+    /// The number of slabs per chunk in streaming mode.
+    unsigned int mySlabsPerChunk;
+    /// The extent of the domain.
+    Point myExtent;
+    /// The number of Khalimsky coordinates along x and y.
+    Key myKx, myKy;
+    /// The triangles of each configuration around a pointel.
+    std::vector<unsigned char> myDualTriangles;
+    /// The offsets of each configuration in myDualTriangles.
+    std::vector<unsigned int> myDualOffsets;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    BoundaryMesher();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BoundaryMesher ( const BoundaryMesher & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BoundaryMesher & operator= ( const BoundaryMesher & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    template <typename TMesher, typename TSource>
+    friend struct detail::BoundaryMesherVoxelCollector;
+    template <typename TMesher, typename TKSpace>
+    friend struct detail::BoundaryMesherSurfelCollector;
+
+    /**
+     * The data gathered for one slab.
+     */
+    struct SlabData
+    {
+      /// Vertex keys of the faces (faceSize() keys per face).
+      std::vector<Key> faceKeys;
+      /// Global vertex indices of the faces, once resolved.
+      std::vector<unsigned int> faceIndices;
+      /// Positions of the vertices owned by the slab.
+      std::vector<RealPoint> points;
+      /// Local index of the vertices owned by the slab.
+      std::unordered_map<Key, unsigned int> index;
+      /// Vertices referenced by the slab but owned by the previous one.
+      std::unordered_map<Key, RealPoint> foreign;
+      /// Global index of the first vertex owned by the slab.
+      std::size_t offset;
+      /// Formatted vertices and faces (streaming mode).
+      std::string vertexText, faceText;
+    };
+
+    /**
+     * @param slab a slab index.
+     * @return the first voxel layer (relative to the domain) of the slab.
+     */
+    Integer slabBegin( std::size_t slab ) const;
+
+    /**
+     * @param slab a slab index.
+     * @return the voxel layer after the last one of the slab.
+     */
+    Integer slabEnd( std::size_t slab ) const;
+
+    /**
+     * @param key a vertex key.
+     * @return the slab owning the vertex.
+     */
+    std::size_t ownerSlab( Key key ) const;
+
+    /**
+     * @param kx the relative Khalimsky coordinates of a cell.
+     * @param ky the relative Khalimsky coordinates of a cell.
+     * @param kz the relative Khalimsky coordinates of a cell.
+     * @return its key.
+     */
+    Key key( Key kx, Key ky, Key kz ) const;
+
+    /**
+     * Adds a face (given by the keys and positions of its vertices) to
+     * the slab @a slab.
+     *
+     * @param data the slab data.
+     * @param slab the slab index.
+     * @param keys the vertex keys.
+     * @param points the vertex positions.
+     * @param n the number of vertices.
+     */
+    void addFace( SlabData & data, std::size_t slab, const Key * keys,
+                  const RealPoint * points, unsigned int n ) const;
+
+    /**
+     * Adds the primal face(s) of the surfel between the voxel @a a
+     * and its successor along axis @a k to the slab @a slab.
+     *
+     * @param data the slab data.
+     * @param slab the slab index.
+     * @param a the voxel coordinates (relative to the domain).
+     * @param k the axis orthogonal to the surfel.
+     * @param insideA 'true' if @a a is the interior voxel.
+     */
+    void addPrimalFace( SlabData & data, std::size_t slab, const Integer * a,
+                        Dimension k, bool insideA ) const;
+
+    /**
+     * @param config a configuration of the 8 voxels around a pointel.
+     * @return the first index in myDualTriangles of the triangles of
+     * this configuration (triangles up to dualBegin( config + 1 )).
+     */
+    unsigned int dualBegin( unsigned int config ) const;
+
+    /**
+     * @return the dual triangle table: triples of local surfel ids.
+     * The surfel id 4k+bi+2bj is the one orthogonal to axis k, at
+     * the offsets bi and bj along the axes (k+1)%3 and (k+2)%3.
+     */
+    const std::vector<unsigned char> & dualTriangles() const;
+
+    /// Computes the dual triangle table.
+    void initDualTable();
+
+    /**
+     * Processes the slabs: gathers the faces with @a collector, then
+     * numbers the vertices and hands them to @a sink.
+     *
+     * @param collector fills the data of a slab.
+     * @param sink receives the vertices and faces.
+     * @param slabsPerChunk the number of slabs processed at once.
+     */
+    template <typename TCollector, typename TSink>
+    void process( const TCollector & collector, TSink & sink,
+                  std::size_t slabsPerChunk ) const;
+
+    /**
+     * Streams the mesh of a collector to an OFF file.
+     *
+     * @param filename the name of the OFF file.
+     * @param collector fills the data of a slab.
+     * @return 'true' if the file was written.
+     */
+    template <typename TCollector>
+    bool streamOFF( const std::string & filename,
+                    const TCollector & collector ) const;
+
+  }; // end of class BoundaryMesher
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BoundaryMesher'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BoundaryMesher' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const BoundaryMesher<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/BoundaryMesher.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BoundaryMesher_h
+
+#undef BoundaryMesher_RECURSES
+#endif // else defined(BoundaryMesher_RECURSES)
@@ -0,0 +1,401 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompactMesh.h
+ * @author DGtal team
+ *
+ * @date 2016/11/02
+ *
+ * Header file for module CompactMesh.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompactMesh_RECURSES)
+#error Recursive header files inclusion detected in CompactMesh.h
+#else // defined(CompactMesh_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompactMesh_RECURSES
+
+#if !defined CompactMesh_h
+/** Prevents repeated inclusion of headers. */
+#define CompactMesh_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/shapes/Mesh.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompactMesh
+  /**
+   * Description of template class 'CompactMesh' <p> \brief Aim: This
+   * class represents a surface mesh through a set of vertices and
+   * faces, the faces being stored in a compressed sparse row (CSR)
+   * layout.
+   *
+   * Contrary to Mesh, which stores each face as an individual
+   * std::vector (one heap allocation per face), all the vertex
+   * indices of all faces are stored contiguously in a single array
+   * and a second array gives, for each face, the offset of its first
+   * index. Face @a i is thus the range [ faceIndices()[ faceOffsets()[i] ],
+   * faceIndices()[ faceOffsets()[i+1] ] ). This layout is well suited
+   * to huge surface meshes and to the parallel writers of MeshWriter.
+   *
+   * Face colors are optionally stored (as in Mesh).
+   *
+   * A CompactMesh can be built from a Mesh and converted back to a
+   * Mesh:
+   * @code
+   * Mesh<Point> aMesh;
+   * ...
+   * CompactMesh<Point> aCompactMesh( aMesh );
+   * aCompactMesh.toMesh( aMesh );
+   * @endcode
+   *
+   * @tparam TPoint the type of the mesh vertices.
+   *
+   * @see Mesh MeshReader MeshWriter
+   */
+  template <typename TPoint >
+  class CompactMesh
+  {
+    // ----------------------- associated types ------------------------------
+  public:
+
+    /**
+     * Main type associated to the mesh vertices.
+     **/
+    typedef TPoint Point;
+
+    /**
+     * Type to represent real points (like face barycenters).
+     **/
+    typedef typename DGtal::PointVector<TPoint::dimension, double> RealPoint;
+
+    /**
+     * Type of vertex indices.
+     **/
+    typedef unsigned int Index;
+
+    /**
+     * Type of offsets in the face index array.
+     **/
+    typedef std::size_t Offset;
+
+    /**
+     * Define the type to store each mesh vertex.
+     **/
+    typedef std::vector<TPoint> VertexStorage;
+
+    /**
+     * Define the type to store the vertex indices of all faces.
+     **/
+    typedef std::vector<Index> IndexStorage;
+
+    /**
+     * Define the type to store the face offsets.
+     **/
+    typedef std::vector<Offset> OffsetStorage;
+
+    /**
+     * Define the type to store the color associated to each face.
+     **/
+    typedef std::vector<DGtal::Color> ColorStorage;
+
+    /**
+     * Define the type of the const iterator on the vertex indices of
+     * a face.
+     **/
+    typedef typename IndexStorage::const_iterator FaceConstIterator;
+
+    /**
+     * Define the type of the const iterator on vertex.
+     **/
+    typedef typename VertexStorage::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param saveFaceColor used to memorize the color of each face (default= false)
+     */
+    CompactMesh(bool saveFaceColor=false);
+
+    /**
+     * Constructor from a Mesh. Vertices, faces and face colors (if
+     * stored) are copied.
+     *
+     * @param aMesh the mesh to convert.
+     */
+    CompactMesh(const Mesh<TPoint> &aMesh);
+
+    /**
+     * Destructor.
+     */
+    ~CompactMesh();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    CompactMesh ( const CompactMesh & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    CompactMesh & operator= ( const CompactMesh & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Reserves memory for the given number of elements.
+     *
+     * @param nbVertices the expected number of vertices.
+     * @param nbFaces the expected number of faces.
+     * @param nbIndices the expected total number of face indices.
+     */
+    void reserve(const std::size_t nbVertices,
+                 const std::size_t nbFaces,
+                 const std::size_t nbIndices);
+
+    /**
+     * Adding new vertex.
+     * @param vertex the vertex to add.
+     **/
+    void addVertex(const TPoint &vertex);
+
+    /**
+     * Add a triangle face given from index position.
+     *
+     * @param indexVertex1 the index of the first vertex face.
+     * @param indexVertex2 the index of the second vertex face.
+     * @param indexVertex3 the index of the third vertex face.
+     * @param aColor       the triangle face color.
+     **/
+    void addTriangularFace(Index indexVertex1, Index indexVertex2,
+                           Index indexVertex3,
+                           const DGtal::Color &aColor=DGtal::Color::White);
+
+    /**
+     * Add a quad face given from index position.
+     *
+     * @param indexVertex1 the index of the first vertex face.
+     * @param indexVertex2 the index of the second vertex face.
+     * @param indexVertex3 the index of the third vertex face.
+     * @param indexVertex4 the index of the fourth vertex face.
+     * @param aColor       the quad face color.
+     **/
+    void addQuadFace(Index indexVertex1, Index indexVertex2,
+                     Index indexVertex3, Index indexVertex4,
+                     const DGtal::Color &aColor=DGtal::Color::White);
+
+    /**
+     * Add a face given from a range of vertex indices.
+     *
+     * @tparam TIterator an iterator on vertex indices.
+     * @param itb an iterator on the first vertex index of the face.
+     * @param ite an iterator after the last vertex index of the face.
+     * @param aColor the face color.
+     **/
+    template <typename TIterator>
+    void addFace(TIterator itb, const TIterator &ite,
+                 const DGtal::Color &aColor=DGtal::Color::White);
+
+    /**
+     * Add a face given as a Mesh face.
+     *
+     * @param aFace the vertex indices of the face.
+     * @param aColor the face color.
+     **/
+    void addFace(const typename Mesh<TPoint>::MeshFace &aFace,
+                 const DGtal::Color &aColor=DGtal::Color::White);
+
+    /**
+     * @param i the index of the vertex.
+     * @return a const reference to the vertex of index i.
+     **/
+    const TPoint & getVertex(Index i) const;
+
+    /**
+     * @param i the index of the vertex.
+     * @return a reference to the vertex of index i.
+     **/
+    TPoint & getVertex(Index i);
+
+    /**
+     * @param i the index of the face.
+     * @return the number of vertices of the face of index i.
+     **/
+    Index faceSize(std::size_t i) const;
+
+    /**
+     * @param i the index of the face.
+     * @return a const iterator on the first vertex index of the face i.
+     **/
+    FaceConstIterator faceBegin(std::size_t i) const;
+
+    /**
+     * @param i the index of the face.
+     * @return a const iterator after the last vertex index of the face i.
+     **/
+    FaceConstIterator faceEnd(std::size_t i) const;
+
+    /**
+     * @param i the index of the face.
+     * @return barycenter (RealPoint) of the face of index i.
+     **/
+    RealPoint getFaceBarycenter(std::size_t i) const;
+
+    /**
+     * @param i the index of the face.
+     * @return the color of the face of index i.
+     **/
+    const Color & getFaceColor(std::size_t i) const;
+
+    /**
+     * @return true if the mesh is storing a color for each faces.
+     **/
+    bool isStoringFaceColors() const;
+
+    /**
+     * @return the number of faces.
+     **/
+    std::size_t nbFaces() const;
+
+    /**
+     * @return the number of vertices.
+     **/
+    std::size_t nbVertex() const;
+
+    /**
+     * @return the vertex array.
+     **/
+    const VertexStorage & vertices() const;
+
+    /**
+     * @return the face offset array (nbFaces()+1 values).
+     **/
+    const OffsetStorage & faceOffsets() const;
+
+    /**
+     * @return the array of vertex indices of all faces.
+     **/
+    const IndexStorage & faceIndices() const;
+
+    /**
+     * @return the face color array (empty if colors are not stored).
+     **/
+    const ColorStorage & faceColors() const;
+
+    /**
+     * @return an const_iterator pointing to the first vertex of the mesh.
+     **/
+    ConstIterator vertexBegin() const
+    {
+      return myVertexList.begin();
+    }
+
+    /**
+     * @return an const_iterator pointing after the last vertex of the mesh.
+     **/
+    ConstIterator vertexEnd() const
+    {
+      return myVertexList.end();
+    }
+
+    /**
+     * Converts this mesh into a Mesh object (the previous content of
+     * @a aMesh is replaced).
+     *
+     * @param[out] aMesh the resulting mesh.
+     */
+    void toMesh(Mesh<TPoint> &aMesh) const;
+
+    /**
+     * Clear all vertices and faces of the mesh.
+     **/
+    void clear();
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    VertexStorage myVertexList;
+    OffsetStorage myFaceOffsets;
+    IndexStorage myFaceIndices;
+    ColorStorage myFaceColorList;
+    bool mySaveFaceColor;
+    DGtal::Color myDefaultColor;
+
+  }; // end of class CompactMesh
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompactMesh'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompactMesh' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompactMesh<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/CompactMesh.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompactMesh_h
+
+#undef CompactMesh_RECURSES
+#endif // else defined(CompactMesh_RECURSES)
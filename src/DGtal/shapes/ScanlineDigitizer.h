@@ -0,0 +1,399 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ScanlineDigitizer.h
+ * @author DGtal team
+ *
+ * @date 2016/11/07
+ *
+ * Header file for module ScanlineDigitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ScanlineDigitizer_RECURSES)
+#error Recursive header files inclusion detected in ScanlineDigitizer.h
+#else // defined(ScanlineDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ScanlineDigitizer_RECURSES
+
+#if !defined ScanlineDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define ScanlineDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * A range [begin,end) of indices along a scanline, whose points
+     * are either all inside the shape, all outside, or unknown (they
+     * must be tested one by one).
+     *
+     * For an unknown segment, @a tolerance may bound the rounding
+     * errors of the values of the implicit function of the shape given
+     * by its evaluateLine on the segment. It is negative when no such
+     * bound is known.
+     */
+    struct ScanlineSegment
+    {
+      enum Type { OUT_SEGMENT, IN_SEGMENT, UNKNOWN_SEGMENT };
+      ScanlineSegment( DGtal::int64_t b, DGtal::int64_t e, Type t,
+                       double tol = -1.0 )
+        : begin( b ), end( e ), type( t ), tolerance( tol ) {}
+      DGtal::int64_t begin;
+      DGtal::int64_t end;
+      Type type;
+      double tolerance;
+    };
+
+    /**
+     * Tells if a shape provides a method evaluateLine( origin, axis,
+     * step, count, values ) evaluating its implicit function (negative
+     * inside, positive outside) at regularly spaced points of a line,
+     * as ImplicitPolynomial3Shape does.
+     */
+    template <typename TShape>
+    struct ScanlineHasEvaluateLine
+    {
+      template <typename U>
+      static char test( decltype( &U::evaluateLine ) );
+      template <typename U>
+      static long test( ... );
+      static const bool value = ( sizeof( test<TShape>( 0 ) ) == 1 );
+    };
+
+    /**
+     * Evaluates the implicit function of a shape along a scanline,
+     * when the shape provides evaluateLine (see
+     * ScanlineHasEvaluateLine). The generic version does nothing.
+     */
+    template <typename TShape,
+              bool hasEvaluateLine = ScanlineHasEvaluateLine<TShape>::value>
+    struct ScanlineLineEvaluator
+    {
+      typedef double Value;
+      ScanlineLineEvaluator( const TShape & ) {}
+
+      /// @return 'false', the shape cannot be evaluated along lines.
+      template <typename TRealPoint>
+      bool operator()( const TRealPoint &, double, DGtal::int64_t,
+                       std::vector<Value> & ) const
+      {
+        return false;
+      }
+    };
+
+    /// Evaluation along a scanline with the evaluateLine of the shape.
+    template <typename TShape>
+    struct ScanlineLineEvaluator<TShape, true>
+    {
+      typedef typename TShape::Ring Value;
+      ScanlineLineEvaluator( const TShape & shape ) : myShape( shape ) {}
+
+      /**
+       * Evaluates the implicit function at the points origin + i *
+       * step * e_0, for i in [0,n).
+       *
+       * @param origin the first point.
+       * @param step the grid step along the first axis.
+       * @param n the number of points.
+       * @param[out] values the n values.
+       * @return 'true'.
+       */
+      template <typename TRealPoint>
+      bool operator()( const TRealPoint & origin, double step, DGtal::int64_t n,
+                       std::vector<Value> & values ) const
+      {
+        values.resize( static_cast<std::size_t>( n ) );
+        if ( n > 0 )
+          myShape.evaluateLine( origin, 0, static_cast<Value>( step ),
+                                static_cast<std::size_t>( n ), &values[ 0 ] );
+        return true;
+      }
+      const TShape & myShape;
+    };
+
+    /**
+     * Classifies the points of a scanline for a given Euclidean shape.
+     * The generic version knows nothing about the shape: the whole
+     * scanline is unknown. It is specialized for shapes whose inside
+     * intervals can be bounded (ImplicitBall, Ball2D, Flower2D,
+     * ImplicitPolynomial3Shape).
+     *
+     * @tparam TShape a model of CEuclideanOrientedShape.
+     */
+    template <typename TShape>
+    struct ScanlineShapeClassifier
+    {
+      ScanlineShapeClassifier( const TShape & ) {}
+
+      /**
+       * Classifies the points origin + i * step * e_0, for i in [0,n).
+       *
+       * @param origin the first point of the scanline.
+       * @param step the grid step along the first axis.
+       * @param n the number of points.
+       * @param[out] segments the segments, by increasing indices.
+       */
+      template <typename TRealPoint>
+      void classify( const TRealPoint & origin, double step, DGtal::int64_t n,
+                     std::vector<ScanlineSegment> & segments ) const
+      {
+        boost::ignore_unused_variable_warning( origin );
+        boost::ignore_unused_variable_warning( step );
+        segments.push_back( ScanlineSegment( 0, n, ScanlineSegment::UNKNOWN_SEGMENT ) );
+      }
+    };
+
+    /**
+     * Computes the runs of a scanline of a digital shape (a model of
+     * CDigitalOrientedShape): points are tested one by one, the inside
+     * ones being INSIDE or ON.
+     */
+    template <typename TDigitalShape>
+    struct ScanlineOrientationFunctor
+    {
+      typedef typename TDigitalShape::Point Point;
+      typedef typename Point::Coordinate Integer;
+      ScanlineOrientationFunctor( const TDigitalShape & shape ) : myShape( shape ) {}
+      void operator()( Point p, Integer n, std::vector<Integer> & runs ) const
+      {
+        bool in = false;
+        for ( Integer i = 0; i < n; i++, ++p[ 0 ] )
+          {
+            const Orientation o = myShape.orientation( p );
+            if ( ( o != OUTSIDE ) != in )
+              {
+                runs.push_back( i );
+                in = ! in;
+              }
+          }
+        if ( in ) runs.push_back( n );
+      }
+      const TDigitalShape & myShape;
+    };
+
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ScanlineDigitizer
+  /**
+     Description of template class 'ScanlineDigitizer' <p> \brief Aim:
+     A GaussDigitizer which digitizes its whole domain at once, scanline
+     by scanline (along the first axis), optionally in parallel (see
+     setParallel).
+
+     For each scanline, the points which are surely inside or surely
+     outside the shape are found without testing them one by one when
+     the shape allows it (see detail::ScanlineShapeClassifier): closed
+     form intervals for ImplicitBall and Ball2D, inner and outer disks
+     for Flower2D, interval arithmetic on the restriction of the
+     polynomial to the scanline for ImplicitPolynomial3Shape. The other
+     points are tested with the shape orientation, so the result is
+     exactly the one of the GaussDigitizer. When the shape provides
+     evaluateLine (see detail::ScanlineHasEvaluateLine) and the
+     classifier bounds its rounding errors, the unknown points of
+     a scanline are evaluated at once with evaluateLine instead, only
+     the values within the rounding error bound being checked again
+     with the orientation. The inside points are then inserted by runs
+     into a digital set or an image.
+
+     @code
+     ImplicitPolynomial3Shape<Z3i::Space> shape( P );
+     ScanlineDigitizer<Z3i::Space, ImplicitPolynomial3Shape<Z3i::Space> > dig;
+     dig.attach( shape );
+     dig.init( RealPoint( -2, -2, -2 ), RealPoint( 2, 2, 2 ), 0.01 );
+     Z3i::DigitalSet aSet( dig.getDomain() );
+     dig.digitize( aSet );
+     @endcode
+
+     @tparam TSpace the type of digital Space where the digitized
+     object lies.
+
+     @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+
+     @see GaussDigitizer Shapes
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  class ScanlineDigitizer : public GaussDigitizer<TSpace, TEuclideanShape>
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef GaussDigitizer<TSpace, TEuclideanShape> Base;
+    typedef typename Base::Space Space;
+    typedef typename Base::Integer Integer;
+    typedef typename Base::Point Point;
+    typedef typename Base::RealPoint RealPoint;
+    typedef typename Base::RealVector RealVector;
+    typedef typename Base::EuclideanShape EuclideanShape;
+    typedef typename Base::Domain Domain;
+
+    /**
+     * Destructor.
+     */
+    ~ScanlineDigitizer();
+
+    /**
+     * Constructor. The object is not valid.
+     */
+    ScanlineDigitizer();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       Chooses whether digitize classifies the scanlines in parallel
+       (with OpenMP if available). The orientation and evaluateLine
+       methods of the shape must then be thread-safe. Default is
+       'false'.
+
+       @param inParallel when 'true', digitize works in parallel.
+    */
+    void setParallel( bool inParallel );
+
+    /// @return 'true' if digitize works in parallel.
+    bool isParallel() const;
+
+    /**
+       Computes the runs of points of a scanline which are in the
+       digitized shape.
+
+       @param first the first point of the scanline.
+       @param n the number of points of the scanline (along axis 0).
+       @param[out] runs the runs, as pairs of indices [b,e) relative to
+       @a first (the vector is not cleared).
+    */
+    void scanline( const Point & first, Integer n,
+                   std::vector<Integer> & runs ) const;
+
+    /**
+       Inserts the points of the digitizer domain which are in the
+       digitized shape into a digital set (points outside of the set
+       domain are ignored).
+
+       @tparam TDigitalSet a model of concepts::CDigitalSet.
+       @param[in,out] aSet the set where points are inserted.
+    */
+    template <typename TDigitalSet>
+    void digitize( TDigitalSet & aSet ) const;
+
+    /**
+       Sets the value @a aValue to the points of the digitizer domain
+       which are in the digitized shape (points outside of the image
+       domain are ignored).
+
+       @tparam TImage a model of concepts::CImage.
+       @param[in,out] anImage the image.
+       @param aValue the value of the inside points.
+    */
+    template <typename TImage>
+    void digitize( TImage & anImage, const typename TImage::Value & aValue ) const;
+
+    /**
+       Functor computing the runs of a scanline (see scanline), usable
+       with detail::scanlineDigitize.
+    */
+    template <typename TClassifier>
+    struct LineFunctor
+    {
+      LineFunctor( const ScanlineDigitizer & dig, const TClassifier & classifier )
+        : myDig( dig ), myClassifier( classifier ) {}
+      void operator()( const Point & first, Integer n,
+                       std::vector<Integer> & runs ) const
+      {
+        myDig.scanline( myClassifier, first, n, runs );
+      }
+      const ScanlineDigitizer & myDig;
+      const TClassifier myClassifier;
+    };
+
+    /// The line functor of this digitizer.
+    typedef LineFunctor< detail::ScanlineShapeClassifier<EuclideanShape> > ShapeLineFunctor;
+
+    /**
+       @return a functor computing the runs of the scanlines of this
+       digitizer (it refers to this digitizer).
+    */
+    ShapeLineFunctor lineFunctor() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// When 'true', digitize classifies the scanlines in parallel.
+    bool myInParallel;
+
+    /**
+       Computes the runs of a scanline with a given classifier.
+
+       @param classifier a detail::ScanlineShapeClassifier of the shape.
+       @param first the first point of the scanline.
+       @param n the number of points of the scanline.
+       @param[out] runs the runs.
+    */
+    template <typename TClassifier>
+    void scanline( const TClassifier & classifier, const Point & first,
+                   Integer n, std::vector<Integer> & runs ) const;
+
+  }; // end of class ScanlineDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ScanlineDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ScanlineDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ScanlineDigitizer<TSpace,TEuclideanShape> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/ScanlineDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ScanlineDigitizer_h
+
+#undef ScanlineDigitizer_RECURSES
+#endif // else defined(ScanlineDigitizer_RECURSES)
@@ -53,6 +53,7 @@
 #include "DGtal/shapes/CEuclideanOrientedShape.h"
 #include "DGtal/shapes/CEuclideanBoundedShape.h"
 #include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/ScanlineDigitizer.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -97,13 +98,17 @@ namespace DGtal
      * 
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
+     * @param inParallel when 'true' (and OpenMP is available), the
+     * orientation of the shape is computed from several threads at
+     * once, so it must be thread-safe.
      * @tparam TDigitalSet a model of CDigitalSet.
      * @tparam TShapeFunctor a model of CDigitalBoundedShape and
      * CDigitalOrientedShape.
      */
     template <typename TDigitalSet, typename TShapeFunctor>
     static void digitalShaper( TDigitalSet & aSet,
-                               const TShapeFunctor & aFunctor);
+                               const TShapeFunctor & aFunctor,
+                               bool inParallel = false );
 
     /** 
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
@@ -115,6 +120,9 @@ namespace DGtal
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
      * @param h grid step for the Gauss digitization.
+     * @param inParallel when 'true' (and OpenMP is available), the
+     * orientation of the shape is computed from several threads at
+     * once, so it must be thread-safe.
      *
      * @tparam TDigitalSet a model of CDigitalSet.
      * @tparam TShapeFunctor a model of CEuclideanBoundedShape and
@@ -123,7 +131,8 @@ namespace DGtal
     template <typename TDigitalSet, typename TShapeFunctor>
     static void euclideanShaper( TDigitalSet & aSet,
                                  const TShapeFunctor & aFunctor,
-                                 const double h = 1.0);
+                                 const double h = 1.0,
+                                 bool inParallel = false );
 
     /**
        Add to the set \a aSet the points of the domain that satisfies
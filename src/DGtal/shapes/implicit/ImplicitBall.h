@@ -121,6 +121,24 @@ namespace DGtal
     {
       return (myCenter + RealPoint::diagonal(myRadius)); 
     }
+
+    /**
+     * @return the ball center.
+     */
+    inline
+    const RealPoint & center() const
+    {
+      return myCenter;
+    }
+
+    /**
+     * @return the ball radius.
+     */
+    inline
+    double radius() const
+    {
+      return myRadius;
+    }
     
 
 
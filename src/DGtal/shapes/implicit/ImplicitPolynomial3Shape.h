@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +59,10 @@ namespace DGtal
    * \brief Aim: model of CEuclideanOrientedShape concepts to create a
    * shape from a polynomial.
    *
+   * The polynomial and its gradient are compiled (see
+   * CompiledMPolynomial) for fast evaluations, which can also be
+   * done along whole lines (see evaluateLine()).
+   *
    * Model of CImplicitFunction
    *
    * @tparam TSpace the Digital space definition.
@@ -75,6 +80,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial< 3, Ring > CompiledPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -107,6 +113,16 @@ namespace DGtal
     */
     void init( const Polynomial3 & poly );
 
+    /**
+       @return the polynomial defining the shape.
+    */
+    const Polynomial3 & getPolynomial() const;
+
+    /**
+       @return the compiled polynomial defining the shape.
+    */
+    const CompiledPolynomial3 & getCompiledPolynomial() const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -130,6 +146,19 @@ namespace DGtal
     */
     Orientation orientation(const RealPoint &aPoint) const;
 
+    /**
+       Evaluates the polynomial at the points aOrigin + i * aStep *
+       e_axis, for i in [0,aCount), see CompiledMPolynomial::evaluateLine.
+
+       @param aOrigin the first point.
+       @param axis the direction of the line.
+       @param aStep the distance between two consecutive points.
+       @param aCount the number of points.
+       @param[out] values a pointer on (at least) @a aCount values.
+    */
+    void evaluateLine( const RealPoint & aOrigin, Dimension axis, Ring aStep,
+                       std::size_t aCount, Ring * values ) const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return the gradient vector of the polynomial at \a aPoint.
@@ -239,6 +268,11 @@ namespace DGtal
     Polynomial3 myUpPolynome;
     Polynomial3 myLowPolynome;
 
+    // Compiled polynomial and gradient, for fast evaluations.
+    CompiledPolynomial3 myCompiledPolynomial;
+    CompiledPolynomial3 myCompiledFx;
+    CompiledPolynomial3 myCompiledFy;
+    CompiledPolynomial3 myCompiledFz;
 
     // ------------------------- Hidden services ------------------------------
   protected:
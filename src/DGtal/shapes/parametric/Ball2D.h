@@ -123,6 +123,14 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return the radius of the ball.
+     */
+    double radius() const
+    {
+      return myRadius;
+    }
    
     /**
      * @param p any point in the plane.
@@ -147,6 +147,22 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return the radius of the flower.
+     */
+    double radius() const
+    {
+      return myRadius;
+    }
+
+    /**
+     * @return the variable small radius of the flower.
+     */
+    double varRadius() const
+    {
+      return myVarRadius;
+    }
    
     /**
      * @param p any point in the plane.
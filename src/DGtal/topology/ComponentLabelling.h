@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ComponentLabelling.h
+ * @author DGtal team
+ *
+ * @date 2016/11/25
+ *
+ * Header file for the connected component labelling functions
+ * labelComponents.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ComponentLabelling.h
+#else // defined(ComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ComponentLabelling_RECURSES
+
+#if !defined ComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DomainAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+       Tells if an adjacency is a metric adjacency (see
+       MetricAdjacency), possibly restricted to a domain, and gives
+       its maximal 1-norm in this case.
+
+       @tparam TAdjacency any model of CAdjacency.
+    */
+    template <typename TAdjacency>
+    struct MetricAdjacencyTraits
+    {
+      BOOST_STATIC_CONSTANT( bool, isMetric = false );
+      BOOST_STATIC_CONSTANT( Dimension, maxNorm1 = 0 );
+    };
+
+    template <typename TSpace, Dimension n, Dimension dim>
+    struct MetricAdjacencyTraits< MetricAdjacency<TSpace, n, dim> >
+    {
+      BOOST_STATIC_CONSTANT( bool, isMetric = ( dim == TSpace::dimension ) );
+      BOOST_STATIC_CONSTANT( Dimension, maxNorm1 = n );
+    };
+
+    template <typename TDomain, typename TAdjacency>
+    struct MetricAdjacencyTraits< DomainAdjacency<TDomain, TAdjacency> >
+      : public MetricAdjacencyTraits<TAdjacency>
+    {};
+  } // namespace detail
+
+  namespace functions
+  {
+    /**
+       Labels the connected components of the points of the domain of
+       @a labels whose value in @a anImage satisfies @a aPredicate, for
+       the metric adjacency @a anAdjacency (e.g. 4/8 in 2D, 6/18/26 in
+       3D).
+
+       The foreground is cut into runs along the first axis, and runs
+       of neighbouring scanlines are merged with a union-find
+       structure. When @a inParallel is 'true', the domain is split in
+       slabs along its last axis, which are labelled in parallel (with
+       OpenMP), then the runs touching the slab boundaries are merged.
+
+       Labels are numbered from 1 in the order of the first point of
+       each component in the domain scan (first axis varying fastest),
+       so the result does not depend on the number of threads.
+       Background points get label 0.
+
+       @tparam TAdjacency a metric adjacency (MetricAdjacency or
+       DomainAdjacency over a MetricAdjacency).
+       @tparam TImage a model of CConstImage.
+       @tparam TPredicate a predicate on the values of TImage.
+       @tparam TSpace the digital space.
+       @tparam TLabel an integer type for labels (not bool).
+
+       @param anAdjacency the adjacency (only its type is used).
+       @param anImage an image defined at each point of the domain of @a labels.
+       @param aPredicate the predicate telling foreground values.
+       @param[in,out] labels the label image, whose domain is labelled.
+       @param[out] sizes the number of points of each label, sizes[ 0 ]
+       being the number of background points.
+       @param inParallel when 'true', labels slabs in parallel.
+       @return the number of components.
+    */
+    template <typename TAdjacency, typename TImage, typename TPredicate,
+              typename TSpace, typename TLabel>
+    typename HyperRectDomain<TSpace>::Size
+    labelComponents( const TAdjacency & anAdjacency,
+                     const TImage & anImage, const TPredicate & aPredicate,
+                     ImageContainerBySTLVector< HyperRectDomain<TSpace>, TLabel > & labels,
+                     std::vector< typename HyperRectDomain<TSpace>::Size > & sizes,
+                     bool inParallel = false );
+
+    /**
+       Labels the connected components of the points of @a aSet lying
+       in the domain of @a labels, for the metric adjacency @a
+       anAdjacency. Same as the image version otherwise.
+
+       When the domain of @a labels contains @a aSet, labels and
+       components are the ones of an Object over @a aSet with this
+       foreground adjacency (see Object::writeComponents).
+
+       @tparam TAdjacency a metric adjacency.
+       @tparam TDigitalSet a model of CDigitalSet.
+       @tparam TSpace the digital space.
+       @tparam TLabel an integer type for labels (not bool).
+
+       @param anAdjacency the adjacency (only its type is used).
+       @param aSet a digital set.
+       @param[in,out] labels the label image, whose domain is labelled.
+       @param[out] sizes the number of points of each label, sizes[ 0 ]
+       being the number of background points.
+       @param inParallel when 'true', labels slabs in parallel.
+       @return the number of components.
+    */
+    template <typename TAdjacency, typename TDigitalSet,
+              typename TSpace, typename TLabel>
+    typename HyperRectDomain<TSpace>::Size
+    labelComponents( const TAdjacency & anAdjacency, const TDigitalSet & aSet,
+                     ImageContainerBySTLVector< HyperRectDomain<TSpace>, TLabel > & labels,
+                     std::vector< typename HyperRectDomain<TSpace>::Size > & sizes,
+                     bool inParallel = false );
+
+  } // namespace functions
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ComponentLabelling_h
+
+#undef ComponentLabelling_RECURSES
+#endif // else defined(ComponentLabelling_RECURSES)
@@ -167,9 +167,10 @@ namespace DGtal
   * @tparam TCellContainer any model of associative container, mapping
   * a KSpace::Cell to a CubicalCellData or any type deriving from
   * it. It could be for instance a std::map or a
-  * std::unordered_map. Note that unfortunately, unordered_map are
-  * (strangely) not models of boost::AssociativeContainer, hence we
-  * cannot check concepts here.
+  * std::unordered_map, or a DGtal::OpenAddressingMap, which stores
+  * cells in a flat array and is faster to probe. Note that
+  * unfortunately, unordered_map are (strangely) not models of
+  * boost::AssociativeContainer, hence we cannot check concepts here.
   *
   */
   template < typename TKSpace, 
@@ -530,10 +531,33 @@ namespace DGtal
     * Constructor a complex from a digital set.
     * @param set - a digital set from which to create a complex. 
     * Set has to be of the same dimension as a Khalimsky space.
+    *
+    * The spels of the points and their faces are generated in
+    * parallel (with OpenMP), then sorted and inserted dimension per
+    * dimension.
     */
     template < typename TDigitalSet >
     void construct ( const TDigitalSet & set );
 
+    /**
+    * Constructor a complex from the points of an image whose value
+    * satisfies a predicate: the complex receives the spels of these
+    * points and all their faces.
+    *
+    * The cells are generated in parallel (with OpenMP) over the
+    * scanlines of the image domain, then sorted and inserted
+    * dimension per dimension.
+    *
+    * @tparam TImage a type of image whose domain is a HyperRectDomain
+    * of the same dimension as the Khalimsky space.
+    * @tparam TValuePredicate a predicate on the values of the image.
+    *
+    * @param image the image.
+    * @param pred the predicate, which selects the points of the image.
+    */
+    template < typename TImage, typename TValuePredicate >
+    void construct ( const TImage & image, const TValuePredicate & pred );
+
     /**
     * Assignment.
     * @param other the object to copy.
@@ -1201,6 +1225,9 @@ namespace DGtal
     /**
     * Close all cells of dimension less or equal to \a k.
     * @param k any strictly positive integer.
+    *
+    * @note Dimension per dimension, the faces of the cells are
+    * computed in parallel (with OpenMP), then sorted and inserted.
     */
     void close( Dimension k );
 
@@ -1212,6 +1239,10 @@ namespace DGtal
     /**
     * Open all cells of dimension less or or equal to \a k.
     * @param k any strictly positive integer.
+    *
+    * @note Dimension per dimension, the cofaces of the cells are
+    * probed in parallel (with OpenMP), then the cells that are not
+    * open are erased.
     */
     void open( Dimension k );
 
@@ -1263,6 +1294,42 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+    * @param d any dimension.
+    * @return the vector of the cells of dimension \a d, which may be
+    * processed in parallel.
+    */
+    std::vector<Cell> cellVector( Dimension d ) const;
+
+    /**
+    * Appends the spel \a aSpel and all its faces to \a cells, cells
+    * of dimension d being appended to \a cells[ d ].
+    * @param aSpel any spel.
+    * @param cells a vector of (dimension+1) vectors of cells.
+    */
+    void pushClosedSpel( const Cell& aSpel,
+                         std::vector< std::vector<Cell> >& cells ) const;
+
+    /**
+    * Inserts the cells of \a cells in this complex, cells of
+    * dimension d being in \a cells[ d ]. Each vector is sorted and
+    * made unique (in parallel over the dimensions), so that it is
+    * inserted in one pass.
+    * @param cells a vector of (dimension+1) vectors of cells, possibly
+    * with duplicates. It is modified.
+    * @param data the data associated to every inserted cell.
+    */
+    void insertCellVectors( std::vector< std::vector<Cell> >& cells,
+                            const Data& data = Data() );
+
+    /**
+    * Inserts the cells of \a cells in the cells of dimension \a d.
+    * @param d the dimension of the cells.
+    * @param cells a sorted vector of distinct cells of dimension \a d.
+    * @param data the data associated to every inserted cell.
+    */
+    void insertSortedCells( Dimension d, const std::vector<Cell>& cells,
+                            const Data& data );
 
   }; // end of class CubicalComplex
 
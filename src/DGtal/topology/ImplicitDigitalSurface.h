@@ -211,6 +211,12 @@ namespace DGtal
        @param closed when 'true', the surface is known to be closed,
        hence faster extraction can be performed, default is 'false'.
 
+       @param inParallel when 'true', the surface is extracted by a
+       parallel breadth-first traversal (see
+       Surfaces::parallelTrackBoundary), and the surfels are then
+       stored level by level instead of in increasing order. The point
+       predicate must then be thread-safe. Default is 'false'.
+
        NB: O(N) computational complexity operation, where N is the
        number of surfels of the surface. This is due to the fact that,
        at construction, the surface is extracted and stored.
@@ -221,7 +227,8 @@ namespace DGtal
                             ConstAlias<PointPredicate> aPP,
                             const Adjacency & adj,
                             const Surfel & s,
-                            bool closed = false );
+                            bool closed = false,
+                            bool inParallel = false );
 
     /// accessor to surfel adjacency.
     const Adjacency & surfelAdjacency() const;
@@ -309,9 +316,11 @@ namespace DGtal
        @param closed when 'true', the surface is known to be closed,
        hence faster extraction can be performed.
 
+       @param inParallel when 'true', tracks the surface in parallel.
     */
     void computeSurfels( const Surfel & p,
-                         bool closed );
+                         bool closed,
+                         bool inParallel = false );
 
 
   private:
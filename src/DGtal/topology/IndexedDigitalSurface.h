@@ -0,0 +1,403 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedDigitalSurface.h
+ * @author DGtal team
+ *
+ * @date 2016/11/26
+ *
+ * Header file for template class IndexedDigitalSurface
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in IndexedDigitalSurface.h
+#else // defined(IndexedDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedDigitalSurface_RECURSES
+
+#if !defined IndexedDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedDigitalSurface
+  /**
+     Description of template class 'IndexedDigitalSurface' <p>
+     \brief Aim: The combinatorial structure of a digital surface
+     (vertices, arcs and faces of DigitalSurface) computed once and
+     stored in flat arrays, whose elements are designated by integer
+     indices, in the spirit of a half-edge data structure.
+
+     - vertices (surfels) are numbered in the order of the surface
+       container;
+     - the arcs leaving a vertex are numbered consecutively, in the
+       order of DigitalSurface::outArcs. Each arc knows its head, its
+       opposite arc, and, for each of the dimension-2 faces it
+       borders (one in 3D), the face and the next arc along this
+       face;
+     - faces (umbrellas around pivot cells) are ordered by their
+       representative state. Each face stores its vertices and arcs
+       in the order of DigitalSurface::verticesAroundFace.
+
+     Hence the traversals of DigitalSurface (outArcs, head, opposite,
+     facesAroundArc, facesAroundVertex, verticesAroundFace, allFaces)
+     are answered by array lookups, without any tracker move nor
+     memory allocation, and an indexed surface may be read
+     concurrently. Building it evaluates the umbrellas of the surface
+     once per arc, possibly in parallel (OpenMP), each thread using
+     its own copy of the surface trackers.
+
+     The surface must be defined in a closed Khalimsky space for its
+     faces to be computed (see UmbrellaComputer).
+
+     @code
+     typedef IndexedDigitalSurface< SurfaceContainer > IndexedSurface;
+     IndexedSurface indexed( surface, true );
+     for ( IndexedSurface::FaceIndex f = 0; f < indexed.nbFaces(); ++f )
+       for ( IndexedSurface::IndexConstIterator it = indexed.verticesBegin( f ),
+               itE = indexed.verticesEnd( f ); it != itE; ++it )
+         ... indexed.surfel( *it ) ...
+     @endcode
+
+     @tparam TDigitalSurfaceContainer any model of CDigitalSurfaceContainer.
+
+     @see DigitalSurface, SurfelNeighborhoodIndex
+  */
+  template <typename TDigitalSurfaceContainer>
+  class IndexedDigitalSurface
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer<TDigitalSurfaceContainer> ));
+
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef IndexedDigitalSurface<TDigitalSurfaceContainer> Self;
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;
+    typedef typename Surface::Surfel Surfel;
+    /// An arc of the digital surface.
+    typedef typename Surface::Arc SurfaceArc;
+    /// A face of the digital surface.
+    typedef typename Surface::Face SurfaceFace;
+    /// The type of indices.
+    typedef DGtal::uint32_t Index;
+    /// The index of a vertex (surfel) in 0..nbVertices()-1.
+    typedef Index VertexIndex;
+    /// The index of an arc in 0..nbArcs()-1.
+    typedef Index ArcIndex;
+    /// The index of a face in 0..nbFaces()-1.
+    typedef Index FaceIndex;
+    /// Iterator on a range of indices.
+    typedef const Index * IndexConstIterator;
+
+    /// The index standing for no element (e.g. no next arc at the end of an open face).
+    static const Index INVALID_INDEX = 0xFFFFFFFFu;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Default constructor. The object is not valid.
+    */
+    IndexedDigitalSurface();
+
+    /**
+       Constructor. Indexes the given surface.
+       @param aSurface the digital surface, aliased in this.
+       @param inParallel when 'true', computes arcs and faces in parallel.
+    */
+    IndexedDigitalSurface( ConstAlias<Surface> aSurface, bool inParallel = false );
+
+    /**
+       Destructor.
+    */
+    ~IndexedDigitalSurface();
+
+    /**
+       Indexes the vertices, arcs and faces of the given surface.
+       @param aSurface the digital surface, aliased in this.
+       @param inParallel when 'true', computes arcs and faces in parallel.
+    */
+    void init( ConstAlias<Surface> aSurface, bool inParallel = false );
+
+    /// @return the indexed surface.
+    const Surface & surface() const;
+
+    // ----------------------- Vertex services --------------------------------
+  public:
+
+    /// @return the number of vertices.
+    Index nbVertices() const;
+
+    /**
+       @param v any vertex index.
+       @return the surfel of index @a v.
+    */
+    const Surfel & surfel( VertexIndex v ) const;
+
+    /**
+       @param s any surfel.
+       @return 'true' if @a s is a vertex of the indexed surface.
+    */
+    bool isIndexed( const Surfel & s ) const;
+
+    /**
+       @param s any surfel of the indexed surface.
+       @return its index.
+    */
+    VertexIndex index( const Surfel & s ) const;
+
+    /**
+       @param v any vertex index.
+       @return the number of arcs leaving @a v.
+    */
+    Index degree( VertexIndex v ) const;
+
+    /**
+       The arcs leaving @a v are the indices outArcsBegin( v ) to
+       outArcsEnd( v ) - 1.
+       @param v any vertex index.
+       @return the index of the first arc leaving @a v.
+    */
+    ArcIndex outArcsBegin( VertexIndex v ) const;
+
+    /**
+       @param v any vertex index.
+       @return the index after the last arc leaving @a v.
+    */
+    ArcIndex outArcsEnd( VertexIndex v ) const;
+
+    /**
+       The faces around @a v, i.e. the faces of its out arcs, as given
+       by DigitalSurface::facesAroundVertex (same faces, same order).
+       @param v any vertex index.
+       @return an iterator on the first face around @a v.
+    */
+    IndexConstIterator facesAroundVertexBegin( VertexIndex v ) const;
+
+    /**
+       @param v any vertex index.
+       @return an iterator after the last face around @a v.
+    */
+    IndexConstIterator facesAroundVertexEnd( VertexIndex v ) const;
+
+    // ----------------------- Arc services -----------------------------------
+  public:
+
+    /// @return the number of arcs.
+    Index nbArcs() const;
+
+    /// @return the number of faces bordered by each arc (dimension - 2).
+    Dimension nbFacesPerArc() const;
+
+    /**
+       @param a any arc index.
+       @return the corresponding arc of the digital surface.
+    */
+    const SurfaceArc & arc( ArcIndex a ) const;
+
+    /**
+       @param a any arc index.
+       @return the vertex at the tail of @a a.
+    */
+    VertexIndex tail( ArcIndex a ) const;
+
+    /**
+       @param a any arc index.
+       @return the vertex at the head of @a a.
+    */
+    VertexIndex head( ArcIndex a ) const;
+
+    /**
+       @param a any arc index.
+       @return the arc going from the head to the tail of @a a.
+    */
+    ArcIndex opposite( ArcIndex a ) const;
+
+    /**
+       @param a any arc index.
+       @param i the rank of the face in 0..nbFacesPerArc()-1, in the
+       order of DigitalSurface::facesAroundArc.
+       @return the i-th face bordered by @a a.
+    */
+    FaceIndex face( ArcIndex a, Dimension i = 0 ) const;
+
+    /**
+       @param a any arc index.
+       @param i the rank of the face in 0..nbFacesPerArc()-1.
+       @return the arc following @a a along its i-th face, or
+       INVALID_INDEX if @a a is the last arc of an open face.
+    */
+    ArcIndex next( ArcIndex a, Dimension i = 0 ) const;
+
+    // ----------------------- Face services ----------------------------------
+  public:
+
+    /// @return the number of faces.
+    Index nbFaces() const;
+
+    /**
+       @param f any face index.
+       @return the corresponding face of the digital surface.
+    */
+    const SurfaceFace & surfaceFace( FaceIndex f ) const;
+
+    /**
+       @param f any face index.
+       @return 'true' if the face is closed.
+    */
+    bool isClosed( FaceIndex f ) const;
+
+    /**
+       @param f any face index.
+       @return the number of vertices of @a f.
+    */
+    Index faceDegree( FaceIndex f ) const;
+
+    /**
+       @param f any face index.
+       @return an iterator on the first vertex of @a f, the vertices
+       being in the order of DigitalSurface::verticesAroundFace.
+    */
+    IndexConstIterator verticesBegin( FaceIndex f ) const;
+
+    /**
+       @param f any face index.
+       @return an iterator after the last vertex of @a f.
+    */
+    IndexConstIterator verticesEnd( FaceIndex f ) const;
+
+    /**
+       The i-th arc of @a f goes from its i-th vertex to the next one.
+       The last arc of an open face is INVALID_INDEX.
+       @param f any face index.
+       @return an iterator on the first arc of @a f.
+    */
+    IndexConstIterator arcsBegin( FaceIndex f ) const;
+
+    /**
+       @param f any face index.
+       @return an iterator after the last arc of @a f.
+    */
+    IndexConstIterator arcsEnd( FaceIndex f ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the arc from @a v to @a w, or INVALID_INDEX.
+    ArcIndex findArc( VertexIndex v, VertexIndex w ) const;
+
+    /// Computes the arcs, their heads and their opposites.
+    void computeArcs( bool inParallel );
+
+    /// Computes the faces, their vertices and arcs, and the face links of arcs.
+    void computeFaces( bool inParallel );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The indexed surface.
+    CountedConstPtrOrConstPtr<Surface> mySurface;
+    /// The surfels, by index.
+    std::vector<Surfel> mySurfels;
+    /// The index of each surfel.
+    std::unordered_map<Surfel, VertexIndex> myIndices;
+    /// The arcs leaving v are myFirstArc[ v ] .. myFirstArc[ v+1 ] - 1.
+    std::vector<ArcIndex> myFirstArc;
+    /// The arcs.
+    std::vector<SurfaceArc> myArcs;
+    /// The tail of each arc.
+    std::vector<VertexIndex> myTails;
+    /// The head of each arc.
+    std::vector<VertexIndex> myHeads;
+    /// The opposite of each arc.
+    std::vector<ArcIndex> myOpposites;
+    /// The number of faces bordered by an arc.
+    Dimension myNbFacesPerArc;
+    /// The i-th face of arc a is myArcFaces[ a * myNbFacesPerArc + i ].
+    std::vector<FaceIndex> myArcFaces;
+    /// The next arc of arc a along its i-th face is myNexts[ a * myNbFacesPerArc + i ].
+    std::vector<ArcIndex> myNexts;
+    /// The faces.
+    std::vector<SurfaceFace> myFaces;
+    /// The vertices (and arcs) of f are at myFirstFaceVertex[ f ] .. myFirstFaceVertex[ f+1 ] - 1.
+    std::vector<Index> myFirstFaceVertex;
+    /// The vertices of all faces.
+    std::vector<VertexIndex> myFaceVertices;
+    /// The arcs of all faces.
+    std::vector<ArcIndex> myFaceArcs;
+
+  }; // end of class IndexedDigitalSurface
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IndexedDigitalSurface<TDigitalSurfaceContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/IndexedDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedDigitalSurface_h
+
+#undef IndexedDigitalSurface_RECURSES
+#endif // else defined(IndexedDigitalSurface_RECURSES)
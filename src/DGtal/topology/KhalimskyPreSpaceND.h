@@ -1274,6 +1274,13 @@ namespace DGtal
      */
     static void uAddCoFaces( Cells & cofaces, const Cell & c, Dimension axis );
 
+    /**
+     * Used by the signed incidence services: parity of the number of
+     * open coordinates of [p] along axes 0 to [k], i.e. the low bit of
+     * the exclusive or of these coordinates.
+     */
+    static bool sOpenParity( const SCell & p, Dimension k );
+
     /// @}
 
     // ----------------------- Interface --------------------------------------
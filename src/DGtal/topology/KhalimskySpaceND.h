@@ -46,6 +46,7 @@
 #include <set>
 #include <map>
 #include <array>
+#include <vector>
 #include <DGtal/base/Common.h>
 #include <DGtal/kernel/CInteger.h>
 #include <DGtal/kernel/PointVector.h>
@@ -70,6 +71,15 @@ namespace DGtal
   template < class TKhalimskySpace >
   class KhalimskySpaceNDHelper;
 
+  namespace detail
+  {
+    /// @return 3^d, the number of faces (itself included) of a d-cell.
+    constexpr std::size_t khalimskyNbFaces( Dimension d )
+    {
+      return d == 0 ? 1 : 3 * khalimskyNbFaces( d - 1 );
+    }
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   /**
    * @brief Represents an (unsigned) cell in a cellular grid space by its
@@ -438,6 +448,18 @@ namespace DGtal
     typedef AnyCellCollection<Cell> Cells;
     typedef AnyCellCollection<SCell> SCells;
 
+    // Fixed-size buffers of the allocation-free neighborhood and incidence services.
+    /// Buffer for the lower or upper incident cells of a cell.
+    typedef std::array<Cell, 2 * dim> IncidentCellArray;
+    /// Buffer for the lower or upper incident signed cells of a signed cell.
+    typedef std::array<SCell, 2 * dim> IncidentSCellArray;
+    /// Buffer for the 1-neighborhood of a cell.
+    typedef std::array<Cell, 2 * dim + 1> NeighborhoodCellArray;
+    /// Buffer for the 1-neighborhood of a signed cell.
+    typedef std::array<SCell, 2 * dim + 1> NeighborhoodSCellArray;
+    /// Buffer for the proper faces of a cell.
+    typedef std::array<Cell, detail::khalimskyNbFaces( dim ) - 1> FaceCellArray;
+
     // Sets, Maps
     /// Preferred type for defining a set of Cell(s).
     typedef std::set<Cell> CellSet;
@@ -1724,6 +1746,26 @@ namespace DGtal
      */
     SCells sNeighborhood( const SCell & cell ) const;
 
+    /** Computes the 1-neighborhood of the cell [c], without allocation.
+     *
+     * @param cell the unsigned cell of interest.
+     * @param[out] cells the cells of the 1-neighborhood of [cell], in
+     * the same order as uNeighborhood( cell ).
+     * @return the number of cells written in [cells].
+     * @pre  `uIsValid(cell)` is \a true.
+     */
+    std::size_t uNeighborhood( const Cell & cell, NeighborhoodCellArray & cells ) const;
+
+    /** Computes the 1-neighborhood of the signed cell [c], without allocation.
+     *
+     * @param cell the signed cell of interest.
+     * @param[out] cells the cells of the 1-neighborhood of [cell], in
+     * the same order as sNeighborhood( cell ).
+     * @return the number of cells written in [cells].
+     * @pre  `sIsValid(cell)` is \a true.
+     */
+    std::size_t sNeighborhood( const SCell & cell, NeighborhoodSCellArray & cells ) const;
+
     /** Computes the proper 1-neighborhood of the cell [c] and returns
      *  it. It is the set of cells with same topology that are adjacent
      *  to [c], different from [c] and which are within the bounds of
@@ -1863,6 +1905,119 @@ namespace DGtal
      */
     Cells uCoFaces( const Cell & c ) const;
 
+    /**
+     * Allocation-free version of uLowerIncident( c ).
+     * @param c any unsigned cell.
+     * @param[out] cells the cells directly low incident to c in this
+     * space, in the same order as uLowerIncident( c ).
+     * @return the number of cells written in [cells].
+     * @pre  `uIsValid(c)` is \a true.
+     */
+    std::size_t uLowerIncident( const Cell & c, IncidentCellArray & cells ) const;
+
+    /**
+     * Allocation-free version of uUpperIncident( c ).
+     * @param c any unsigned cell.
+     * @param[out] cells the cells directly up incident to c in this
+     * space, in the same order as uUpperIncident( c ).
+     * @return the number of cells written in [cells].
+     * @pre  `uIsValid(c)` is \a true.
+     */
+    std::size_t uUpperIncident( const Cell & c, IncidentCellArray & cells ) const;
+
+    /**
+     * Allocation-free version of sLowerIncident( c ). The signs of
+     * the incident cells are computed along the directions of c with
+     * a running parity of its open coordinates.
+     * @param c any signed cell.
+     * @param[out] cells the signed cells directly low incident to c in
+     * this space, in the same order as sLowerIncident( c ).
+     * @return the number of cells written in [cells].
+     * @pre  `sIsValid(c)` is \a true.
+     */
+    std::size_t sLowerIncident( const SCell & c, IncidentSCellArray & cells ) const;
+
+    /**
+     * Allocation-free version of sUpperIncident( c ).
+     * @param c any signed cell.
+     * @param[out] cells the signed cells directly up incident to c in
+     * this space, in the same order as sUpperIncident( c ).
+     * @return the number of cells written in [cells].
+     * @pre  `sIsValid(c)` is \a true.
+     */
+    std::size_t sUpperIncident( const SCell & c, IncidentSCellArray & cells ) const;
+
+    /**
+     * Allocation-free version of uFaces( c ).
+     * @param c any unsigned cell.
+     * @param[out] cells the proper faces of [c] that belong to the
+     * space, in the same order as uFaces( c ).
+     * @return the number of cells written in [cells].
+     * @pre  `uIsValid(c)` is \a true.
+     */
+    std::size_t uFaces( const Cell & c, FaceCellArray & cells ) const;
+
+    /**
+     * Computes the cells directly low incident to each cell of a
+     * range, in compressed sparse row layout: the cells incident to
+     * the i-th cell of the range are cells[ offsets[ i ] ] to
+     * cells[ offsets[ i + 1 ] - 1 ]. Cells are processed in parallel
+     * (OpenMP) for large ranges.
+     *
+     * @tparam CellConstIterator a random access iterator on Cell.
+     * @param itb an iterator on the first cell of the range.
+     * @param ite an iterator after the last cell of the range.
+     * @param[out] cells the incident cells.
+     * @param[out] offsets the range size + 1 offsets in [cells].
+     */
+    template <typename CellConstIterator>
+    void uLowerIncident( CellConstIterator itb, CellConstIterator ite,
+                         std::vector<Cell> & cells, std::vector<std::size_t> & offsets ) const;
+
+    /**
+     * Computes the cells directly up incident to each cell of a range,
+     * in compressed sparse row layout (see uLowerIncident).
+     *
+     * @tparam CellConstIterator a random access iterator on Cell.
+     * @param itb an iterator on the first cell of the range.
+     * @param ite an iterator after the last cell of the range.
+     * @param[out] cells the incident cells.
+     * @param[out] offsets the range size + 1 offsets in [cells].
+     */
+    template <typename CellConstIterator>
+    void uUpperIncident( CellConstIterator itb, CellConstIterator ite,
+                         std::vector<Cell> & cells, std::vector<std::size_t> & offsets ) const;
+
+    /**
+     * Computes the signed cells directly low incident to each signed
+     * cell of a range, in compressed sparse row layout (see
+     * uLowerIncident).
+     *
+     * @tparam SCellConstIterator a random access iterator on SCell.
+     * @param itb an iterator on the first cell of the range.
+     * @param ite an iterator after the last cell of the range.
+     * @param[out] cells the incident signed cells.
+     * @param[out] offsets the range size + 1 offsets in [cells].
+     */
+    template <typename SCellConstIterator>
+    void sLowerIncident( SCellConstIterator itb, SCellConstIterator ite,
+                         std::vector<SCell> & cells, std::vector<std::size_t> & offsets ) const;
+
+    /**
+     * Computes the signed cells directly up incident to each signed
+     * cell of a range, in compressed sparse row layout (see
+     * uLowerIncident).
+     *
+     * @tparam SCellConstIterator a random access iterator on SCell.
+     * @param itb an iterator on the first cell of the range.
+     * @param ite an iterator after the last cell of the range.
+     * @param[out] cells the incident signed cells.
+     * @param[out] offsets the range size + 1 offsets in [cells].
+     */
+    template <typename SCellConstIterator>
+    void sUpperIncident( SCellConstIterator itb, SCellConstIterator ite,
+                         std::vector<SCell> & cells, std::vector<std::size_t> & offsets ) const;
+
     /** Return 'true' if the direct orientation of [p] along [k] is in
      *  the positive coordinate direction. The direct orientation in a
      *  direction allows to go from positive incident cells to positive
@@ -1956,6 +2111,34 @@ ose sign is positive).
      */
     void uAddCoFaces( Cells& cofaces, const Cell& c, Dimension axis ) const;
 
+    /**
+     * Used by the allocation-free uFaces for computing incident faces.
+     */
+    void uAddFaces( FaceCellArray& faces, std::size_t& nb, const Cell& c, Dimension axis ) const;
+
+    /**
+     * Writes the cells incident to [c] along axis [k] that belong to
+     * the space, backward first.
+     */
+    void uAddIncident( IncidentCellArray& cells, std::size_t& nb, const Cell& c, Dimension k ) const;
+
+    /**
+     * Writes the signed cells incident to [c] along axis [k] that
+     * belong to the space, backward first, given the parity of the
+     * open coordinates of [c] up to [k].
+     */
+    void sAddIncident( IncidentSCellArray& cells, std::size_t& nb, const SCell& c,
+                       Dimension k, bool parity ) const;
+
+    /**
+     * Computes in compressed sparse row layout the cells given by an
+     * allocation-free incidence service for each cell of a range.
+     */
+    template <typename TCell, typename CellArray, typename CellConstIterator, typename Incidence>
+    void batchIncident( CellConstIterator itb, CellConstIterator ite,
+                        std::vector<TCell> & cells, std::vector<std::size_t> & offsets,
+                        Incidence incidence ) const;
+
     /// @}
 
   }; // end of class KhalimskySpaceND
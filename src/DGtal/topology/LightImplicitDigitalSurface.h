@@ -294,6 +294,21 @@ namespace DGtal
     /// surfels.
     Size nbSurfels() const;
 
+    /**
+       Writes all the surfels of this digital surface on @a it. The
+       surface is tracked by a parallel breadth-first traversal (see
+       Surfaces::parallelTrackBoundary), which is much faster than
+       iterating from begin() to end() on large surfaces, but stores
+       the visited surfels. The point predicate must be thread-safe.
+
+       @tparam OutputIterator the type of an output iterator on Surfel
+       (e.g. back_insert_iterator<std::vector<Surfel> >).
+       @param[in,out] it any output iterator, where surfels are
+       written level by level, each level in increasing order.
+    */
+    template <typename OutputIterator>
+    void writeSurfels( OutputIterator & it ) const;
+
     /// @return 'true' is the surface has no surfels, 'false'
     /// otherwise. NB: O(1) operation.
     bool empty() const;
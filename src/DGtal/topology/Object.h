@@ -419,6 +419,13 @@ namespace DGtal
       @param it the output iterator. *it is an Object.
       @return the number of components.
 
+      Components are output in the order of their first point in the
+      point set. When the domain is a HyperRectDomain and the
+      foreground adjacency is metric, they are computed with
+      functions::labelComponents over the bounding box of the object
+      (if it is not too sparse), otherwise with breadth-first
+      traversals.
+
 NB: Be careful that the [it] should not be an output iterator
 pointing in the same container containing 'this'. The following
 example might make a 'bus error' because the vector might be
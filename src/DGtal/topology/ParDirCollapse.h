@@ -119,25 +119,40 @@ public:
      /**
      * This method applies a given number of iterations to a complex
      * provided by the attach() method.
+     *
+     * When \a inParallel is true, each sub-step (one direction, one
+     * orientation and one dimension) removes its free pairs in
+     * parallel with OpenMP: the candidate pairs are sorted, hence
+     * split in spatial slabs between threads, and removed by rounds
+     * of independent pairs until no pair is free. Since free pairs of
+     * a same sub-step are disjoint and stay free until removed, the
+     * removed cells do not depend on the order of removal: they are
+     * the same as with the sequential collapse, whatever the number
+     * of threads. Only the data of the remaining cells differ (the
+     * sequential version stores priorities in it).
+     *
      * @param iterations -- number of iterations
+     * @param inParallel -- when 'true', sub-steps are computed in parallel.
      * @return total number of removed cells.
      */
-    unsigned int eval ( unsigned int iterations );
+    unsigned int eval ( unsigned int iterations, bool inParallel = false );
 
     /**
      * Extension of basic algorithm---ParDirCollapse---which preserve
      * KSpace::dimension - 1 faces which are not included in any
      * KSpace::dimension cells.
+     * @param inParallel -- when 'true', sub-steps are computed in parallel (see eval).
      */
-    void collapseSurface();
+    void collapseSurface( bool inParallel = false );
 
     /**
      * Extension of basic algorithm---ParDirCollapse---which preserve
      * KSpace::dimension - 1 faces which are not included in any
      * KSpace::dimension cells. Moreover, cells to be kept have not to
      * be collapsible.
+     * @param inParallel -- when 'true', sub-steps are computed in parallel (see eval).
      */
-    void collapseIsthmus();
+    void collapseIsthmus( bool inParallel = false );
 
     // ------------------------- Internals ------------------------------------
 private:
@@ -181,6 +196,27 @@ private:
      */
     bool isIsthmus ( CellMapConstIterator F );
 
+    /**
+     * Computes in parallel the non fixed cells of the boundary of the
+     * complex, sorted, dimension per dimension.
+     * @param faces -- (output) faces[ d ] is the sorted vector of the
+     * non fixed boundary cells of dimension d, for d < KSpace::dimension.
+     */
+    void computeBoundaryFaces ( std::vector< std::vector<Cell> > & faces ) const;
+
+    /**
+     * Parallel version of a sub-step of eval: removes the free pairs
+     * (F,G) of the complex such that F is in \a F and G is the
+     * coface of F of direction \a dir and orientation \a orient.
+     * @param F -- sorted non fixed cells of dimension \a dim of the
+     * boundary of the complex, at the beginning of the iteration.
+     * @param dir -- freepair direction.
+     * @param orient -- freepair orientation.
+     * @param dim -- dimension of the faces F.
+     * @return number of removed cells.
+     */
+    unsigned int collapseInParallel ( const std::vector<Cell> & F, int dir, int orient, Dimension dim );
+
     // ------------------------- Hidden services ------------------------------
 protected:
     /**
@@ -0,0 +1,389 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelNeighborhoodIndex.h
+ * @author DGtal team
+ *
+ * @date 2016/11/12
+ *
+ * Header file for template class SurfelNeighborhoodIndex
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelNeighborhoodIndex_RECURSES)
+#error Recursive header files inclusion detected in SurfelNeighborhoodIndex.h
+#else // defined(SurfelNeighborhoodIndex_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelNeighborhoodIndex_RECURSES
+
+#if !defined SurfelNeighborhoodIndex_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelNeighborhoodIndex_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelNeighborhoodIndex
+  /**
+     Description of template class 'SurfelNeighborhoodIndex' <p>
+     \brief Aim: An index of the surfels of a digital surface, which
+     numbers them from 0 to size()-1 and stores their adjacency in a
+     compressed sparse row layout (an offset array and a single array
+     of neighbor indices), for gathering repeatedly the surfels around
+     a given surfel.
+
+     The method gather() returns the surfels whose distance to a center
+     is less than a radius and which are connected to it within this
+     ball, in the order of a DistanceBreadthFirstVisitor (same nodes,
+     same order). The method geodesicGather() returns the surfels whose
+     geodesic distance to a center (shortest path along the adjacency,
+     for given edge lengths) is less than a radius.
+
+     Gathers use epoch-stamped marks and work buffers kept between
+     calls (a Workspace), so that no memory is allocated once buffers
+     have reached their maximal size. The gathers without a Workspace
+     argument use the one of the index and fill its cache: they are
+     not thread-safe, although they are const. The gathers taking a
+     Workspace only read the index, so several threads may share an
+     index as long as each one has its own Workspace.
+
+     Neighborhoods returned by gather() may also be cached for a given
+     radius (see enableCache()), so that several estimators using the
+     same metric and radius on the same surface share them.
+
+     @code
+     typedef SurfelNeighborhoodIndex< SurfaceContainer > NeighborhoodIndex;
+     NeighborhoodIndex index( surface );
+     const NeighborhoodIndex::Neighborhood & nodes =
+       index.gather( index.index( s ), distance, 5.0 );
+     @endcode
+
+     @tparam TDigitalSurfaceContainer any model of CDigitalSurfaceContainer.
+     @tparam TScalar the type of distances, e.g. double.
+
+     @see LocalEstimatorFromSurfelFunctorAdapter
+  */
+  template <typename TDigitalSurfaceContainer, typename TScalar = double>
+  class SurfelNeighborhoodIndex
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer<TDigitalSurfaceContainer> ));
+
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef SurfelNeighborhoodIndex<TDigitalSurfaceContainer, TScalar> Self;
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;
+    typedef typename Surface::Surfel Surfel;
+    typedef TScalar Scalar;
+    /// The index of a surfel.
+    typedef DGtal::uint32_t Index;
+    /// A gathered surfel (its index) and its distance to the center.
+    typedef std::pair<Index, Scalar> Node;
+    /// The surfels gathered around a center.
+    typedef std::vector<Node> Neighborhood;
+    /// Iterator on the neighbors of a surfel.
+    typedef const Index * NeighborConstIterator;
+
+    /**
+       The work buffers of a gathering. They are sized on first use
+       and kept between gatherings, so that a Workspace per thread
+       allows concurrent gatherings on the same index.
+    */
+    struct Workspace
+    {
+      /// Surfel i is marked iff stamps[ i ] == epoch.
+      std::vector<DGtal::uint32_t> stamps;
+      /// The current traversal number.
+      DGtal::uint32_t epoch;
+      /// The priority queue, as a heap.
+      Neighborhood heap;
+      /// The result of the last gathering.
+      Neighborhood nodes;
+      /// The tentative distances of geodesicGather.
+      std::vector<Scalar> distances;
+
+      /// Constructor. Buffers are empty.
+      Workspace() : epoch( 0 ) {}
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Default constructor. The object is not valid.
+    */
+    SurfelNeighborhoodIndex();
+
+    /**
+       Constructor. Indexes the surfels of the given surface.
+       @param aSurface the digital surface, aliased in this.
+    */
+    SurfelNeighborhoodIndex( ConstAlias<Surface> aSurface );
+
+    /**
+       Destructor.
+    */
+    ~SurfelNeighborhoodIndex();
+
+    /**
+       Indexes the surfels of the given surface and their adjacency.
+       Disables the cache.
+       @param aSurface the digital surface, aliased in this.
+    */
+    void init( ConstAlias<Surface> aSurface );
+
+    // ----------------------- Index services --------------------------------
+  public:
+
+    /// @return the indexed surface.
+    const Surface & surface() const;
+
+    /// @return the number of surfels.
+    Index size() const;
+
+    /**
+       @param i any index in 0..size()-1.
+       @return the surfel of index @a i.
+    */
+    const Surfel & surfel( Index i ) const;
+
+    /**
+       @param s any surfel.
+       @return 'true' if @a s is a surfel of the indexed surface.
+    */
+    bool isIndexed( const Surfel & s ) const;
+
+    /**
+       @param s any surfel of the indexed surface.
+       @return its index.
+    */
+    Index index( const Surfel & s ) const;
+
+    /**
+       @param i any index in 0..size()-1.
+       @return the number of neighbors of surfel @a i.
+    */
+    Index degree( Index i ) const;
+
+    /// @param i any index in 0..size()-1.
+    /// @return an iterator on the first neighbor of surfel @a i.
+    NeighborConstIterator neighborsBegin( Index i ) const;
+
+    /// @param i any index in 0..size()-1.
+    /// @return an iterator after the last neighbor of surfel @a i.
+    NeighborConstIterator neighborsEnd( Index i ) const;
+
+    // ----------------------- Gathering services ----------------------------
+  public:
+
+    /**
+       Gathers the surfels around @a center, visiting them by
+       increasing distance as a DistanceBreadthFirstVisitor does, and
+       stopping at the first one whose distance is not less than @a
+       radius.
+
+       If the cache is enabled for @a radius, the neighborhood of @a
+       center is computed only once.
+
+       @tparam TDistance the type of a functor Index -> Scalar.
+       @param center the index of the center surfel.
+       @param distance gives the distance of any surfel to @a center.
+       @param radius the radius of the neighborhood.
+       @return the gathered nodes in visiting order, which are valid
+       until the next gathering (or until the cache is disabled).
+
+       @note Not thread-safe: uses the workspace and the cache of the index.
+    */
+    template <typename TDistance>
+    const Neighborhood & gather( Index center, const TDistance & distance,
+                                 Scalar radius ) const;
+
+    /**
+       Same as gather( center, distance, radius ) but with the work
+       buffers of the caller and without using the cache. Several
+       threads may call it at once with distinct workspaces.
+
+       @tparam TDistance the type of a functor Index -> Scalar.
+       @param[in,out] workspace the work buffers.
+       @param center the index of the center surfel.
+       @param distance gives the distance of any surfel to @a center.
+       @param radius the radius of the neighborhood.
+       @return the gathered nodes in visiting order (workspace.nodes).
+    */
+    template <typename TDistance>
+    const Neighborhood & gather( Workspace & workspace, Index center,
+                                 const TDistance & distance, Scalar radius ) const;
+
+    /**
+       Gathers the surfels whose geodesic distance to @a center is less
+       than @a radius, i.e. the length of a shortest path along the
+       adjacency, the length of an edge being given by @a edgeLength.
+
+       @tparam TEdgeLength the type of a functor (Index, Index) -> Scalar.
+       @param center the index of the center surfel.
+       @param edgeLength gives the (positive) length of an edge between two neighbors.
+       @param radius the radius of the neighborhood.
+       @return the gathered nodes by increasing distance, which are valid
+       until the next gathering.
+
+       @note Not thread-safe: uses the workspace of the index.
+    */
+    template <typename TEdgeLength>
+    const Neighborhood & geodesicGather( Index center, const TEdgeLength & edgeLength,
+                                         Scalar radius ) const;
+
+    /**
+       Same as geodesicGather( center, edgeLength, radius ) but with
+       the work buffers of the caller.
+
+       @tparam TEdgeLength the type of a functor (Index, Index) -> Scalar.
+       @param[in,out] workspace the work buffers.
+       @param center the index of the center surfel.
+       @param edgeLength gives the (positive) length of an edge between two neighbors.
+       @param radius the radius of the neighborhood.
+       @return the gathered nodes by increasing distance (workspace.nodes).
+    */
+    template <typename TEdgeLength>
+    const Neighborhood & geodesicGather( Workspace & workspace, Index center,
+                                         const TEdgeLength & edgeLength,
+                                         Scalar radius ) const;
+
+    /**
+       Enables the cache of the neighborhoods computed by gather() for
+       the given radius. All gathers at this radius must then use the
+       same distance (e.g. the same metric and embedding).
+       @param radius the radius of the cached neighborhoods.
+    */
+    void enableCache( Scalar radius );
+
+    /**
+       Disables the cache and frees its memory.
+    */
+    void disableCache();
+
+    /**
+       @param radius any radius.
+       @return 'true' if neighborhoods are cached for this radius.
+    */
+    bool isCached( Scalar radius ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       Sizes the buffers of @a workspace for this index if needed and
+       starts a new traversal: all surfels become unmarked.
+       @param[in,out] workspace the work buffers.
+    */
+    void newEpoch( Workspace & workspace ) const;
+
+    /**
+       Gathers the neighborhood of @a center into @a nodes (see gather).
+       @param[in,out] workspace the work buffers.
+       @param[out] nodes the gathered nodes.
+       @param center the index of the center surfel.
+       @param distance gives the distance of any surfel to @a center.
+       @param radius the radius of the neighborhood.
+    */
+    template <typename TDistance>
+    void gatherInto( Workspace & workspace, Neighborhood & nodes, Index center,
+                     const TDistance & distance, Scalar radius ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The indexed surface.
+    CountedConstPtrOrConstPtr<Surface> mySurface;
+    /// The surfels, by index.
+    std::vector<Surfel> mySurfels;
+    /// The index of each surfel.
+    std::unordered_map<Surfel, Index> myIndices;
+    /// The neighbors of surfel i are myNeighbors[ myOffsets[ i ] .. myOffsets[ i+1 ] - 1 ].
+    std::vector<Index> myOffsets;
+    /// The neighbors of all surfels.
+    std::vector<Index> myNeighbors;
+    /// The work buffers of the gathers without workspace argument.
+    mutable Workspace myWorkspace;
+    /// 'true' iff the neighborhoods at myCacheRadius are cached.
+    bool myCacheEnabled;
+    /// The radius of cached neighborhoods.
+    Scalar myCacheRadius;
+    /// Cached neighborhoods, by index of center.
+    mutable std::vector<Neighborhood> myCache;
+    /// Tells which neighborhoods are cached.
+    mutable std::vector<bool> myCached;
+
+  }; // end of class SurfelNeighborhoodIndex
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelNeighborhoodIndex'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelNeighborhoodIndex' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer, typename TScalar>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const SurfelNeighborhoodIndex<TDigitalSurfaceContainer, TScalar> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SurfelNeighborhoodIndex.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelNeighborhoodIndex_h
+
+#undef SurfelNeighborhoodIndex_RECURSES
+#endif // else defined(SurfelNeighborhoodIndex_RECURSES)
@@ -45,6 +45,7 @@
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/graph/ConcurrentBitmapMarkSet.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -227,6 +228,48 @@ namespace DGtal
             const PointPredicate & pp,
             const SCell & start_surfel );
 
+    /**
+       Parallel version of trackBoundary (or of trackClosedBoundary
+       when @a closed is 'true'): writes the surfels of the boundary
+       component of the shape described by [pp] which touches
+       [start_surfel] on the output iterator @a out_it.
+
+       The tracking is a level-synchronous breadth-first traversal:
+       the surfels of the current level (frontier) are shared among
+       threads (OpenMP), each thread collecting the neighbors it
+       discovers in its own frontier. Surfels are marked as visited
+       in a ConcurrentBitmapMarkSet over the Khalimsky space, so that
+       each one is discovered by exactly one thread. The next
+       frontier is the union of the thread frontiers, sorted.
+
+       Surfels are written level by level, each level sorted by
+       increasing cell: the output does not depend on the number of
+       threads.
+
+       @tparam OutputIterator any output iterator on SCell (like
+       std::back_insert_iterator< std::vector<SCell> >).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate,
+       whose evaluation must be thread-safe.
+
+       @param out_it any output iterator for writing the signed surfels.
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+       @param closed when 'true', the boundary is known to be closed
+       and only direct orientations are followed (see trackClosedBoundary).
+    */
+    template <typename OutputIterator, typename PointPredicate >
+    static
+    void parallelTrackBoundary( OutputIterator & out_it,
+                                const KSpace & K,
+                                const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                const PointPredicate & pp,
+                                const SCell & start_surfel,
+                                bool closed = false );
+
 
     /**
        Function that extracts a n-1 digital surface (specified by a
@@ -714,6 +757,49 @@ namespace DGtal
                         const Point & aLowerBound, 
                         const Point & aUpperBound  );
 
+    /**
+       Extracts in a single pass the boundaries between all the labels
+       of a label image: for each pair of labels (a,b), a < b, whose
+       regions touch, the signed surfels between a spel labelled a and
+       a spel labelled b, oriented as in sMakeBoundary for the shape
+       {label == a}. Hence the boundary of the shape {label == a} is
+       the union of the surfels of the pairs (a,x) and of the
+       opposites of the surfels of the pairs (x,a).
+
+       The domain is split into slabs along the last axis, which are
+       scanned in parallel (OpenMP), each slab filling its own map.
+       The slab maps are then appended in slab order, so that the
+       surfels of each pair are in the order of a sequential scan
+       (spel by spel, then axis by axis), whatever the number of
+       threads.
+
+       Each sequence of surfels may fill a SetOfSurfels (e.g. with
+       std::set<SCell>( v.begin(), v.end() )) to build a DigitalSurface.
+
+       @tparam LabelPairMap a map from std::pair<Label,Label> to a
+       sequence of SCell (e.g. std::map< std::pair<int,int>,
+       std::vector<SCell> >).
+
+       @tparam LabelImage a model of concepts::CConstImage (its Value
+       being the label), whose evaluation must be thread-safe.
+
+       @param aBoundaries (modified) the surfels are appended to the
+       sequences of the pairs of labels.
+
+       @param aKSpace any space.
+       @param anImage the label image.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundaries.
+    */
+    template <typename LabelPairMap, typename LabelImage >
+    static
+    void sMakeLabelBoundaries( LabelPairMap & aBoundaries,
+                               const KSpace & aKSpace,
+                               const LabelImage & anImage,
+                               const Point & aLowerBound,
+                               const Point & aUpperBound );
+
     /**
        Writes on the output iterator @a out_it the unsigned surfels
        whose elements represents all the boundary elements of a
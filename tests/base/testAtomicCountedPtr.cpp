@@ -0,0 +1,116 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testAtomicCountedPtr.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/22
+ *
+ * Functions for testing the atomic reference counts of CountedPtr,
+ * CountedPtrOrPtr and CowPtr, shared between OpenMP threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+// Atomic counts, whatever the configuration of the library.
+#ifndef DGTAL_ATOMIC_COUNTED_PTR
+#define DGTAL_ATOMIC_COUNTED_PTR
+#endif
+#include <vector>
+#include <atomic>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/CountedPtrOrPtr.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+namespace
+{
+  /// Number of instances of Data alive.
+  std::atomic<int> nbData( 0 );
+
+  struct Data
+  {
+    Data() : values( 1000, 1 ) { ++nbData; }
+    Data( const Data & other ) : values( other.values ) { ++nbData; }
+    ~Data() { --nbData; }
+    std::vector<int> values;
+  };
+
+  const std::ptrdiff_t NB_TASKS = 20000;
+}
+
+TEST_CASE( "Testing atomic CountedPtr" )
+{
+  {
+    CountedPtr<Data> shared( new Data );
+    std::ptrdiff_t nbCopies = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:nbCopies)
+#endif
+    for ( std::ptrdiff_t i = 0; i < NB_TASKS; i++ )
+      {
+        CountedPtr<Data> p( shared );
+        CountedPtr<Data> q;
+        q = p;
+        CountedPtrOrPtr<Data> r( q );
+        if ( r->values[ i % 1000 ] == 1 && p.count() >= 4 ) ++nbCopies;
+      }
+    REQUIRE( nbCopies == NB_TASKS );
+    REQUIRE( shared.unique() );
+    REQUIRE( nbData == 1 );
+  }
+  REQUIRE( nbData == 0 );
+}
+
+TEST_CASE( "Testing atomic CowPtr" )
+{
+  {
+    CowPtr<Data> shared( new Data );
+    std::ptrdiff_t sum = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+:sum)
+#endif
+    for ( std::ptrdiff_t i = 0; i < NB_TASKS; i++ )
+      {
+        CowPtr<Data> p( shared );
+        const CowPtr<Data> & cp = p;
+        sum += cp->values[ i % 1000 ];
+        if ( i % 7 == 0 )
+          {
+            // Detaches the copy before writing to it.
+            p->values[ i % 1000 ] = 2;
+            sum += p->values[ i % 1000 ] - 2;
+          }
+      }
+    REQUIRE( sum == NB_TASKS );
+    REQUIRE( shared.unique() );
+    const CowPtr<Data> & cshared = shared;
+    for ( std::size_t j = 0; j < 1000; j++ )
+      REQUIRE( cshared->values[ j ] == 1 );
+    REQUIRE( nbData == 1 );
+  }
+  REQUIRE( nbData == 0 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
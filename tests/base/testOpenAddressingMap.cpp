@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOpenAddressingMap.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/23
+ *
+ * Functions for testing class OpenAddressingMap against std::map.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingMap.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef OpenAddressingMap<int, std::string> Map;
+typedef std::map<int, std::string> RefMap;
+
+namespace
+{
+  /// @return 'true' if both maps have the same pairs.
+  bool sameContent( const Map & m, const RefMap & ref )
+  {
+    if ( m.size() != ref.size() ) return false;
+    std::size_t nb = 0;
+    for ( Map::const_iterator it = m.begin(); it != m.end(); ++it, ++nb )
+      {
+        RefMap::const_iterator itRef = ref.find( it->first );
+        if ( itRef == ref.end() || itRef->second != it->second ) return false;
+      }
+    return nb == ref.size();
+  }
+}
+
+TEST_CASE( "OpenAddressingMap services", "[open_addressing_map]" )
+{
+  Map m;
+  REQUIRE( m.empty() );
+  REQUIRE( m.begin() == m.end() );
+  REQUIRE( m.find( 3 ) == m.end() );
+  REQUIRE( m.count( 3 ) == 0 );
+
+  SECTION( "Insertion, lookup and erasure" )
+    {
+      REQUIRE( m.insert( std::make_pair( 3, std::string( "three" ) ) ).second );
+      REQUIRE( ! m.insert( std::make_pair( 3, std::string( "trois" ) ) ).second );
+      m[ 5 ] = "five";
+      REQUIRE( m.size() == 2 );
+      REQUIRE( m.find( 3 )->second == "three" );
+      REQUIRE( m.count( 5 ) == 1 );
+      REQUIRE( std::distance( m.equal_range( 5 ).first, m.equal_range( 5 ).second ) == 1 );
+      REQUIRE( m.erase( 3 ) == 1 );
+      REQUIRE( m.erase( 3 ) == 0 );
+      REQUIRE( m.size() == 1 );
+      REQUIRE( m.begin()->first == 5 );
+      REQUIRE( m.isValid() );
+    }
+
+  SECTION( "Random operations give the same content as std::map" )
+    {
+      RefMap ref;
+      srand( 0 );
+      for ( int i = 0; i < 20000; ++i )
+        {
+          const int key = rand() % 1000;
+          const int op  = rand() % 3;
+          if ( op == 0 )
+            {
+              m.erase( key );
+              ref.erase( key );
+            }
+          else
+            {
+              m[ key ] = std::to_string( i );
+              ref[ key ] = std::to_string( i );
+            }
+        }
+      REQUIRE( m.isValid() );
+      REQUIRE( sameContent( m, ref ) );
+      Map copy( m );
+      REQUIRE( sameContent( copy, ref ) );
+      m.clear();
+      REQUIRE( m.empty() );
+      REQUIRE( m.begin() == m.end() );
+      REQUIRE( sameContent( copy, ref ) );
+    }
+
+  SECTION( "Erasing while iterating visits every pair once" )
+    {
+      for ( int i = 0; i < 1000; ++i ) m[ i ] = "x";
+      std::set<int> visited;
+      for ( Map::iterator it = m.begin(), itE = m.end(); it != itE; )
+        {
+          visited.insert( it->first );
+          if ( it->first % 2 == 0 ) it = m.erase( it );
+          else ++it;
+        }
+      REQUIRE( visited.size() == 1000 );
+      REQUIRE( m.size() == 500 );
+      REQUIRE( m.isValid() );
+      m.erase( m.begin(), m.end() );
+      REQUIRE( m.empty() );
+    }
+
+  SECTION( "Set operations through SetFunctions" )
+    {
+      Map a, b;
+      for ( int i = 0; i < 100; ++i ) a[ i ] = "a";
+      for ( int i = 50; i < 150; ++i ) b[ i ] = "b";
+      Map c = a;
+      functions::setops::operator&=( c, b );
+      REQUIRE( c.size() == 50 );
+      c = a;
+      functions::setops::operator|=( c, b );
+      REQUIRE( c.size() == 150 );
+      c = a;
+      functions::setops::operator-=( c, b );
+      REQUIRE( c.size() == 50 );
+      c = a;
+      functions::setops::operator^=( c, b );
+      REQUIRE( c.size() == 100 );
+      REQUIRE( c.isValid() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
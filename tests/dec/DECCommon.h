@@ -2,6 +2,7 @@
 #define __DEC_TESTS_COMMON_H__
 
 #include <list>
+#include <cstdlib>
 
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
 #include "DGtal/base/Common.h"
@@ -552,5 +553,16 @@ test_backend(const int& ntime, const int& maxdim)
     test_concepts<LinearAlgebraBackend>();
 }
 
+/// @return a kform with random values in [-0.5, 0.5].
+template <typename KForm>
+KForm
+random_form(const typename KForm::Calculus& calculus)
+{
+    KForm form(calculus);
+    for (typename KForm::Index ii=0; ii<form.length(); ii++)
+        form.myContainer(ii) = std::rand() / double(RAND_MAX) - 0.5;
+    return form;
+}
+
 #endif
 
@@ -0,0 +1,173 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusSolver.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/12/12
+ *
+ * Functions for testing the symbolic analysis reuse, warm starts and
+ * statistics of DiscreteExteriorCalculusSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/MultigridSolver.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DECCommon.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// Statistics hook recording the number of calls and the last statistics.
+  template <typename TSolver>
+  struct Recorder
+  {
+    unsigned int nbCompute;
+    unsigned int nbSolve;
+    typename TSolver::Statistics last;
+
+    Recorder() : nbCompute( 0 ), nbSolve( 0 ) {}
+
+    static void hook( const typename TSolver::Statistics & statistics, void * data )
+    {
+      Recorder * recorder = static_cast<Recorder *>( data );
+      if ( statistics.solve ) recorder->nbSolve++;
+      else recorder->nbCompute++;
+      recorder->last = statistics;
+    }
+  };
+}
+
+TEST_CASE( "Testing DiscreteExteriorCalculusSolver" )
+{
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  std::srand( 0 );
+
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 24, 19 ) );
+  Z2i::DigitalSet set( domain );
+  set.insertNew( domain.begin(), domain.end() );
+  const auto calculus = CalculusFactory::createFromDigitalSet( set );
+  typedef std::decay<decltype( calculus )>::type Calculus;
+
+  const Calculus::PrimalIdentity0 id = calculus.identity<0, PRIMAL>();
+  const Calculus::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+  const Calculus::PrimalForm0 input = random_form<Calculus::PrimalForm0>( calculus );
+
+  SECTION( "Symbolic analysis reuse of direct solvers" )
+    {
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSparseLU, 0, PRIMAL, 0, PRIMAL> Solver;
+      Recorder<Solver> recorder;
+
+      Solver solver;
+      solver.setStatisticsHook( &Recorder<Solver>::hook, &recorder );
+      solver.compute( laplace + 0.1 * id );
+      REQUIRE( ! solver.statistics().patternReused );
+      REQUIRE( recorder.nbCompute == 1 );
+
+      // only the diagonal changes: the analysis is reused
+      solver.compute( laplace + 0.2 * id );
+      REQUIRE( solver.isValid() );
+      REQUIRE( solver.statistics().patternReused );
+      REQUIRE( recorder.last.patternReused );
+      const Calculus::PrimalForm0 solution = solver.solve( input );
+      REQUIRE( recorder.nbSolve == 1 );
+      REQUIRE( recorder.last.iterations == -1 );
+
+      Solver fresh_solver;
+      fresh_solver.compute( laplace + 0.2 * id );
+      const Calculus::PrimalForm0 reference = fresh_solver.solve( input );
+      REQUIRE( ( solution.myContainer - reference.myContainer ).norm() < 1e-10 * reference.myContainer.norm() );
+
+      // the guess is ignored by direct solvers
+      const Calculus::PrimalForm0 guessed = solver.solve( input, input );
+      REQUIRE( ( guessed.myContainer - reference.myContainer ).norm() < 1e-10 * reference.myContainer.norm() );
+
+      // new pattern
+      solver.compute( id );
+      REQUIRE( ! solver.statistics().patternReused );
+      REQUIRE( ( solver.solve( input ).myContainer - input.myContainer ).norm() < 1e-10 );
+
+      solver.myReusePattern = false;
+      solver.compute( id );
+      REQUIRE( ! solver.statistics().patternReused );
+      REQUIRE( recorder.nbCompute == 4 );
+    }
+
+  SECTION( "Warm starts of iterative solvers" )
+    {
+      // hodge * (laplace + id) is symmetric positive definite
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradient, 0, PRIMAL, 2, DUAL> Solver;
+      const Calculus::PrimalHodge0 hodge = calculus.hodge<0, PRIMAL>();
+      const Calculus::DualForm2 dual_input = hodge * input;
+
+      // iterative solvers keep a reference to the operator
+      const Calculus::PrimalHodge0 problem = hodge * ( laplace + 0.1 * id );
+      const Calculus::PrimalHodge0 next_problem = hodge * ( laplace + 0.11 * id );
+
+      Solver solver;
+      solver.myLinearAlgebraSolver.setTolerance( 1e-10 );
+      solver.compute( problem );
+      const Calculus::PrimalForm0 solution = solver.solve( dual_input );
+      REQUIRE( solver.isValid() );
+      const int cold_iterations = solver.statistics().iterations;
+      REQUIRE( cold_iterations > 0 );
+      REQUIRE( solver.statistics().error >= 0 );
+
+      solver.compute( next_problem );
+      REQUIRE( solver.statistics().patternReused );
+      solver.solve( dual_input, solution );
+      REQUIRE( solver.isValid() );
+      REQUIRE( solver.statistics().iterations < cold_iterations );
+    }
+
+  SECTION( "Multigrid solver" )
+    {
+      typedef MultigridSolver<Calculus, 0, PRIMAL> Multigrid;
+      typedef DiscreteExteriorCalculusSolver<Calculus, Multigrid, 0, PRIMAL, 0, PRIMAL> Solver;
+
+      Solver solver;
+      solver.myLinearAlgebraSolver.attachCalculus( calculus );
+      solver.myLinearAlgebraSolver.myCoarsestSize = 16;
+      solver.compute( laplace + 0.1 * id );
+      const Calculus::PrimalForm0 solution = solver.solve( input );
+      REQUIRE( solver.isValid() );
+      REQUIRE( solver.statistics().iterations == solver.myLinearAlgebraSolver.iterations() );
+
+      solver.compute( laplace + 0.1 * id );
+      REQUIRE( solver.statistics().patternReused );
+      REQUIRE( solver.myLinearAlgebraSolver.nbLevels() > 2 );
+      solver.solve( input, solution );
+      REQUIRE( solver.statistics().iterations == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
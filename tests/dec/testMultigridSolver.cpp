@@ -0,0 +1,140 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMultigridSolver.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/12/05
+ *
+ * Functions for testing class MultigridSolver against direct solvers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/MultigridSolver.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DECCommon.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// @return the digital ball of radius @a radius centered at the origin.
+  template <typename TDigitalSet>
+  TDigitalSet ball( const typename TDigitalSet::Domain & domain, const double radius )
+  {
+    TDigitalSet set( domain );
+    for ( typename TDigitalSet::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+      if ( ( *it ).norm() <= radius ) set.insertNew( *it );
+    return set;
+  }
+
+  /// @return 'true' if the multigrid solution of @a problem is the direct one.
+  template <typename TCalculus, Duality duality>
+  bool sameSolution( const TCalculus & calculus, const LinearOperator<TCalculus, 0, duality, 0, duality> & problem )
+  {
+    typedef DGtal::KForm<TCalculus, 0, duality> KForm;
+    typedef MultigridSolver<TCalculus, 0, duality> Multigrid;
+    typedef DiscreteExteriorCalculusSolver<TCalculus, Multigrid, 0, duality, 0, duality> Solver;
+    typedef DiscreteExteriorCalculusSolver<TCalculus, EigenLinearAlgebraBackend::SolverSparseLU, 0, duality, 0, duality> DirectSolver;
+
+    const KForm input = random_form<KForm>( calculus );
+
+    Solver solver;
+    solver.myLinearAlgebraSolver.attachCalculus( calculus );
+    solver.myLinearAlgebraSolver.myCoarsestSize = 32;
+    solver.myLinearAlgebraSolver.setTolerance( 1e-10 );
+    solver.compute( problem );
+    const KForm solution = solver.solve( input );
+    trace.info() << solver.myLinearAlgebraSolver << " iterations=" << solver.myLinearAlgebraSolver.iterations() << endl;
+
+    DirectSolver direct_solver;
+    direct_solver.compute( problem );
+    const KForm reference = direct_solver.solve( input );
+
+    return solver.isValid()
+      && solver.myLinearAlgebraSolver.nbLevels() > 2
+      && solver.myLinearAlgebraSolver.iterations() < 30
+      && ( solution.myContainer - reference.myContainer ).norm() < 1e-7 * reference.myContainer.norm();
+  }
+}
+
+TEST_CASE( "Testing MultigridSolver" )
+{
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  std::srand( 0 );
+
+  SECTION( "2D laplace problems on a disk" )
+    {
+      const Z2i::Domain domain( Z2i::Point::diagonal( -21 ), Z2i::Point::diagonal( 21 ) );
+      const auto calculus = CalculusFactory::createFromDigitalSet( ball<Z2i::DigitalSet>( domain, 20 ) );
+      REQUIRE( sameSolution( calculus, calculus.laplace<DUAL>() ) );
+      REQUIRE( sameSolution( calculus, calculus.laplace<PRIMAL>() + 0.1 * calculus.identity<0, PRIMAL>() ) );
+    }
+
+  SECTION( "3D laplace problems on a ball" )
+    {
+      const Z3i::Domain domain( Z3i::Point::diagonal( -9 ), Z3i::Point::diagonal( 9 ) );
+      const auto calculus = CalculusFactory::createFromDigitalSet( ball<Z3i::DigitalSet>( domain, 8 ) );
+      REQUIRE( sameSolution( calculus, calculus.laplace<DUAL>() ) );
+      REQUIRE( sameSolution( calculus, calculus.laplace<PRIMAL>() + 0.1 * calculus.identity<0, PRIMAL>() ) );
+    }
+
+  SECTION( "Warm start and status" )
+    {
+      const Z2i::Domain domain( Z2i::Point::diagonal( -11 ), Z2i::Point::diagonal( 11 ) );
+      const auto calculus = CalculusFactory::createFromDigitalSet( ball<Z2i::DigitalSet>( domain, 10 ) );
+      typedef std::decay<decltype( calculus )>::type Calculus;
+      typedef MultigridSolver<Calculus, 0, DUAL> Multigrid;
+
+      Multigrid solver;
+      REQUIRE( ! solver.isValid() );
+      solver.attachCalculus( calculus );
+      solver.myCoarsestSize = 16;
+      solver.compute( calculus.laplace<DUAL>().myContainer );
+      REQUIRE( solver.isValid() );
+      REQUIRE( solver.info() == Eigen::Success );
+
+      const Calculus::DenseVector input = random_form<Calculus::DualForm0>( calculus ).myContainer;
+      const Calculus::DenseVector solution = solver.solve( input );
+      REQUIRE( solver.info() == Eigen::Success );
+      REQUIRE( solver.iterations() > 0 );
+      REQUIRE( solver.error() <= 1e-8 );
+
+      solver.solveWithGuess( input, solution );
+      REQUIRE( solver.iterations() == 0 );
+
+      solver.setMaxIterations( 1 ).setTolerance( 1e-14 );
+      solver.solve( input );
+      REQUIRE( solver.info() == Eigen::NoConvergence );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
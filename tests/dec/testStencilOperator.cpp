@@ -0,0 +1,256 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStencilOperator.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/28
+ *
+ * Functions for testing the matrix-free operators of StencilCalculus
+ * against the assembled operators of DiscreteExteriorCalculus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/StencilCalculus.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DECCommon.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// @return 'true' if both operators give the same kform on a random kform.
+  template <typename TLinearOperator, typename TStencilOperator>
+  bool sameOperator( const TLinearOperator & assembled, const TStencilOperator & stencil )
+  {
+    typedef typename TLinearOperator::InputKForm InputKForm;
+    const InputKForm input = random_form<InputKForm>( *assembled.myCalculus );
+    const double error = ( assembled * input - stencil * input ).myContainer.norm();
+    return stencil.myContainer.rows() == assembled.myContainer.rows()
+      && stencil.myContainer.cols() == assembled.myContainer.cols()
+      && error < 1e-10 * ( 1 + input.myContainer.norm() );
+  }
+
+  /// @return 'true' if all operators of the stencil calculus are the assembled ones (2D).
+  template <typename TCalculus>
+  bool sameOperators2D( const TCalculus & calculus )
+  {
+    typedef StencilCalculus<TCalculus> Stencil;
+    const Stencil stencil( calculus );
+    bool ok = stencil.isValid();
+    ok = ok && sameOperator( calculus.template derivative<0, PRIMAL>(), stencil.template derivative<0, PRIMAL>() );
+    ok = ok && sameOperator( calculus.template derivative<1, PRIMAL>(), stencil.template derivative<1, PRIMAL>() );
+    ok = ok && sameOperator( calculus.template derivative<0, DUAL>(), stencil.template derivative<0, DUAL>() );
+    ok = ok && sameOperator( calculus.template derivative<1, DUAL>(), stencil.template derivative<1, DUAL>() );
+    ok = ok && sameOperator( calculus.template hodge<0, PRIMAL>(), stencil.template hodge<0, PRIMAL>() );
+    ok = ok && sameOperator( calculus.template hodge<1, PRIMAL>(), stencil.template hodge<1, PRIMAL>() );
+    ok = ok && sameOperator( calculus.template hodge<2, DUAL>(), stencil.template hodge<2, DUAL>() );
+    ok = ok && sameOperator( calculus.template hodge<1, DUAL>(), stencil.template hodge<1, DUAL>() );
+    ok = ok && sameOperator( calculus.template antiderivative<2, PRIMAL>(), stencil.template antiderivative<2, PRIMAL>() );
+    ok = ok && sameOperator( calculus.template antiderivative<1, DUAL>(), stencil.template antiderivative<1, DUAL>() );
+    ok = ok && sameOperator( calculus.template laplace<PRIMAL>(), stencil.template laplace<PRIMAL>() );
+    ok = ok && sameOperator( calculus.template laplace<DUAL>(), stencil.template laplace<DUAL>() );
+    ok = ok && sameOperator( calculus.template laplace<DUAL>() - 0.5 * calculus.template identity<0, DUAL>(),
+                             stencil.template laplace<DUAL>() - 0.5 * stencil.template identity<0, DUAL>() );
+    ok = ok && sameOperator( -( calculus.template derivative<1, PRIMAL>() * calculus.template derivative<0, PRIMAL>() ),
+                             -( stencil.template derivative<1, PRIMAL>() * stencil.template derivative<0, PRIMAL>() ) );
+    return ok;
+  }
+}
+
+TEST_CASE( "Testing StencilCalculus against DiscreteExteriorCalculus" )
+{
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  std::srand( 0 );
+
+  SECTION( "Full 2D box" )
+    {
+      const Z2i::Domain domain( Z2i::Point( -3, -2 ), Z2i::Point( 4, 3 ) );
+      Z2i::DigitalSet set( domain );
+      set.insertNew( domain.begin(), domain.end() );
+      const auto calculus = CalculusFactory::createFromDigitalSet( set );
+      typedef StencilCalculus<std::decay<decltype( calculus )>::type> Stencil;
+      const Stencil stencil( calculus );
+      REQUIRE( stencil.isFull() );
+      REQUIRE( stencil.gridSize() == 17 * 13 );
+      REQUIRE( sameOperators2D( calculus ) );
+    }
+
+  SECTION( "Full 2D box with cells of different sizes" )
+    {
+      const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 29, 24 ) );
+      Z2i::DigitalSet set( domain );
+      set.insertNew( domain.begin(), domain.end() );
+      auto calculus = CalculusFactory::createFromDigitalSet( set );
+      typedef std::decay<decltype( calculus )>::type Calculus;
+      const Calculus::Properties properties = calculus.getProperties();
+
+      // DEC only allows other primal sizes than 1 for 1-cells and
+      // 2-cells, and other dual sizes than 1 for 0-cells and 1-cells
+      struct Resize
+      {
+        static void cell( Calculus & calc, const Calculus::Cell & cell, const double primal_size, const double dual_size )
+        {
+          const Dimension dim = calc.myKSpace.uDim( cell );
+          calc.insertSCell( calc.myKSpace.signs( cell, Calculus::KSpace::POS ),
+                            dim == 0 ? 1 : primal_size, dim == 2 ? 1 : dual_size );
+        }
+      };
+
+      // every third cell has other sizes: hodge exceptions
+      unsigned int k = 0;
+      for ( Calculus::Properties::const_iterator it = properties.begin(); it != properties.end(); ++it )
+        if ( ( k++ ) % 3 == 0 )
+          Resize::cell( calculus, it->first, 2, 0.25 );
+      calculus.updateIndexes();
+      std::stringstream exceptions;
+      exceptions << StencilCalculus<Calculus>( calculus );
+      REQUIRE( exceptions.str().find( "hodge-by-cell" ) == std::string::npos );
+      REQUIRE( sameOperators2D( calculus ) );
+
+      // all cells have different sizes: hodge factors by cell
+      for ( Calculus::Properties::const_iterator it = properties.begin(); it != properties.end(); ++it )
+        Resize::cell( calculus, it->first, 1 + std::rand() % 100, 1 + std::rand() % 100 );
+      calculus.updateIndexes();
+      std::stringstream by_cell;
+      by_cell << StencilCalculus<Calculus>( calculus );
+      REQUIRE( by_cell.str().find( "hodge-by-cell" ) != std::string::npos );
+      REQUIRE( sameOperators2D( calculus ) );
+    }
+
+  SECTION( "2D box without border and with flipped cells" )
+    {
+      const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 6, 4 ) );
+      Z2i::DigitalSet set( domain );
+      set.insertNew( domain.begin(), domain.end() );
+      auto calculus = CalculusFactory::createFromDigitalSet( set, false );
+      typedef std::decay<decltype( calculus )>::type Calculus;
+      REQUIRE( ! StencilCalculus<Calculus>( calculus ).isFull() );
+      REQUIRE( sameOperators2D( calculus ) );
+
+      // flips every other 1-cell
+      const Calculus::Properties properties = calculus.getProperties();
+      unsigned int k = 0;
+      for ( Calculus::Properties::const_iterator it = properties.begin(); it != properties.end(); ++it )
+        if ( calculus.myKSpace.uDim( it->first ) == 1 && ( k++ ) % 2 == 0 )
+          calculus.insertSCell( calculus.myKSpace.signs( it->first, Calculus::KSpace::NEG ),
+                                it->second.primal_size, it->second.dual_size );
+      calculus.updateIndexes();
+      REQUIRE( sameOperators2D( calculus ) );
+    }
+
+  SECTION( "Full 3D box" )
+    {
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 4, 2, 3 ) );
+      Z3i::DigitalSet set( domain );
+      set.insertNew( domain.begin(), domain.end() );
+      const auto calculus = CalculusFactory::createFromDigitalSet( set );
+      typedef StencilCalculus<std::decay<decltype( calculus )>::type> Stencil;
+      const Stencil stencil( calculus );
+      REQUIRE( stencil.isFull() );
+      REQUIRE( sameOperator( calculus.derivative<0, PRIMAL>(), stencil.derivative<0, PRIMAL>() ) );
+      REQUIRE( sameOperator( calculus.derivative<1, PRIMAL>(), stencil.derivative<1, PRIMAL>() ) );
+      REQUIRE( sameOperator( calculus.derivative<2, PRIMAL>(), stencil.derivative<2, PRIMAL>() ) );
+      REQUIRE( sameOperator( calculus.derivative<0, DUAL>(), stencil.derivative<0, DUAL>() ) );
+      REQUIRE( sameOperator( calculus.derivative<1, DUAL>(), stencil.derivative<1, DUAL>() ) );
+      REQUIRE( sameOperator( calculus.derivative<2, DUAL>(), stencil.derivative<2, DUAL>() ) );
+      REQUIRE( sameOperator( calculus.hodge<1, PRIMAL>(), stencil.hodge<1, PRIMAL>() ) );
+      REQUIRE( sameOperator( calculus.hodge<2, DUAL>(), stencil.hodge<2, DUAL>() ) );
+      REQUIRE( sameOperator( calculus.antiderivative<2, PRIMAL>(), stencil.antiderivative<2, PRIMAL>() ) );
+      REQUIRE( sameOperator( calculus.antiderivative<3, DUAL>(), stencil.antiderivative<3, DUAL>() ) );
+      REQUIRE( sameOperator( calculus.laplace<PRIMAL>(), stencil.laplace<PRIMAL>() ) );
+      REQUIRE( sameOperator( calculus.laplace<DUAL>(), stencil.laplace<DUAL>() ) );
+    }
+}
+
+TEST_CASE( "Testing StencilOperator with iterative solvers" )
+{
+  typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+  std::srand( 0 );
+
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 19, 14 ) );
+  Z2i::DigitalSet set( domain );
+  set.insertNew( domain.begin(), domain.end() );
+  const auto calculus = CalculusFactory::createFromDigitalSet( set );
+  typedef std::decay<decltype( calculus )>::type Calculus;
+  typedef StencilCalculus<Calculus> Stencil;
+  const Stencil stencil( calculus );
+
+  SECTION( "BiCGSTAB on a screened laplace problem" )
+    {
+      typedef Stencil::PrimalLaplace Laplace;
+      typedef DiscreteExteriorCalculusSolver<Calculus, Laplace::SolverBiCGSTAB, 0, PRIMAL, 0, PRIMAL, Laplace> StencilSolver;
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSparseLU, 0, PRIMAL, 0, PRIMAL> Solver;
+
+      const Laplace problem = 0.1 * stencil.identity<0, PRIMAL>() - stencil.laplace<PRIMAL>();
+      const Calculus::PrimalForm0 input = random_form<Calculus::PrimalForm0>( calculus );
+
+      StencilSolver stencil_solver;
+      stencil_solver.myLinearAlgebraSolver.setTolerance( 1e-12 );
+      stencil_solver.compute( problem );
+      const Calculus::PrimalForm0 solution = stencil_solver.solve( input );
+      REQUIRE( stencil_solver.isValid() );
+
+      Solver solver;
+      solver.compute( 0.1 * calculus.identity<0, PRIMAL>() - calculus.laplace<PRIMAL>() );
+      const Calculus::PrimalForm0 reference = solver.solve( input );
+      REQUIRE( ( solution.myContainer - reference.myContainer ).norm() < 1e-8 * reference.myContainer.norm() );
+    }
+
+  SECTION( "Conjugate gradient on a symmetric problem" )
+    {
+      // hodge * laplace is symmetric, positive with the sign below
+      typedef StencilOperator<Stencil, 0, PRIMAL, 2, DUAL> Operator;
+      typedef DiscreteExteriorCalculusSolver<Calculus, Operator::SolverConjugateGradient, 0, PRIMAL, 2, DUAL, Operator> StencilSolver;
+      typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, PRIMAL, 2, DUAL> Solver;
+
+      const Operator problem = stencil.hodge<0, PRIMAL>() * ( 0.1 * stencil.identity<0, PRIMAL>() - stencil.laplace<PRIMAL>() );
+      const Calculus::DualForm2 input = random_form<Calculus::DualForm2>( calculus );
+
+      StencilSolver stencil_solver;
+      stencil_solver.myLinearAlgebraSolver.setTolerance( 1e-12 );
+      stencil_solver.compute( problem );
+      const Calculus::PrimalForm0 solution = stencil_solver.solve( input );
+      REQUIRE( stencil_solver.isValid() );
+
+      const Calculus::PrimalHodge0 hodge = calculus.hodge<0, PRIMAL>();
+      const Calculus::PrimalHodge0 assembled = hodge * ( 0.1 * calculus.identity<0, PRIMAL>() - calculus.laplace<PRIMAL>() );
+      const double asymmetry = ( Calculus::SparseMatrix( assembled.myContainer.transpose() ) - assembled.myContainer ).norm();
+      REQUIRE( asymmetry < 1e-10 );
+      Solver solver;
+      solver.compute( assembled );
+      const Calculus::PrimalForm0 reference = solver.solve( input );
+      REQUIRE( ( solution.myContainer - reference.myContainer ).norm() < 1e-8 * reference.myContainer.norm() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -167,6 +167,30 @@ bool testLocalEstimatorFromFunctorAdapter()
   nbok += ((fabs((double)val2 - 398.0)) < 120) ? 1 : 0;
   nb++;
 
+  // Two estimators sharing an index whose neighborhoods are cached.
+  Reporter::NeighborhoodIndex index( surface );
+  index.enableCache( 5.0 );
+  Reporter reporter1, reporter2;
+  reporter1.attach(surface);
+  reporter1.setParams(l2Metric,estimator,convFunc, 5.0);
+  reporter1.setNeighborhoodIndex( index );
+  reporter1.init(1.0, surface.begin(), surface.end());
+  reporter2.attach(surface);
+  reporter2.setParams(l2Metric,estimator,convFunc, 5.0);
+  reporter2.setNeighborhoodIndex( index );
+  reporter2.init(1.0, surface.begin(), surface.end());
+  reporter.setParams(l2Metric,estimator,convFunc, 5.0);
+  reporter.init(1.0, surface.begin(), surface.end());
+  std::vector<Functor::Quantity> vals, vals1, vals2;
+  reporter.eval( surface.begin(), surface.end(), std::back_inserter( vals ) );
+  reporter1.eval( surface.begin(), surface.end(), std::back_inserter( vals1 ) );
+  reporter2.eval( surface.begin(), surface.end(), std::back_inserter( vals2 ) );
+  trace.info() << index << std::endl;
+  nbok += ( vals == vals1 && vals == vals2 && vals.size() == nbsurfels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values with a shared cached index" << std::endl;
+
   trace.endBlock();
   trace.endBlock();
 
@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/tools/SphericalAccumulator.h"
@@ -199,6 +202,122 @@ bool testSphericalMoreIntegerDir()
   return nbok == nb;
 }
 
+bool testSphericalBatchAndMerge()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Spherical Accumulator batch insertion and merge ..." );
+
+  typedef Z3i::RealVector Vector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+  const Size nphi = 17;
+
+  //Reference bin coordinates computed with spherical angles
+  bool binsOk = true;
+  srand( 0 );
+  std::vector<Vector> dirs;
+  for(unsigned int k = 0; k < 10000; k++)
+    {
+      Vector v( rand() / (double)RAND_MAX - 0.5,
+                rand() / (double)RAND_MAX - 0.5,
+                rand() / (double)RAND_MAX - 0.5 );
+      if ( v.norm() == 0.0 )
+        continue;
+      dirs.push_back( v );
+    }
+
+  SphericalAccumulator<Vector> accumulator(nphi);
+  const double dphi = M_PI / (double)(nphi-1);
+  for(std::vector<Vector>::const_iterator it = dirs.begin(), itend = dirs.end();
+      it != itend; ++it)
+    {
+      const double phi = acos( (*it)[2] / it->norm() );
+      const Size refPhi = static_cast<Size>( floor( (phi + dphi/2.0) / dphi ) );
+      Size refTheta = 0;
+      if ( (refPhi != 0) && (refPhi != nphi-1) )
+        {
+          double theta = atan2( (*it)[1], (*it)[0] );
+          if ( theta < 0 ) theta += 2.0*M_PI;
+          const double nthetai = floor( 2.0*nphi*sin( refPhi*dphi ) );
+          const double dtheta = 2.0*M_PI / nthetai;
+          refTheta = static_cast<Size>( floor( (theta + dtheta/2.0) / dtheta ) );
+          if ( refTheta >= nthetai ) refTheta -= static_cast<Size>( nthetai );
+        }
+      Size i,j;
+      accumulator.binCoordinates( *it, i, j );
+      binsOk = binsOk && ( i == refPhi ) && ( j == refTheta );
+    }
+  nbok += binsOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bin coordinates from lookup tables" << std::endl;
+
+  //Bin directions fall in their own bin
+  bool dirOk = true;
+  for(Size i = 0; i < nphi; i++)
+    for(Size j = 0; j < 2*nphi; j++)
+      if ( accumulator.isValidBin( i, j ) )
+        {
+          Size ii,jj;
+          accumulator.binCoordinates( accumulator.getBinDirection( i, j ), ii, jj );
+          dirOk = dirOk && ( i == ii ) && ( j == jj );
+        }
+  nbok += dirOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bin directions" << std::endl;
+
+  //Batch insertion versus single insertions
+  SphericalAccumulator<Vector> single(nphi);
+  for(std::vector<Vector>::const_iterator it = dirs.begin(), itend = dirs.end();
+      it != itend; ++it)
+    single.addDirection( *it );
+  SphericalAccumulator<Vector> batch(nphi);
+  batch.addDirections( dirs.begin(), dirs.end() );
+
+  //Merge of two partial accumulators
+  SphericalAccumulator<Vector> first(nphi);
+  SphericalAccumulator<Vector> second(nphi);
+  const std::size_t half = dirs.size() / 2;
+  first.addDirections( dirs.begin(), dirs.begin() + half );
+  second.addDirections( dirs.begin() + half, dirs.end() );
+  first.merge( second );
+
+  bool batchOk = ( batch.samples() == single.samples() );
+  bool mergeOk = ( first.samples() == single.samples() );
+  for(Size i = 0; i < nphi; i++)
+    for(Size j = 0; j < 2*nphi; j++)
+      if ( single.isValidBin( i, j ) )
+        {
+          batchOk = batchOk && ( batch.count( i, j ) == single.count( i, j ) )
+            && ( ( batch.representativeDirection( i, j )
+                   - single.representativeDirection( i, j ) ).norm() < 1e-8 );
+          mergeOk = mergeOk && ( first.count( i, j ) == single.count( i, j ) )
+            && ( ( first.representativeDirection( i, j )
+                   - single.representativeDirection( i, j ) ).norm() < 1e-8 );
+        }
+  Size mi, mj, bi, bj;
+  single.maxCountBin( mi, mj );
+  batch.maxCountBin( bi, bj );
+  batchOk = batchOk && ( single.count( mi, mj ) == batch.count( bi, bj ) );
+  first.maxCountBin( bi, bj );
+  mergeOk = mergeOk && ( single.count( mi, mj ) == first.count( bi, bj ) );
+
+  nbok += batchOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch insertion" << std::endl;
+  nbok += mergeOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "merge" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -211,7 +330,7 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testSphericalAccumulator() && testSphericalMore()
-    && testSphericalMoreIntegerDir();
+    && testSphericalMoreIntegerDir() && testSphericalBatchAndMerge();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
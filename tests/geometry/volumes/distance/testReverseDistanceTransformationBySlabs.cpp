@@ -0,0 +1,142 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testReverseDistanceTransformationBySlabs.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/18
+ *
+ * Functions for testing class ReverseDistanceTransformationBySlabs,
+ * the blocked PowerMap and the medial axis balls.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/PowerMap.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ReducedMedialAxis.h"
+#include "DGtal/geometry/volumes/distance/ReverseDistanceTransformationBySlabs.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> WeightImage;
+  typedef PowerMap<WeightImage, Z3i::L2PowerMetric> Power;
+  typedef ReverseDistanceTransformation<WeightImage, Z3i::L2PowerMetric> RDT;
+  typedef ReducedMedialAxis<Power> RDMA;
+  typedef ReverseDistanceTransformationBySlabs<Z3i::L2PowerMetric, DGtal::int64_t> SlabRDT;
+
+  /// Sets random balls in the weight image, @return their list.
+  RDMA::BallList randomBalls( WeightImage & weights, unsigned int nb )
+  {
+    const Z3i::Point lower = weights.domain().lowerBound();
+    const Z3i::Point extent = weights.domain().upperBound() - lower + Z3i::Point::diagonal( 1 );
+    RDMA::BallList balls;
+    for ( unsigned int i = 0; i < nb; ++i )
+      {
+        const Z3i::Point c = lower + Z3i::Point( rand() % extent[ 0 ], rand() % extent[ 1 ],
+                                                 rand() % extent[ 2 ] );
+        const DGtal::int64_t w = 1 + rand() % 40;
+        if ( weights( c ) == 0 )
+          {
+            weights.setValue( c, w );
+            balls.push_back( RDMA::Ball( c, w ) );
+          }
+      }
+    return balls;
+  }
+}
+
+TEST_CASE( "Testing ReverseDistanceTransformationBySlabs" )
+{
+  srand( 3 );
+  const Z3i::Domain domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 24, 17, 37 ) );
+  WeightImage weights( domain );
+  const RDMA::BallList inputBalls = randomBalls( weights, 60 );
+  Z3i::L2PowerMetric l2power;
+  const Power power( domain, weights, l2power );
+  const RDT rdt( domain, weights, l2power );
+
+  std::vector<Z3i::Point> shape;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( rdt( *it ) < 0 )
+      shape.push_back( *it );
+  REQUIRE( shape.size() > 100 );
+
+  SECTION( "The blocked power map gives the lowest power distance" )
+    {
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        {
+          DGtal::int64_t best = l2power.powerDistance( *it, inputBalls[ 0 ].first,
+                                                       inputBalls[ 0 ].second );
+          for ( std::size_t i = 1; i < inputBalls.size(); ++i )
+            best = std::min( best, l2power.powerDistance( *it, inputBalls[ i ].first,
+                                                          inputBalls[ i ].second ) );
+          REQUIRE( l2power.powerDistance( *it, power( *it ), weights( power( *it ) ) ) == best );
+        }
+    }
+
+  SECTION( "Medial axis balls" )
+    {
+      const RDMA::BallList balls = RDMA::getReducedMedialAxisBallsFromPowerMap( power );
+      REQUIRE( ! balls.empty() );
+      REQUIRE( balls.size() <= inputBalls.size() );
+      for ( std::size_t i = 0; i < balls.size(); ++i )
+        {
+          REQUIRE( weights( balls[ i ].first ) == balls[ i ].second );
+          if ( i > 0 ) REQUIRE( balls[ i - 1 ].first < balls[ i ].first );
+        }
+      const RDMA::Type rdma = RDMA::getReducedMedialAxisFromPowerMap( power );
+      unsigned int nb = 0;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        if ( rdma( *it ) != 0 ) ++nb;
+      REQUIRE( nb == balls.size() );
+    }
+
+  SECTION( "Reconstruction by slabs" )
+    {
+      const RDMA::BallList balls = RDMA::getReducedMedialAxisBallsFromPowerMap( power );
+      const Z3i::Point::Coordinate thicknesses[] = { 1, 5, 16, 100 };
+      for ( unsigned int t = 0; t < 4; ++t )
+        {
+          const SlabRDT slabRDT( domain, l2power, thicknesses[ t ] );
+          std::vector<Z3i::Point> fromAll;
+          slabRDT.reconstruct( inputBalls.begin(), inputBalls.end(), std::back_inserter( fromAll ) );
+          REQUIRE( fromAll == shape );
+          std::vector<Z3i::Point> fromRDMA;
+          slabRDT.reconstruct( balls.begin(), balls.end(), std::back_inserter( fromRDMA ) );
+          REQUIRE( fromRDMA == shape );
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,283 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBitmapMarkSet.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/08
+ *
+ * Functions for testing classes BitmapMarkSet and BucketQueue, and
+ * their use in the graph visitors.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/graph/BitmapMarkSet.h"
+#include "DGtal/graph/ConcurrentBitmapMarkSet.h"
+#include "DGtal/graph/BucketQueue.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// L1 distance to a fixed point, an integer vertex functor.
+  struct L1Distance
+  {
+    typedef Z2i::Integer Value;
+    L1Distance( const Z2i::Point & c = Z2i::Point() ) : myC( c ) {}
+    Value operator()( const Z2i::Point & p ) const
+    {
+      return ( p - myC ).norm1();
+    }
+    Z2i::Point myC;
+  };
+}
+
+TEST_CASE( "Testing BitmapMarkSet and BucketQueue" )
+{
+  const Z2i::Domain domain( Z2i::Point( -20, -15 ), Z2i::Point( 25, 17 ) );
+  typedef DomainPointIndexer<Z2i::Domain> Indexer;
+  typedef BitmapMarkSet<Indexer> MarkSet;
+
+  SECTION( "Set operations agree with std::set" )
+    {
+      const Indexer indexer( domain );
+      REQUIRE( indexer.size() == domain.size() );
+      for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        REQUIRE( indexer.element( indexer.index( *it ) ) == *it );
+      REQUIRE( ! indexer.isIndexed( Z2i::Point( 26, 0 ) ) );
+
+      MarkSet marks( indexer );
+      std::set<Z2i::Point> ref;
+      srand( 17 );
+      for ( unsigned int i = 0; i < 5000; i++ )
+        {
+          const Z2i::Point p( -20 + rand() % 46, -15 + rand() % 33 );
+          if ( rand() % 3 == 0 )
+            REQUIRE( marks.erase( p ) == ref.erase( p ) );
+          else
+            REQUIRE( marks.insert( p ).second == ref.insert( p ).second );
+          REQUIRE( marks.size() == ref.size() );
+        }
+      REQUIRE( marks.count( Z2i::Point( 100, 100 ) ) == 0 );
+      REQUIRE( marks.find( Z2i::Point( 100, 100 ) ) == marks.end() );
+      std::set<Z2i::Point> content( marks.begin(), marks.end() );
+      REQUIRE( content == ref );
+      for ( std::set<Z2i::Point>::const_iterator it = ref.begin(); it != ref.end(); ++it )
+        REQUIRE( *marks.find( *it ) == *it );
+      marks.clear();
+      REQUIRE( marks.empty() );
+      REQUIRE( marks.begin() == marks.end() );
+    }
+
+  SECTION( "BucketQueue pops nodes by increasing priorities" )
+    {
+      typedef std::pair<Z2i::Point, int> Node;
+      BucketQueue<Node> queue;
+      std::vector<int> priorities;
+      srand( 3 );
+      for ( unsigned int i = 0; i < 2000; i++ )
+        {
+          if ( ! queue.empty() && rand() % 3 == 0 )
+            {
+              priorities.push_back( queue.top().second );
+              queue.pop();
+            }
+          const int d = rand() % 50 - 10;
+          queue.push( Node( Z2i::Point(), d ) );
+          REQUIRE( queue.isValid() );
+        }
+      std::vector<int> last;
+      while ( ! queue.empty() )
+        {
+          last.push_back( queue.top().second );
+          queue.pop();
+        }
+      REQUIRE( ( priorities.size() + last.size() ) == 2000 );
+      for ( unsigned int i = 1; i < last.size(); i++ )
+        REQUIRE( last[ i - 1 ] <= last[ i ] );
+    }
+
+  SECTION( "Visitors with bitmap marks and bucket queue on objects" )
+    {
+      Z2i::DigitalSet shape_set( domain );
+      Shapes<Z2i::Domain>::addNorm2Ball( shape_set, Z2i::Point( -2, -1 ), 9 );
+      Shapes<Z2i::Domain>::addNorm1Ball( shape_set, Z2i::Point( 12, 5 ), 7 );
+      Shapes<Z2i::Domain>::addNorm2Ball( shape_set, Z2i::Point( 21, -10 ), 3 );
+      Z2i::Object4_8 obj( Z2i::dt4_8, shape_set );
+      const Z2i::Point c( -2, -1 );
+
+      // Same traversal as with a std::set.
+      BreadthFirstVisitor< Z2i::Object4_8, std::set<Z2i::Point> > ref( obj, c );
+      BreadthFirstVisitor< Z2i::Object4_8, MarkSet > visitor( obj, c, MarkSet( Indexer( domain ) ) );
+      unsigned int n = 0;
+      while ( ! ref.finished() )
+        {
+          REQUIRE( ! visitor.finished() );
+          REQUIRE( visitor.current() == ref.current() );
+          ref.expand();
+          visitor.expand();
+          ++n;
+        }
+      REQUIRE( visitor.finished() );
+      REQUIRE( visitor.markedVertices().size() == n );
+      REQUIRE( n < shape_set.size() );
+      REQUIRE( obj.computeConnectedness() == DISCONNECTED );
+
+      // Integer distances with buckets.
+      typedef DistanceBreadthFirstVisitor< Z2i::Object4_8, L1Distance,
+                                           std::set<Z2i::Point> > RefDVisitor;
+      typedef DistanceBreadthFirstVisitor< Z2i::Object4_8, L1Distance, MarkSet,
+                                           BucketNodeQueueSelector > DVisitor;
+      RefDVisitor dref( obj, L1Distance( c ), c );
+      DVisitor dvisitor( obj, L1Distance( c ), c, MarkSet( Indexer( domain ) ) );
+      std::set<Z2i::Point> a, b;
+      while ( ! dref.finished() )
+        {
+          REQUIRE( ! dvisitor.finished() );
+          REQUIRE( dvisitor.current().second == L1Distance( c )( dvisitor.current().first ) );
+          a.insert( dref.current().first );
+          b.insert( dvisitor.current().first );
+          dref.expand();
+          dvisitor.expand();
+        }
+      REQUIRE( dvisitor.finished() );
+      REQUIRE( a == b );
+      REQUIRE( dvisitor.markedVertices().size() == n );
+
+      // Layer by layer, in a disk where the distance is consistent
+      // with the adjacency.
+      const Z2i::Point c2( 21, -10 );
+      RefDVisitor lref( obj, L1Distance( c2 ), c2 );
+      DVisitor lvisitor( obj, L1Distance( c2 ), c2, MarkSet( Indexer( domain ) ) );
+      std::vector<RefDVisitor::Node> refLayer;
+      std::vector<DVisitor::Node> layer;
+      Z2i::Integer d = 0;
+      while ( ! lref.finished() )
+        {
+          REQUIRE( ! lvisitor.finished() );
+          lref.getCurrentLayer( refLayer );
+          lvisitor.getCurrentLayer( layer );
+          REQUIRE( layer.size() == refLayer.size() );
+          std::set<Z2i::Point> la, lb;
+          for ( unsigned int i = 0; i < layer.size(); i++ )
+            {
+              REQUIRE( layer[ i ].second == d );
+              la.insert( layer[ i ].first );
+              lb.insert( refLayer[ i ].first );
+            }
+          REQUIRE( la == lb );
+          lref.expandLayer();
+          lvisitor.expandLayer();
+          ++d;
+        }
+      REQUIRE( lvisitor.finished() );
+    }
+
+  SECTION( "Visitor with bitmap marks on a digital surface" )
+    {
+      typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Boundary;
+      typedef DigitalSurface<Boundary> Surface;
+      typedef BitmapMarkSet< KhalimskySCellIndexer<Z3i::KSpace> > SurfelMarkSet;
+      const Z3i::Domain domain3( Z3i::Point( -6, -6, -6 ), Z3i::Point( 6, 6, 6 ) );
+      Z3i::KSpace K;
+      K.init( domain3.lowerBound(), domain3.upperBound(), true );
+      const KhalimskySCellIndexer<Z3i::KSpace> indexer( K );
+      for ( unsigned int i = 0; i < indexer.size(); i += 7 )
+        REQUIRE( indexer.index( indexer.element( i ) ) == i );
+
+      Z3i::DigitalSet ball( domain3 );
+      Shapes<Z3i::Domain>::addNorm2Ball( ball, Z3i::Point( 0, 0, 0 ), 4 );
+      Boundary boundary( K, ball );
+      Surface surface( boundary );
+      const Surface::Vertex s = *surface.begin();
+      BreadthFirstVisitor< Surface > ref( surface, s );
+      BreadthFirstVisitor< Surface, SurfelMarkSet > visitor( surface, s, SurfelMarkSet( indexer ) );
+      while ( ! ref.finished() )
+        {
+          REQUIRE( ! visitor.finished() );
+          REQUIRE( visitor.current() == ref.current() );
+          ref.expand();
+          visitor.expand();
+        }
+      REQUIRE( visitor.finished() );
+      REQUIRE( visitor.markedVertices().size() == surface.size() );
+    }
+
+  SECTION( "Concurrent marks agree with std::set" )
+    {
+      typedef ConcurrentBitmapMarkSet<Indexer> ConcurrentMarkSet;
+      ConcurrentMarkSet marks( ( Indexer( domain ) ) );
+      std::set<Z2i::Point> ref;
+      std::vector<Z2i::Point> points;
+      srand( 19 );
+      for ( unsigned int i = 0; i < 4000; i++ )
+        points.push_back( Z2i::Point( -20 + rand() % 46, -15 + rand() % 33 ) );
+      // Sequential insertions, with growing table.
+      for ( unsigned int i = 0; i < 2000; i++ )
+        {
+          marks.reserve( 1 );
+          REQUIRE( marks.insert( points[ i ] ) == ref.insert( points[ i ] ).second );
+        }
+      REQUIRE( marks.isValid() );
+      // Concurrent insertions: each new point is reported once.
+      marks.reserve( points.size() - 2000 );
+      std::vector<unsigned char> isNew( points.size(), 0 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static,7)
+#endif
+      for ( std::ptrdiff_t i = 2000; i < static_cast<std::ptrdiff_t>( points.size() ); i++ )
+        isNew[ i ] = marks.insert( points[ i ] ) ? 1 : 0;
+      unsigned int nbNew = 0;
+      for ( unsigned int i = 2000; i < points.size(); i++ )
+        nbNew += isNew[ i ];
+      const std::size_t before = ref.size();
+      ref.insert( points.begin() + 2000, points.end() );
+      REQUIRE( nbNew == ref.size() - before );
+      REQUIRE( marks.isValid() );
+      unsigned int nbMarked = 0;
+      for ( Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        {
+          REQUIRE( marks.count( *it ) == ref.count( *it ) );
+          nbMarked += marks.count( *it );
+        }
+      REQUIRE( nbMarked == ref.size() );
+      REQUIRE( marks.count( Z2i::Point( 100, 100 ) ) == 0 );
+      marks.clear();
+      REQUIRE( marks.nbWords() == 0 );
+      REQUIRE( marks.count( points[ 0 ] ) == 0 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
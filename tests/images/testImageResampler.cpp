@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageResampler.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/15
+ *
+ * Functions for testing class ImageResampler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/RigidTransformation2D.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageResampler.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> RealImage3;
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image2;
+
+  template <typename TImage>
+  void fillRandomly( TImage & image, int maxValue )
+  {
+    for ( typename TImage::Domain::ConstIterator it = image.domain().begin(),
+            itE = image.domain().end(); it != itE; ++it )
+      image.setValue( *it, static_cast<typename TImage::Value>( rand() % maxValue ) );
+  }
+
+  /// @return 'true' if a coordinate of p is a half-integer, up to rounding errors.
+  template <typename TRealPoint>
+  bool isNearlyHalfInteger( const TRealPoint & p )
+  {
+    for ( Dimension k = 0; k < TRealPoint::dimension; k++ )
+      if ( std::abs( p[ k ] - std::floor( p[ k ] ) - 0.5 ) < 1e-9 )
+        return true;
+    return false;
+  }
+
+  /// n-linear interpolation computed point by point.
+  double linearValue( const RealImage3 & image, const Z3i::RealPoint & p, double background )
+  {
+    const Z3i::Point c( (int) std::floor( p[ 0 ] ), (int) std::floor( p[ 1 ] ),
+                        (int) std::floor( p[ 2 ] ) );
+    double v = 0.0;
+    for ( int dz = 0; dz < 2; dz++ )
+      for ( int dy = 0; dy < 2; dy++ )
+        for ( int dx = 0; dx < 2; dx++ )
+          {
+            const Z3i::Point q = c + Z3i::Point( dx, dy, dz );
+            const double w = ( dx ? p[ 0 ] - c[ 0 ] : 1.0 - ( p[ 0 ] - c[ 0 ] ) )
+              * ( dy ? p[ 1 ] - c[ 1 ] : 1.0 - ( p[ 1 ] - c[ 1 ] ) )
+              * ( dz ? p[ 2 ] - c[ 2 ] : 1.0 - ( p[ 2 ] - c[ 2 ] ) );
+            v += w * ( image.domain().isInside( q ) ? image( q ) : background );
+          }
+    return v;
+  }
+}
+
+TEST_CASE( "Testing ImageResampler" )
+{
+  srand( 7 );
+
+  SECTION( "Nearest resampling is the backward rigid transformation" )
+    {
+      typedef functors::BackwardRigidTransformation3D<Z3i::Space> BackwardTrans;
+      typedef ImageResampler<Image3> Resampler;
+      const Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 70, 40, 12 ) );
+      Image3 image( domain );
+      fillRandomly( image, 200 );
+      const BackwardTrans backward( Z3i::RealPoint( 5, 5, 5 ), Z3i::RealVector( 1, 0, 1 ),
+                                    M_PI_4, Z3i::RealVector( 3, -3, 3 ) );
+      const Resampler resampler( backward, Resampler::NEAREST, 255 );
+      const Z3i::Domain target( Z3i::Point( -10, -5, -8 ), Z3i::Point( 80, 50, 20 ) );
+      const Image3 result = resampler.resample( image, target );
+      unsigned int nbInside = 0;
+      for ( Z3i::Domain::ConstIterator it = target.begin(), itE = target.end(); it != itE; ++it )
+        {
+          // Rounding may differ on ties.
+          if ( isNearlyHalfInteger( backward.realTransform( *it ) ) ) continue;
+          const Z3i::Point q = backward( *it );
+          if ( domain.isInside( q ) )
+            {
+              REQUIRE( (int) result( *it ) == (int) image( q ) );
+              ++nbInside;
+            }
+          else
+            REQUIRE( (int) result( *it ) == 255 );
+        }
+      REQUIRE( nbInside > 10000 );
+    }
+
+  SECTION( "2D nearest resampling" )
+    {
+      typedef functors::BackwardRigidTransformation2D<Z2i::Space> BackwardTrans;
+      typedef ImageResampler<Image2> Resampler;
+      const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 99, 80 ) );
+      Image2 image( domain );
+      fillRandomly( image, 1000 );
+      const BackwardTrans backward( Z2i::RealPoint( 30, 20 ), 0.3, Z2i::RealVector( -4, 7 ) );
+      const Resampler resampler( backward );
+      const Image2 result = resampler.resample( image, domain );
+      for ( Z2i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        {
+          if ( isNearlyHalfInteger( backward.realTransform( *it ) ) ) continue;
+          const Z2i::Point q = backward( *it );
+          REQUIRE( result( *it ) == ( domain.isInside( q ) ? image( q ) : 0 ) );
+        }
+    }
+
+  SECTION( "Linear resampling" )
+    {
+      typedef ImageResampler<RealImage3> Resampler;
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 17, 9 ) );
+      RealImage3 image( domain );
+      fillRandomly( image, 100 );
+      // The identity.
+      Resampler::Matrix M;
+      for ( Dimension i = 0; i < 3; i++ ) M.setComponent( i, i, 1.0 );
+      const Resampler identity( M, Z3i::RealVector( 0, 0, 0 ), Resampler::LINEAR );
+      const RealImage3 same = identity.resample( image, domain );
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        REQUIRE( same( *it ) == image( *it ) );
+      // Any affine map.
+      M.setComponent( 0, 1, 0.31 ); M.setComponent( 1, 0, -0.27 );
+      M.setComponent( 2, 0, 0.13 ); M.setComponent( 1, 1, 0.9 );
+      const Z3i::RealVector b( 0.4, 1.7, -0.35 );
+      const Resampler affine( M, b, Resampler::LINEAR, -1.0 );
+      const RealImage3 result = affine.resample( image, domain );
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        {
+          const Z3i::RealPoint p = affine.sourcePoint( *it );
+          REQUIRE( std::abs( result( *it ) - linearValue( image, p, -1.0 ) ) < 1e-9 );
+        }
+    }
+
+  SECTION( "Linear resampling of integer values is rounded" )
+    {
+      typedef ImageResampler<Image3> Resampler;
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 0, 0 ) );
+      Image3 image( domain );
+      image.setValue( Z3i::Point( 0, 0, 0 ), 10 );
+      image.setValue( Z3i::Point( 1, 0, 0 ), 13 );
+      image.setValue( Z3i::Point( 2, 0, 0 ), 20 );
+      image.setValue( Z3i::Point( 3, 0, 0 ), 30 );
+      Resampler::Matrix M;
+      for ( Dimension i = 0; i < 3; i++ ) M.setComponent( i, i, 1.0 );
+      const Resampler resampler( M, Z3i::RealVector( 0.5, 0, 0 ), Resampler::LINEAR );
+      const Image3 result = resampler.resample( image, domain );
+      REQUIRE( result( Z3i::Point( 0, 0, 0 ) ) == 12 );
+      REQUIRE( result( Z3i::Point( 1, 0, 0 ) ) == 17 );
+      REQUIRE( result( Z3i::Point( 2, 0, 0 ) ) == 25 );
+      REQUIRE( result( Z3i::Point( 3, 0, 0 ) ) == 15 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
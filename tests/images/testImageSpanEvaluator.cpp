@@ -0,0 +1,156 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageSpanEvaluator.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/16
+ *
+ * Functions for testing class ImageSpanEvaluator and function copyImageBySpans.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageAdapter.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageSpanEvaluator.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> ByteImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> RealImage;
+
+  /// A value functor scaling by 2 and saturating.
+  struct ScaleFunctor
+  {
+    typedef int Argument;
+    typedef unsigned char Value;
+    unsigned char operator()( int v ) const
+    {
+      return static_cast<unsigned char>( std::min( 2 * v, 255 ) );
+    }
+  };
+
+  /// A domain functor shifting points.
+  struct ShiftFunctor
+  {
+    Z3i::Point operator()( const Z3i::Point & p ) const
+    {
+      return p + Z3i::Point( 1, 0, 0 );
+    }
+  };
+
+  template <typename TTarget, typename TImage>
+  void checkSameValues( const TTarget & target, const TImage & image )
+  {
+    for ( typename TTarget::Domain::ConstIterator it = target.domain().begin(),
+            itE = target.domain().end(); it != itE; ++it )
+      REQUIRE( target( *it ) == image( *it ) );
+  }
+}
+
+TEST_CASE( "Testing ImageSpanEvaluator" )
+{
+  srand( 11 );
+  const Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 300, 20, 9 ) );
+  Image image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    image.setValue( *it, rand() % 200 );
+  const functors::Identity id;
+  const ScaleFunctor scale;
+  const functors::Cast<double> toDouble;
+
+  typedef ConstImageAdapter<Image, Z3i::Domain, functors::Identity,
+                            unsigned char, ScaleFunctor> ScaledImage;
+  typedef ConstImageAdapter<ScaledImage, Z3i::Domain, functors::Identity,
+                            double, functors::Cast<double> > RealScaledImage;
+  typedef ConstImageAdapter<Image, Z3i::Domain, ShiftFunctor,
+                            unsigned char, ScaleFunctor> ShiftedImage;
+  typedef ImageAdapter<Image, Z3i::Domain, functors::Identity, int,
+                       functors::Identity, functors::Identity> IdImage;
+
+  SECTION( "Density of evaluators" )
+    {
+      REQUIRE( ImageSpanEvaluator<Image>::isDense );
+      REQUIRE( ImageSpanEvaluator<ScaledImage>::isDense );
+      REQUIRE( ImageSpanEvaluator<RealScaledImage>::isDense );
+      REQUIRE( ImageSpanEvaluator<IdImage>::isDense );
+      REQUIRE( ! ImageSpanEvaluator<ShiftedImage>::isDense );
+    }
+
+  SECTION( "Chains of adapters on a cropped domain" )
+    {
+      const Z3i::Domain cropped( Z3i::Point( 10, 3, 4 ), Z3i::Point( 290, 17, 8 ) );
+      const ScaledImage scaled( image, cropped, id, scale );
+      const RealScaledImage real( scaled, cropped, id, toDouble );
+      ByteImage bytes( cropped );
+      copyImageBySpans( bytes, scaled );
+      checkSameValues( bytes, scaled );
+      RealImage reals( cropped );
+      copyImageBySpans( reals, real );
+      checkSameValues( reals, real );
+      RealImage realsInParallel( cropped );
+      copyImageBySpans( realsInParallel, real, true );
+      checkSameValues( realsInParallel, real );
+      RealImage viaHelper( cropped );
+      imageFromImage( viaHelper, real );
+      checkSameValues( viaHelper, real );
+    }
+
+  SECTION( "Adapter domain beyond the image domain" )
+    {
+      const Z3i::Domain larger( Z3i::Point( -10, -2, 0 ), Z3i::Point( 310, 22, 10 ) );
+      ScaledImage scaled( image, larger, id, scale );
+      scaled.setDefaultValue( 7 );
+      ByteImage bytes( larger );
+      copyImageBySpans( bytes, scaled, true );
+      checkSameValues( bytes, scaled );
+      REQUIRE( bytes( Z3i::Point( -10, -2, 0 ) ) == 7 );
+    }
+
+  SECTION( "Generic evaluation and mutable adapters" )
+    {
+      const Z3i::Domain cropped( Z3i::Point( 0, 0, 2 ), Z3i::Point( 299, 20, 9 ) );
+      const ShiftFunctor shift;
+      const ShiftedImage shifted( image, cropped, shift, scale );
+      ByteImage bytes( cropped );
+      copyImageBySpans( bytes, shifted, true );
+      checkSameValues( bytes, shifted );
+      Image copy( domain );
+      IdImage adapted( image, domain, id, id, id );
+      imageFromImage( copy, adapted );
+      checkSameValues( copy, image );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkPointVector.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/20
+ *
+ * Functions for benchmarking the component-wise kernels of PointVector
+ * (detail::PointVectorKernel) against the generic loops
+ * (detail::PointVectorGenericKernel).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/PointVectorKernel.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// Number of points processed per iteration.
+  const std::size_t NB = 4096;
+
+  template <typename TKernel>
+  std::vector<typename TKernel::Container> randomContainers( std::size_t n )
+  {
+    typedef typename TKernel::Container Container;
+    std::vector<Container> v( n );
+    for ( std::size_t i = 0; i < n; ++i )
+      for ( std::size_t j = 0; j < v[ i ].size(); ++j )
+        v[ i ][ j ] = static_cast<typename TKernel::Component>( rand() % 2000 - 1000 );
+    return v;
+  }
+
+  template <Dimension dim, typename TComponent>
+  struct Kernels
+  {
+    typedef std::array<TComponent, dim> Container;
+    typedef detail::PointVectorGenericKernel<dim, TComponent, Container> Generic;
+    typedef detail::PointVectorKernel<dim, TComponent, Container> Current;
+  };
+}
+
+template <typename TKernel>
+static void BM_plus( benchmark::State& state )
+{
+  std::vector<typename TKernel::Container> a = randomContainers<TKernel>( NB );
+  const std::vector<typename TKernel::Container> b = randomContainers<TKernel>( NB );
+  while ( state.KeepRunning() )
+    {
+      for ( std::size_t i = 0; i < NB; ++i )
+        TKernel::plus( a[ i ], a[ i ], b[ i ] );
+      benchmark::DoNotOptimize( a.data() );
+    }
+}
+
+template <typename TKernel>
+static void BM_inf( benchmark::State& state )
+{
+  std::vector<typename TKernel::Container> a = randomContainers<TKernel>( NB );
+  const std::vector<typename TKernel::Container> b = randomContainers<TKernel>( NB );
+  while ( state.KeepRunning() )
+    {
+      for ( std::size_t i = 0; i < NB; ++i )
+        TKernel::inf( a[ i ], a[ i ], b[ i ] );
+      benchmark::DoNotOptimize( a.data() );
+    }
+}
+
+template <typename TKernel>
+static void BM_isLower( benchmark::State& state )
+{
+  const std::vector<typename TKernel::Container> a = randomContainers<TKernel>( NB );
+  const std::vector<typename TKernel::Container> b = randomContainers<TKernel>( NB );
+  while ( state.KeepRunning() )
+    {
+      std::size_t nb = 0;
+      for ( std::size_t i = 0; i < NB; ++i )
+        nb += TKernel::isLower( a[ i ], b[ i ] ) ? 1 : 0;
+      benchmark::DoNotOptimize( nb );
+    }
+}
+
+template <typename TKernel>
+static void BM_dot( benchmark::State& state )
+{
+  const std::vector<typename TKernel::Container> a = randomContainers<TKernel>( NB );
+  const std::vector<typename TKernel::Container> b = randomContainers<TKernel>( NB );
+  while ( state.KeepRunning() )
+    {
+      typename TKernel::Component d = 0;
+      for ( std::size_t i = 0; i < NB; ++i )
+        d += TKernel::dot( a[ i ], b[ i ] );
+      benchmark::DoNotOptimize( d );
+    }
+}
+
+template <typename TKernel>
+static void BM_squaredNorm( benchmark::State& state )
+{
+  const std::vector<typename TKernel::Container> a = randomContainers<TKernel>( NB );
+  while ( state.KeepRunning() )
+    {
+      double n = 0.0;
+      for ( std::size_t i = 0; i < NB; ++i )
+        n += TKernel::squaredNorm( a[ i ] );
+      benchmark::DoNotOptimize( n );
+    }
+}
+
+#define BENCH_POINTVECTOR_KERNELS( N, T )                                 \
+  BENCHMARK_TEMPLATE( BM_plus, Kernels<N, T>::Generic );                  \
+  BENCHMARK_TEMPLATE( BM_plus, Kernels<N, T>::Current );                  \
+  BENCHMARK_TEMPLATE( BM_inf, Kernels<N, T>::Generic );                   \
+  BENCHMARK_TEMPLATE( BM_inf, Kernels<N, T>::Current );                   \
+  BENCHMARK_TEMPLATE( BM_isLower, Kernels<N, T>::Generic );               \
+  BENCHMARK_TEMPLATE( BM_isLower, Kernels<N, T>::Current );               \
+  BENCHMARK_TEMPLATE( BM_dot, Kernels<N, T>::Generic );                   \
+  BENCHMARK_TEMPLATE( BM_dot, Kernels<N, T>::Current );                   \
+  BENCHMARK_TEMPLATE( BM_squaredNorm, Kernels<N, T>::Generic );           \
+  BENCHMARK_TEMPLATE( BM_squaredNorm, Kernels<N, T>::Current );
+
+BENCH_POINTVECTOR_KERNELS( 2, DGtal::int32_t )
+BENCH_POINTVECTOR_KERNELS( 3, DGtal::int32_t )
+BENCH_POINTVECTOR_KERNELS( 4, DGtal::int32_t )
+BENCH_POINTVECTOR_KERNELS( 2, DGtal::int64_t )
+BENCH_POINTVECTOR_KERNELS( 3, DGtal::int64_t )
+BENCH_POINTVECTOR_KERNELS( 4, DGtal::int64_t )
+BENCH_POINTVECTOR_KERNELS( 2, float )
+BENCH_POINTVECTOR_KERNELS( 3, float )
+BENCH_POINTVECTOR_KERNELS( 4, float )
+BENCH_POINTVECTOR_KERNELS( 2, double )
+BENCH_POINTVECTOR_KERNELS( 3, double )
+BENCH_POINTVECTOR_KERNELS( 4, double )
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char**argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHyperRectDomainScanlineRange.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/21
+ *
+ * Functions for testing the scanline ranges of HyperRectDomain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+namespace
+{
+  /**
+   * Checks that the scanlines of [lower,upper] in @a domain, scanned
+   * by iterators and by indices, are the points of the sub-domain in
+   * lexicographic order, with their linearized indices.
+   */
+  template <typename TDomain>
+  void checkScanlines( const TDomain & domain,
+                       const typename TDomain::Point & lower,
+                       const typename TDomain::Point & upper )
+  {
+    typedef typename TDomain::Point Point;
+    typedef typename TDomain::Size Size;
+    typedef typename TDomain::ConstScanlineRange ScanlineRange;
+    typedef Linearizer<TDomain, ColMajorStorage> Linear;
+
+    const ScanlineRange lines = domain.scanlines( lower, upper );
+    std::vector<Point> points;
+    Size index = 0;
+    for ( typename ScanlineRange::ConstIterator it = lines.begin(), itE = lines.end();
+          it != itE; ++it, ++index )
+      {
+        REQUIRE( it.index() == index );
+        const typename ScanlineRange::Scanline byIndex = lines[ index ];
+        REQUIRE( byIndex.start == it->start );
+        REQUIRE( byIndex.offset == it->offset );
+        REQUIRE( it->length == lines.length() );
+        Point p = it->start;
+        for ( Size i = 0; i < it->length; ++i, ++p[ 0 ] )
+          {
+            REQUIRE( Linear::getIndex( p, domain ) == it->offset + i );
+            points.push_back( p );
+          }
+      }
+    REQUIRE( index == lines.size() );
+    if ( lines.empty() )
+      REQUIRE( points.empty() );
+    else
+      {
+        // The bounds of an empty range do not make a valid domain.
+        const TDomain sub( lines.lowerBound(), lines.upperBound() );
+        REQUIRE( static_cast<Size>( points.size() ) == sub.size() );
+        REQUIRE( std::equal( points.begin(), points.end(), sub.begin() ) );
+      }
+
+    // Partitions cover the range.
+    for ( Size nbParts = 1; nbParts <= 5; ++nbParts )
+      {
+        Size next = 0;
+        for ( Size k = 0; k < nbParts; ++k )
+          {
+            const std::pair<Size, Size> part = lines.part( k, nbParts );
+            REQUIRE( part.first == next );
+            REQUIRE( ( part.second - part.first ) <= ( lines.size() / nbParts + 1 ) );
+            next = part.second;
+          }
+        REQUIRE( next == lines.size() );
+      }
+  }
+}
+
+TEST_CASE( "Testing HyperRectDomain scanline ranges" )
+{
+  SECTION( "1D domain" )
+    {
+      typedef HyperRectDomain< SpaceND<1> > Domain;
+      typedef Domain::Point Point;
+      const Domain domain( Point::diagonal( -3 ), Point::diagonal( 8 ) );
+      REQUIRE( domain.scanlines().size() == 1 );
+      REQUIRE( domain.scanlines().length() == 12 );
+      checkScanlines( domain, Point::diagonal( -3 ), Point::diagonal( 8 ) );
+      checkScanlines( domain, Point::diagonal( 0 ), Point::diagonal( 100 ) );
+    }
+
+  SECTION( "2D domain" )
+    {
+      typedef HyperRectDomain< SpaceND<2> > Domain;
+      typedef Domain::Point Point;
+      const Domain domain( Point( -3, 2 ), Point( 8, 9 ) );
+      REQUIRE( domain.scanlines().size() == 8 );
+      REQUIRE( domain.scanlines().length() == 12 );
+      checkScanlines( domain, domain.lowerBound(), domain.upperBound() );
+      checkScanlines( domain, Point( 0, 4 ), Point( 5, 7 ) );
+      checkScanlines( domain, Point( -10, 4 ), Point( 5, 70 ) );
+    }
+
+  SECTION( "4D domain and sub-domains" )
+    {
+      typedef HyperRectDomain< SpaceND<4> > Domain;
+      typedef Domain::Point Point;
+      const Domain domain( Point( 1, -2, 0, 3 ), Point( 5, 3, 4, 6 ) );
+      REQUIRE( domain.scanlines().size() == 6 * 5 * 4 );
+      checkScanlines( domain, domain.lowerBound(), domain.upperBound() );
+      checkScanlines( domain, Point( 2, -1, 1, 4 ), Point( 4, 2, 2, 5 ) );
+      checkScanlines( domain, Point( 1, 3, 0, 6 ), Point( 5, 3, 4, 6 ) );
+    }
+
+  SECTION( "Empty sub-domains" )
+    {
+      typedef HyperRectDomain< SpaceND<3> > Domain;
+      typedef Domain::Point Point;
+      const Domain domain( Point( 0, 0, 0 ), Point( 9, 9, 9 ) );
+      REQUIRE( domain.scanlines( Point( 2, 5, 2 ), Point( 4, 4, 8 ) ).empty() );
+      REQUIRE( domain.scanlines( Point( 20, 0, 0 ), Point( 30, 9, 9 ) ).empty() );
+      checkScanlines( domain, Point( 2, 5, 2 ), Point( 4, 4, 8 ) );
+    }
+}
+
+TEST_CASE( "Testing HyperRectDomain iterators across rows" )
+{
+  typedef HyperRectDomain< SpaceND<3> > Domain;
+  typedef Domain::Point Point;
+  const Domain domain( Point( -1, 0, 2 ), Point( 2, 2, 4 ) );
+  std::vector<Point> forward( domain.begin(), domain.end() );
+  REQUIRE( forward.size() == domain.size() );
+  std::vector<Point> expected;
+  for ( int z = 2; z <= 4; ++z )
+    for ( int y = 0; y <= 2; ++y )
+      for ( int x = -1; x <= 2; ++x )
+        expected.push_back( Point( x, y, z ) );
+  REQUIRE( forward == expected );
+  std::vector<Point> backward;
+  Domain::ConstIterator it = domain.end();
+  while ( it != domain.begin() )
+    backward.push_back( *--it );
+  REQUIRE( std::equal( backward.rbegin(), backward.rend(), expected.begin() ) );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -112,6 +112,18 @@ bool testImageFromSet()
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
 
+  //filled scanline by scanline, as the generic image
+  typedef ImageContainerBySTLMap<Domain,int> MapImage;
+  MapImage image2b(d);
+  imageFromFunctor(image2b, n);
+  bool sameFill = true;
+  for ( Domain::ConstIterator it = d.begin(); it != d.end(); ++it )
+    sameFill = sameFill && ( image2( *it ) == (int)( *it ).norm1() )
+      && ( image2b( *it ) == image2( *it ) );
+  nbok += sameFill ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
   Image image3 = image;
   //fill image3 from image2
   imageFromImage(image3, const_cast<Image const&>(image2));
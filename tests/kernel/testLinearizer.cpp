@@ -347,3 +347,50 @@ BENCH_LINEARIZER( 2, RowMajorStorage )
 BENCH_LINEARIZER( 3, RowMajorStorage )
 BENCH_LINEARIZER( 4, RowMajorStorage )
 BENCH_LINEARIZER( 5, RowMajorStorage )
+
+TEST_CASE( "Testing Linearizer on domains with more than 2^31 points", "[test][huge]" )
+{
+  typedef SpaceND<3, DGtal::int32_t> Space;
+  typedef HyperRectDomain<Space>  Domain;
+  typedef Space::Point Point;
+  typedef Domain::Size Size;
+
+  REQUIRE( sizeof( Point::Coordinate ) == 4 );
+  REQUIRE( sizeof( Size ) == 8 );
+
+  const Point lowerBound( -5, 3, -1000 );
+  const Point upperBound = lowerBound + Point( 2047, 2047, 1023 );
+  const Domain domain( lowerBound, upperBound );
+  const Point extent = upperBound - lowerBound + Point::diagonal(1);
+  const Size size = Size(2048) * 2048 * 1024;
+
+  SECTION( "Domain size" )
+    {
+      REQUIRE( domain.size() == size );
+      const Domain larger( Point( -100000, -100000, -1 ), Point( 99999, 99999, 0 ) );
+      REQUIRE( larger.size() == Size(200000) * 200000 * 2 );
+    }
+
+  SECTION( "Column-major linearization" )
+    {
+      typedef Linearizer<Domain, ColMajorStorage> Linear;
+      REQUIRE( Linear::getIndex( upperBound, domain ) == size - 1 );
+      REQUIRE( Linear::getIndex( upperBound, lowerBound, extent ) == size - 1 );
+      const Point p = upperBound - Point( 3, 1, 2 );
+      const Size index = 2044 + 2048 * ( Size(2046) + 2048 * Size(1021) );
+      REQUIRE( Linear::getIndex( p, domain ) == index );
+      REQUIRE( Linear::getPoint( index, domain ) == p );
+      REQUIRE( Linear::getPoint( size - 1, domain ) == upperBound );
+      for ( Size i = size - 5000; i < size; ++i )
+        REQUIRE( Linear::getIndex( Linear::getPoint( i, lowerBound, extent ), lowerBound, extent ) == i );
+    }
+
+  SECTION( "Row-major linearization" )
+    {
+      typedef Linearizer<Domain, RowMajorStorage> Linear;
+      REQUIRE( Linear::getIndex( upperBound, domain ) == size - 1 );
+      const Point p = lowerBound + Point( 2047, 0, 1 );
+      REQUIRE( Linear::getIndex( p, domain ) == Size(2047) * 2048 * 1024 + 1 );
+      REQUIRE( Linear::getPoint( Size(2047) * 2048 * 1024 + 1, domain ) == p );
+    }
+}
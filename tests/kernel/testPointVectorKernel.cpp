@@ -0,0 +1,180 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPointVectorKernel.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/20
+ *
+ * Functions for testing the component-wise kernels of PointVector.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/PointVectorKernel.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+namespace
+{
+  /// @return true if a and b are the same value (NaN being the same as NaN).
+  template <typename T>
+  bool same( T a, T b )
+  {
+    return a == b || ( a != a && b != b );
+  }
+
+  template <typename TContainer>
+  bool sameContainers( const TContainer & a, const TContainer & b )
+  {
+    for ( std::size_t i = 0; i < a.size(); ++i )
+      if ( ! same( a[ i ], b[ i ] ) ) return false;
+    return true;
+  }
+
+  /// Small random values, with many ties, and NaN for floating-point types.
+  template <typename T>
+  T randomValue()
+  {
+    if ( std::numeric_limits<T>::has_quiet_NaN && rand() % 16 == 0 )
+      return std::numeric_limits<T>::quiet_NaN();
+    return static_cast<T>( rand() % 7 - 3 ) / static_cast<T>( rand() % 2 + 1 );
+  }
+
+  template <Dimension dim, typename T>
+  void checkKernel()
+  {
+    typedef std::array<T, dim> Container;
+    typedef detail::PointVectorGenericKernel<dim, T, Container> Generic;
+    typedef detail::PointVectorKernel<dim, T, Container> Kernel;
+    typedef PointVector<dim, T> Point;
+    for ( unsigned int n = 0; n < 2000; ++n )
+      {
+        Container a, b, r1, r2;
+        for ( Dimension i = 0; i < dim; ++i )
+          {
+            a[ i ] = randomValue<T>();
+            b[ i ] = rand() % 4 == 0 ? a[ i ] : randomValue<T>();
+          }
+        Generic::plus( r1, a, b ); Kernel::plus( r2, a, b );
+        REQUIRE( sameContainers( r1, r2 ) );
+        Generic::minus( r1, a, b ); Kernel::minus( r2, a, b );
+        REQUIRE( sameContainers( r1, r2 ) );
+        Generic::inf( r1, a, b ); Kernel::inf( r2, a, b );
+        REQUIRE( sameContainers( r1, r2 ) );
+        Generic::sup( r1, a, b ); Kernel::sup( r2, a, b );
+        REQUIRE( sameContainers( r1, r2 ) );
+        REQUIRE( Generic::isLower( a, b ) == Kernel::isLower( a, b ) );
+        REQUIRE( Generic::isUpper( a, b ) == Kernel::isUpper( a, b ) );
+        REQUIRE( same( Generic::dot( a, b ), Kernel::dot( a, b ) ) );
+        REQUIRE( same( Generic::squaredNorm( a ), Kernel::squaredNorm( a ) ) );
+
+        // Kernels only write the components of the container.
+        std::array<Container, 2> guarded;
+        guarded[ 1 ] = b;
+        Kernel::sup( guarded[ 0 ], a, b );
+        REQUIRE( sameContainers( guarded[ 0 ], r2 ) );
+        REQUIRE( sameContainers( guarded[ 1 ], b ) );
+
+        // PointVector uses the kernel.
+        Point p, q;
+        for ( Dimension i = 0; i < dim; ++i )
+          {
+            p[ i ] = a[ i ];
+            q[ i ] = b[ i ];
+          }
+        Generic::inf( r1, a, b );
+        const Point pq = p.inf( q );
+        for ( Dimension i = 0; i < dim; ++i )
+          REQUIRE( same( pq[ i ], r1[ i ] ) );
+        REQUIRE( p.isLower( q ) == Generic::isLower( a, b ) );
+        REQUIRE( same( p.dot( q ), Generic::dot( a, b ) ) );
+        REQUIRE( same( p.norm(), std::sqrt( Generic::squaredNorm( a ) ) ) );
+      }
+  }
+}
+
+TEST_CASE( "Testing PointVectorKernel against the generic loops" )
+{
+  srand( 5 );
+  SECTION( "int32" )
+    {
+      checkKernel<2, DGtal::int32_t>();
+      checkKernel<3, DGtal::int32_t>();
+      checkKernel<4, DGtal::int32_t>();
+      checkKernel<5, DGtal::int32_t>();
+      checkKernel<6, DGtal::int32_t>();
+      checkKernel<7, DGtal::int32_t>();
+    }
+  SECTION( "int64" )
+    {
+      checkKernel<2, DGtal::int64_t>();
+      checkKernel<3, DGtal::int64_t>();
+      checkKernel<4, DGtal::int64_t>();
+    }
+  SECTION( "float" )
+    {
+      checkKernel<2, float>();
+      checkKernel<3, float>();
+      checkKernel<4, float>();
+      checkKernel<6, float>();
+      checkKernel<7, float>();
+    }
+  SECTION( "double" )
+    {
+      checkKernel<2, double>();
+      checkKernel<3, double>();
+      checkKernel<4, double>();
+      checkKernel<5, double>();
+    }
+}
+
+TEST_CASE( "Testing PointVector arithmetic on the kernel containers" )
+{
+  typedef PointVector<3, DGtal::int32_t> Point3;
+  typedef PointVector<4, double> RealPoint4;
+  const Point3 a( 1, -2, 3 ), b( -4, 5, 6 );
+  REQUIRE( ( a + b ) == Point3( -3, 3, 9 ) );
+  REQUIRE( ( a - b ) == Point3( 5, -7, -3 ) );
+  REQUIRE( a.inf( b ) == Point3( -4, -2, 3 ) );
+  REQUIRE( a.sup( b ) == Point3( 1, 5, 6 ) );
+  REQUIRE( a.dot( b ) == ( -4 - 10 + 18 ) );
+  REQUIRE( a.inf( b ).isLower( a ) );
+  REQUIRE( a.sup( b ).isUpper( b ) );
+  REQUIRE( ! a.isLower( b ) );
+  Point3 c = a;
+  c += b; c -= a;
+  REQUIRE( c == b );
+
+  const RealPoint4 p( 1.5, -2.0, 0.25, 4.0 ), q( 0.5, 1.0, -1.0, 2.0 );
+  REQUIRE( ( p + q ) == RealPoint4( 2.0, -1.0, -0.75, 6.0 ) );
+  REQUIRE( p.dot( q ) == ( 0.75 - 2.0 - 0.25 + 8.0 ) );
+  REQUIRE( std::abs( p.norm() - std::sqrt( 2.25 + 4.0 + 0.0625 + 16.0 ) ) < 1e-12 );
+  REQUIRE( p.inf( q ) == RealPoint4( 0.5, -2.0, -1.0, 2.0 ) );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,227 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testClosedFormEigenDecomposition.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/10
+ *
+ * Functions for testing class ClosedFormEigenDecomposition.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/ClosedFormEigenDecomposition.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  double randomCoefficient()
+  {
+    return ( rand() / (double) RAND_MAX ) * 2.0 - 1.0;
+  }
+
+  /// Checks that V is orthonormal, V diag(d) V^t = A, that d is
+  /// ascending and equal to the eigenvalues of the reference solver.
+  template <typename TSolver>
+  void checkDecomposition( const typename TSolver::Matrix & A )
+  {
+    typedef typename TSolver::Matrix Matrix;
+    typedef typename TSolver::Vector Vector;
+    typedef EigenDecomposition<TSolver::dimension, double> Reference;
+    const Dimension N = TSolver::dimension;
+    Matrix V, Vref;
+    Vector d, dref;
+    TSolver::getEigenDecomposition( A, V, d );
+    Reference::getEigenDecomposition( A, Vref, dref );
+    double scale = 1.0;
+    for ( Dimension i = 0; i < N; i++ )
+      for ( Dimension j = 0; j < N; j++ )
+        scale = std::max( scale, std::abs( A( i, j ) ) );
+    const double eps = 1e-9 * scale;
+    for ( Dimension j = 0; j < N; j++ )
+      {
+        REQUIRE( std::abs( d[ j ] - dref[ j ] ) < eps );
+        if ( j > 0 ) REQUIRE( d[ j - 1 ] <= d[ j ] );
+      }
+    for ( Dimension i = 0; i < N; i++ )
+      for ( Dimension j = 0; j < N; j++ )
+        {
+          double vtv = 0.0, a = 0.0;
+          for ( Dimension k = 0; k < N; k++ )
+            {
+              vtv += V( k, i ) * V( k, j );
+              a   += V( i, k ) * d[ k ] * V( j, k );
+            }
+          REQUIRE( std::abs( vtv - ( i == j ? 1.0 : 0.0 ) ) < 1e-9 );
+          REQUIRE( std::abs( a - A( i, j ) ) < eps );
+        }
+  }
+}
+
+TEST_CASE( "Testing ClosedFormEigenDecomposition" )
+{
+  typedef ClosedFormEigenDecomposition<2,double> Solver2;
+  typedef ClosedFormEigenDecomposition<3,double> Solver3;
+  typedef Solver2::Matrix Matrix2;
+  typedef Solver3::Matrix Matrix3;
+  srand( 11 );
+
+  SECTION( "2x2 matrices" )
+    {
+      Matrix2 A;
+      A.setComponent( 0, 0, 4 ); A.setComponent( 0, 1, 1 );
+      A.setComponent( 1, 0, 1 ); A.setComponent( 1, 1, 2 );
+      Matrix2 V;
+      Solver2::Vector d;
+      Solver2::getEigenDecomposition( A, V, d );
+      REQUIRE( std::abs( d[ 0 ] - 1.585786437626905 ) < 1e-12 );
+      REQUIRE( std::abs( d[ 1 ] - 4.414213562373095 ) < 1e-12 );
+      checkDecomposition<Solver2>( A );
+      for ( unsigned int n = 0; n < 1000; n++ )
+        {
+          const double b = randomCoefficient();
+          A.setComponent( 0, 0, randomCoefficient() );
+          A.setComponent( 1, 1, randomCoefficient() );
+          A.setComponent( 0, 1, b ); A.setComponent( 1, 0, b );
+          checkDecomposition<Solver2>( A );
+        }
+      A = Matrix2(); A.setComponent( 0, 0, 3 ); A.setComponent( 1, 1, 3 );
+      checkDecomposition<Solver2>( A );
+      A = Matrix2(); A.setComponent( 0, 0, 3 ); A.setComponent( 1, 1, -2 );
+      checkDecomposition<Solver2>( A );
+      checkDecomposition<Solver2>( Matrix2() );
+    }
+
+  SECTION( "3x3 random matrices" )
+    {
+      Matrix3 A;
+      for ( unsigned int n = 0; n < 2000; n++ )
+        {
+          for ( Dimension i = 0; i < 3; i++ )
+            for ( Dimension j = i; j < 3; j++ )
+              {
+                const double c = ( n % 2 == 0 ? 1000.0 : 1.0 ) * randomCoefficient();
+                A.setComponent( i, j, c );
+                A.setComponent( j, i, c );
+              }
+          checkDecomposition<Solver3>( A );
+        }
+    }
+
+  SECTION( "3x3 degenerate matrices" )
+    {
+      // Null, scalar and diagonal matrices.
+      checkDecomposition<Solver3>( Matrix3() );
+      Matrix3 A;
+      A.setComponent( 0, 0, 2 ); A.setComponent( 1, 1, 2 ); A.setComponent( 2, 2, 2 );
+      checkDecomposition<Solver3>( A );
+      A.setComponent( 0, 0, 5 ); A.setComponent( 1, 1, -1 ); A.setComponent( 2, 2, 3 );
+      checkDecomposition<Solver3>( A );
+      // Covariance matrices of rank 1 and 2, double eigenvalues.
+      const double u[ 3 ] = { 0.36, 0.48, 0.8 };
+      const double v[ 3 ] = { 0.8, -0.6, 0.0 };
+      for ( unsigned int k = 0; k < 4; k++ )
+        {
+          const double s = k == 0 ? 0.0 : ( k == 1 ? 1.0 : ( k == 2 ? 3.0 : -3.0 ) );
+          for ( Dimension i = 0; i < 3; i++ )
+            for ( Dimension j = 0; j < 3; j++ )
+              A.setComponent( i, j, 3.0 * u[ i ] * u[ j ] + s * v[ i ] * v[ j ] );
+          checkDecomposition<Solver3>( A );
+          for ( Dimension i = 0; i < 3; i++ )
+            A.setComponent( i, i, A( i, i ) + 2.0 );
+          checkDecomposition<Solver3>( A );
+        }
+    }
+
+  SECTION( "Batched 3x3 decomposition" )
+    {
+      const std::size_t n = 1000;
+      std::vector< std::vector<double> > coefs( 6, std::vector<double>( n ) );
+      std::vector< std::vector<double> > values( 3, std::vector<double>( n ) );
+      std::vector< std::vector<double> > vectors( 9, std::vector<double>( n ) );
+      for ( std::size_t k = 0; k < n; k++ )
+        for ( unsigned int c = 0; c < 6; c++ )
+          coefs[ c ][ k ] = randomCoefficient();
+      const double * coefPtrs[ 6 ];
+      double * valuePtrs[ 3 ];
+      double * vectorPtrs[ 9 ];
+      for ( unsigned int c = 0; c < 6; c++ ) coefPtrs[ c ] = &coefs[ c ][ 0 ];
+      for ( unsigned int c = 0; c < 3; c++ ) valuePtrs[ c ] = &values[ c ][ 0 ];
+      for ( unsigned int c = 0; c < 9; c++ ) vectorPtrs[ c ] = &vectors[ c ][ 0 ];
+      Solver3::getEigenDecompositions( n, coefPtrs, valuePtrs, vectorPtrs );
+      for ( std::size_t k = 0; k < n; k++ )
+        {
+          Matrix3 A, V;
+          Solver3::Vector d;
+          unsigned int c = 0;
+          for ( Dimension i = 0; i < 3; i++ )
+            for ( Dimension j = i; j < 3; j++, c++ )
+              {
+                A.setComponent( i, j, coefs[ c ][ k ] );
+                A.setComponent( j, i, coefs[ c ][ k ] );
+              }
+          Solver3::getEigenDecomposition( A, V, d );
+          for ( Dimension j = 0; j < 3; j++ )
+            {
+              REQUIRE( values[ j ][ k ] == d[ j ] );
+              for ( Dimension i = 0; i < 3; i++ )
+                REQUIRE( vectors[ 3 * j + i ][ k ] == V( i, j ) );
+            }
+        }
+    }
+
+  SECTION( "Integral invariant functors with the closed-form solver" )
+    {
+      typedef functors::IIPrincipalCurvatures3DFunctor<Z3i::Space> RefFunctor;
+      typedef functors::IIPrincipalCurvatures3DFunctor<Z3i::Space, Matrix3, Solver3> Functor;
+      typedef functors::IINormalDirectionFunctor<Z3i::Space, Matrix3, Solver3> NormalFunctor;
+      RefFunctor refFct;
+      Functor fct;
+      NormalFunctor normalFct;
+      refFct.init( 0.5, 5.0 );
+      fct.init( 0.5, 5.0 );
+      // Covariance matrix of a ball of radius 5 cut by the plane z=0.
+      Matrix3 A;
+      A.setComponent( 0, 0, 1000.0 ); A.setComponent( 1, 1, 1100.0 );
+      A.setComponent( 2, 2, 120.0 );
+      A.setComponent( 0, 1, 30.0 ); A.setComponent( 1, 0, 30.0 );
+      const RefFunctor::Value ref = refFct( A );
+      const Functor::Value val = fct( A );
+      REQUIRE( std::abs( ref.first - val.first ) < 1e-9 );
+      REQUIRE( std::abs( ref.second - val.second ) < 1e-9 );
+      const Z3i::RealVector n = normalFct( A );
+      REQUIRE( std::abs( std::abs( n[ 2 ] ) - 1.0 ) < 1e-12 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
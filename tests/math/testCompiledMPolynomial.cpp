@@ -0,0 +1,163 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompiledMPolynomial.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/14
+ *
+ * Functions for testing class CompiledMPolynomial.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  typedef MPolynomial<3, double> Polynomial3;
+  typedef CompiledMPolynomial<3, double> Compiled3;
+
+  /// @return the value of P at x, computed by MPolynomial.
+  double evaluate( const Polynomial3 & P, const Z3i::RealPoint & x )
+  {
+    return P( x[ 0 ] )( x[ 1 ] )( x[ 2 ] );
+  }
+
+  Polynomial3 read( const std::string & s )
+  {
+    Polynomial3 P;
+    MPolynomialReader<3, double> reader;
+    const std::string::const_iterator it = reader.read( P, s.begin(), s.end() );
+    REQUIRE( it == s.end() );
+    return P;
+  }
+}
+
+TEST_CASE( "Testing CompiledMPolynomial" )
+{
+  const std::string shapes[ 4 ] =
+    { "x^2+y^2+z^2-100",
+      "81*x^3 - 189*x^2*y - 189*x^2*z + 63*x*y*z - 0.5*z^4 + 7*y - 3",
+      "(x^2+y^2+z^2+3.2)^2-16*(x^2+y^2)",
+      "x*y*z" };
+
+  SECTION( "Degrees and evaluation" )
+    {
+      const Compiled3 zero;
+      REQUIRE( zero.isValid() );
+      REQUIRE( zero.size() == 0 );
+      REQUIRE( zero.degree( 0 ) == -1 );
+      REQUIRE( zero( Z3i::RealPoint( 1.0, 2.0, 3.0 ) ) == 0.0 );
+      const Compiled3 C( read( shapes[ 1 ] ) );
+      REQUIRE( C.isValid() );
+      REQUIRE( C.degree( 0 ) == 3 );
+      REQUIRE( C.degree( 1 ) == 1 );
+      REQUIRE( C.degree( 2 ) == 4 );
+      for ( unsigned int s = 0; s < 4; s++ )
+        {
+          const Polynomial3 P = read( shapes[ s ] );
+          const Compiled3 CP( P );
+          for ( double x = -3.0; x <= 3.0; x += 0.7 )
+            for ( double y = -2.5; y <= 2.5; y += 0.9 )
+              for ( double z = -3.0; z <= 3.0; z += 0.55 )
+                {
+                  const Z3i::RealPoint p( x, y, z );
+                  const double ref = evaluate( P, p );
+                  REQUIRE( std::abs( CP( p ) - ref ) <= 1e-12 * ( 1.0 + std::abs( ref ) ) );
+                  // Integer points are evaluated exactly with integer coefficients.
+                  const Z3i::RealPoint q( std::floor( x ), std::floor( y ), std::floor( z ) );
+                  if ( s == 0 || s == 3 ) REQUIRE( CP( q ) == evaluate( P, q ) );
+                }
+        }
+    }
+
+  SECTION( "Restrictions and line evaluations" )
+    {
+      for ( unsigned int s = 0; s < 4; s++ )
+        {
+          const Polynomial3 P = read( shapes[ s ] );
+          const Compiled3 CP( P );
+          for ( Dimension axis = 0; axis < 3; axis++ )
+            {
+              const Z3i::RealPoint origin( -2.5, 1.25, -0.75 );
+              std::vector<double> a;
+              CP.restriction( origin, axis, a );
+              REQUIRE( a.size() == static_cast<std::size_t>( CP.degree( axis ) + 1 ) );
+              const std::size_t count[ 3 ] = { 1, 5, 200 };
+              for ( unsigned int c = 0; c < 3; c++ )
+                {
+                  const double step = 5.0 / count[ c ];
+                  std::vector<double> values( count[ c ] );
+                  CP.evaluateLine( origin, axis, step, count[ c ], &values[ 0 ] );
+                  for ( std::size_t i = 0; i < count[ c ]; i++ )
+                    {
+                      Z3i::RealPoint p = origin;
+                      p[ axis ] += i * step;
+                      const double ref = evaluate( P, p );
+                      double r = 0.0, xx = 1.0;
+                      for ( std::size_t k = 0; k < a.size(); k++, xx *= p[ axis ] )
+                        r += a[ k ] * xx;
+                      REQUIRE( std::abs( r - ref ) <= 1e-10 * ( 1.0 + std::abs( ref ) ) );
+                      REQUIRE( std::abs( values[ i ] - ref ) <= 1e-9 * ( 1.0 + std::abs( ref ) ) );
+                    }
+                }
+            }
+        }
+    }
+
+  SECTION( "Implicit polynomial shapes use compiled polynomials" )
+    {
+      typedef ImplicitPolynomial3Shape<Z3i::Space> Shape;
+      const Polynomial3 P = read( shapes[ 2 ] );
+      const Shape shape( P );
+      const Polynomial3 Fx = derivative<0>( P ), Fy = derivative<1>( P ), Fz = derivative<2>( P );
+      std::vector<double> values( 64 );
+      shape.evaluateLine( Z3i::RealPoint( -3.0, 0.5, 0.25 ), 0, 0.1, values.size(), &values[ 0 ] );
+      for ( std::size_t i = 0; i < values.size(); i++ )
+        {
+          const Z3i::RealPoint p( -3.0 + i * 0.1, 0.5, 0.25 );
+          const double ref = evaluate( P, p );
+          REQUIRE( std::abs( shape( p ) - ref ) <= 1e-12 * ( 1.0 + std::abs( ref ) ) );
+          REQUIRE( std::abs( values[ i ] - ref ) <= 1e-9 * ( 1.0 + std::abs( ref ) ) );
+          const Z3i::RealVector g = shape.gradient( p );
+          REQUIRE( std::abs( g[ 0 ] - evaluate( Fx, p ) ) <= 1e-10 );
+          REQUIRE( std::abs( g[ 1 ] - evaluate( Fy, p ) ) <= 1e-10 );
+          REQUIRE( std::abs( g[ 2 ] - evaluate( Fz, p ) ) <= 1e-10 );
+        }
+      REQUIRE( shape.getCompiledPolynomial().degree( 0 ) == 4 );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBoundaryMesher.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/04
+ *
+ * Functions for testing class BoundaryMesher.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <map>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/CompactMesh.h"
+#include "DGtal/shapes/BoundaryMesher.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef BoundaryMesher<Space> Mesher;
+typedef Mesh<RealPoint> RealMesh;
+
+namespace
+{
+  /// Two cubes touching along an edge (non-manifold for the primal mesh).
+  struct Cubes
+  {
+    bool operator()( const Point & p ) const
+    {
+      return ( p[2] >= -3 && p[2] <= 0 )
+        && ( ( p[0] >= -3 && p[0] <= 0 && p[1] >= -3 && p[1] <= 0 )
+             || ( p[0] >= 1 && p[0] <= 4 && p[1] >= 1 && p[1] <= 4 ) );
+    }
+  };
+
+  struct All
+  {
+    bool operator()( const Point & ) const
+    {
+      return true;
+    }
+  };
+
+  struct Ball
+  {
+    bool operator()( const Point & p ) const
+    {
+      return p.dot( p ) <= 25;
+    }
+  };
+
+  /// Checks that each edge is shared by exactly two faces with
+  /// opposite orientations and returns the Euler characteristic.
+  template <typename TMesh>
+  int closedEuler( const TMesh & aMesh, bool & closed )
+  {
+    std::map< std::pair<unsigned int, unsigned int>, int > edges;
+    for ( unsigned int f = 0; f < aMesh.nbFaces(); f++ )
+      {
+        const typename TMesh::MeshFace & face = aMesh.getFace( f );
+        for ( unsigned int i = 0; i < face.size(); i++ )
+          edges[ std::make_pair( face[ i ], face[ ( i + 1 ) % face.size() ] ) ] += 1;
+      }
+    closed = true;
+    for ( std::map< std::pair<unsigned int, unsigned int>, int >::const_iterator
+            it = edges.begin(); it != edges.end(); ++it )
+      closed = closed && it->second == 1
+        && edges.count( std::make_pair( it->first.second, it->first.first ) ) == 1;
+    return (int) aMesh.nbVertex() - (int) edges.size() / 2 + (int) aMesh.nbFaces();
+  }
+
+  template <typename TMesh>
+  std::vector<RealPoint> sortedVertices( const TMesh & aMesh )
+  {
+    std::vector<RealPoint> v( aMesh.vertexBegin(), aMesh.vertexEnd() );
+    std::sort( v.begin(), v.end() );
+    return v;
+  }
+
+  /// Flux of the position through the faces (six times the enclosed
+  /// volume): positive when faces point outward.
+  double outwardness( const RealMesh & aMesh )
+  {
+    double s = 0.0;
+    for ( unsigned int f = 0; f < aMesh.nbFaces(); f++ )
+      {
+        const RealMesh::MeshFace & face = aMesh.getFace( f );
+        const RealPoint & a = aMesh.getVertex( face[ 0 ] );
+        const RealPoint n = ( aMesh.getVertex( face[ 1 ] ) - a )
+          .crossProduct( aMesh.getVertex( face[ 2 ] ) - a );
+        s += n.dot( aMesh.getFaceBarycenter( f ) );
+      }
+    return s;
+  }
+}
+
+TEST_CASE( "Testing BoundaryMesher" )
+{
+  const Domain domain( Point( -6, -6, -6 ), Point( 6, 6, 6 ) );
+  const Ball ball;
+
+  SECTION( "Primal quads of a ball" )
+    {
+      Mesher mesher( domain, Mesher::PRIMAL_QUADS, true, 3 );
+      REQUIRE( mesher.isValid() );
+      REQUIRE( mesher.nbSlabs() == 5 );
+      RealMesh mesh;
+      mesher.makeMesh( mesh, ball );
+      bool closed;
+      REQUIRE( closedEuler( mesh, closed ) == 2 );
+      REQUIRE( closed );
+      REQUIRE( outwardness( mesh ) > 0.0 );
+      for ( unsigned int i = 0; i < mesh.nbVertex(); i++ )
+        REQUIRE( ( mesh.getVertex( i )[ 0 ] - std::floor( mesh.getVertex( i )[ 0 ] ) ) == 0.5 );
+
+      std::set<Cell> surfels;
+      KSpace K;
+      K.init( domain.lowerBound(), domain.upperBound(), true );
+      Surfaces<KSpace>::uMakeBoundary( surfels, K, ball,
+                                       domain.lowerBound(), domain.upperBound() );
+      REQUIRE( mesh.nbFaces() == surfels.size() );
+    }
+
+  SECTION( "Result does not depend on the slab thickness" )
+    {
+      RealMesh ref;
+      Mesher( domain, Mesher::PRIMAL_TRIANGLES, true, 13 ).makeMesh( ref, ball );
+      for ( Integer t = 1; t < 6; t++ )
+        {
+          RealMesh mesh;
+          Mesher( domain, Mesher::PRIMAL_TRIANGLES, true, t ).makeMesh( mesh, ball );
+          REQUIRE( mesh.nbFaces() == ref.nbFaces() );
+          REQUIRE( sortedVertices( mesh ) == sortedVertices( ref ) );
+          bool closed;
+          REQUIRE( closedEuler( mesh, closed ) == 2 );
+          REQUIRE( closed );
+        }
+    }
+
+  SECTION( "Objects touching the domain border are closed" )
+    {
+      const Domain small( Point( 0, 0, 0 ), Point( 3, 4, 5 ) );
+      CompactMesh<RealPoint> box;
+      Mesher( small, Mesher::PRIMAL_QUADS, true, 2 ).makeMesh( box, All() );
+      REQUIRE( box.nbFaces() == 2 * ( 4*5 + 4*6 + 5*6 ) );
+      REQUIRE( box.nbVertex() == 5*6*7 - 3*4*5 );
+    }
+
+  SECTION( "Dual triangles" )
+    {
+      const Cubes cubes;
+      RealMesh quads;
+      Mesher( domain, Mesher::PRIMAL_QUADS ).makeMesh( quads, cubes );
+      for ( unsigned int adj = 0; adj < 2; adj++ )
+        {
+          RealMesh ref;
+          Mesher( domain, Mesher::DUAL_TRIANGLES, adj == 0, 20 ).makeMesh( ref, cubes );
+          REQUIRE( ref.nbVertex() == quads.nbFaces() );
+          bool closed;
+          const int euler = closedEuler( ref, closed );
+          REQUIRE( closed );
+          // The cubes are separated by the interior adjacency.
+          REQUIRE( euler == ( adj == 0 ? 4 : 2 ) );
+          REQUIRE( outwardness( ref ) > 0.0 );
+          for ( Integer t = 1; t < 5; t++ )
+            {
+              RealMesh mesh;
+              Mesher( domain, Mesher::DUAL_TRIANGLES, adj == 0, t ).makeMesh( mesh, cubes );
+              REQUIRE( mesh.nbFaces() == ref.nbFaces() );
+              REQUIRE( sortedVertices( mesh ) == sortedVertices( ref ) );
+            }
+        }
+    }
+
+  SECTION( "Iso-surface of an image" )
+    {
+      typedef ImageContainerBySTLVector<Domain, double> Image;
+      Image image( domain );
+      for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        image.setValue( *it, 5.5 - ( *it ).norm() );
+      RealMesh mesh;
+      Mesher( domain, Mesher::DUAL_TRIANGLES ).makeMesh( mesh, image, 0.0 );
+      bool closed;
+      REQUIRE( closedEuler( mesh, closed ) == 2 );
+      REQUIRE( closed );
+      for ( unsigned int i = 0; i < mesh.nbVertex(); i++ )
+        REQUIRE( std::abs( mesh.getVertex( i ).norm() - 5.5 ) < 0.1 );
+    }
+
+  SECTION( "Digital surface input" )
+    {
+      KSpace K;
+      K.init( domain.lowerBound(), domain.upperBound(), true );
+      typedef SetOfSurfels< KSpace, std::set<SCell> > Container;
+      Container container( K, SurfelAdjacency<3>( true ) );
+      Surfaces<KSpace>::sMakeBoundary( container.surfelSet(), K, ball,
+                                       domain.lowerBound(), domain.upperBound() );
+      DigitalSurface<Container> surface( container );
+      Mesher mesher( domain, Mesher::PRIMAL_QUADS, true, 4 );
+      RealMesh mesh, ref;
+      mesher.makeSurfaceMesh( mesh, surface );
+      mesher.makeMesh( ref, ball );
+      REQUIRE( mesh.nbFaces() == ref.nbFaces() );
+      REQUIRE( sortedVertices( mesh ) == sortedVertices( ref ) );
+      bool closed;
+      REQUIRE( closedEuler( mesh, closed ) == 2 );
+      REQUIRE( closed );
+      REQUIRE( outwardness( mesh ) > 0.0 );
+      RealMesh dual;
+      REQUIRE_THROWS_AS( Mesher( domain, Mesher::DUAL_TRIANGLES ).makeSurfaceMesh( dual, surface ),
+                         const InputException& );
+    }
+
+  SECTION( "Streaming OFF export" )
+    {
+      for ( unsigned int kind = 0; kind < 3; kind++ )
+        {
+          Mesher mesher( domain, Mesher::MeshKind( kind ), true, 2 );
+          mesher.setSlabsPerChunk( 2 );
+          RealMesh ref;
+          mesher.makeMesh( ref, ball );
+          REQUIRE( mesher.exportOFF( "testBoundaryMesher.off", ball ) );
+          RealMesh mesh;
+          REQUIRE( MeshReader<RealPoint>::importOFFFile( "testBoundaryMesher.off", mesh ) );
+          REQUIRE( mesh.nbVertex() == ref.nbVertex() );
+          REQUIRE( mesh.nbFaces() == ref.nbFaces() );
+          for ( unsigned int i = 0; i < mesh.nbVertex(); i++ )
+            REQUIRE( ( mesh.getVertex( i ) - ref.getVertex( i ) ).norm() < 1e-4 );
+          for ( unsigned int f = 0; f < mesh.nbFaces(); f++ )
+            REQUIRE( mesh.getFace( f ) == ref.getFace( f ) );
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
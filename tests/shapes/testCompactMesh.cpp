@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompactMesh.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/02
+ *
+ * Functions for testing class CompactMesh and its OFF/OBJ/PLY export
+ * and PLY import.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/CompactMesh.h"
+#include "DGtal/io/writers/MeshWriter.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::RealPoint RealPoint;
+
+namespace
+{
+  /// A closed box made of quads, a triangle fan on top.
+  Mesh<RealPoint> makeMesh( bool withColor )
+  {
+    Mesh<RealPoint> aMesh( withColor );
+    aMesh.addVertex( RealPoint( 0, 0, 0 ) );
+    aMesh.addVertex( RealPoint( 1, 0, 0 ) );
+    aMesh.addVertex( RealPoint( 1, 1, 0 ) );
+    aMesh.addVertex( RealPoint( 0, 1, 0 ) );
+    aMesh.addVertex( RealPoint( 0, 0, 1.5 ) );
+    aMesh.addVertex( RealPoint( 1, 0, 1.5 ) );
+    aMesh.addVertex( RealPoint( 1, 1, 1.5 ) );
+    aMesh.addVertex( RealPoint( 0, 1, 1.5 ) );
+    aMesh.addVertex( RealPoint( 0.5, 0.5, 2.25 ) );
+    aMesh.addQuadFace( 0, 3, 2, 1, Color( 250, 0, 0, 200 ) );
+    aMesh.addQuadFace( 0, 1, 5, 4, Color( 0, 250, 0, 255 ) );
+    aMesh.addQuadFace( 1, 2, 6, 5, Color( 0, 0, 250, 255 ) );
+    aMesh.addQuadFace( 2, 3, 7, 6, Color( 250, 250, 0, 255 ) );
+    aMesh.addQuadFace( 3, 0, 4, 7, Color( 0, 250, 250, 255 ) );
+    aMesh.addTriangularFace( 4, 5, 8, Color( 10, 20, 30, 40 ) );
+    aMesh.addTriangularFace( 5, 6, 8 );
+    aMesh.addTriangularFace( 6, 7, 8 );
+    aMesh.addTriangularFace( 7, 4, 8 );
+    return aMesh;
+  }
+
+  /// @return the vertex indices of the face @a i of a Mesh.
+  template <typename TPoint>
+  std::vector<unsigned int> faceOf( const Mesh<TPoint> & m, unsigned int i )
+  {
+    return m.getFace( i );
+  }
+
+  /// @return the vertex indices of the face @a i of a CompactMesh.
+  template <typename TPoint>
+  std::vector<unsigned int> faceOf( const CompactMesh<TPoint> & m, unsigned int i )
+  {
+    return std::vector<unsigned int>( m.faceBegin( i ), m.faceEnd( i ) );
+  }
+
+  /// @return 'true' if both meshes have the same vertices and faces.
+  template <typename TMesh1, typename TMesh2>
+  bool sameFaces( const TMesh1 & m1, const TMesh2 & m2 )
+  {
+    if ( m1.nbVertex() != m2.nbVertex() || m1.nbFaces() != m2.nbFaces() )
+      return false;
+    for ( unsigned int i = 0; i < m1.nbVertex(); i++ )
+      if ( m1.getVertex( i ) != m2.getVertex( i ) )
+        return false;
+    for ( unsigned int i = 0; i < m1.nbFaces(); i++ )
+      if ( faceOf( m1, i ) != faceOf( m2, i ) )
+        return false;
+    return true;
+  }
+
+  /// @return 'true' if both meshes have the same vertices, faces and colors.
+  template <typename TMesh1, typename TMesh2>
+  bool sameMesh( const TMesh1 & m1, const TMesh2 & m2 )
+  {
+    if ( ! sameFaces( m1, m2 ) )
+      return false;
+    for ( unsigned int i = 0; i < m1.nbFaces(); i++ )
+      if ( m1.getFaceColor( i ) != m2.getFaceColor( i ) )
+        return false;
+    return true;
+  }
+}
+
+TEST_CASE( "Testing CompactMesh" )
+{
+  Mesh<RealPoint> aMesh = makeMesh( true );
+
+  SECTION( "Conversion from and to Mesh" )
+    {
+      CompactMesh<RealPoint> compact( aMesh );
+      REQUIRE( compact.isValid() );
+      REQUIRE( compact.nbFaces() == aMesh.nbFaces() );
+      REQUIRE( compact.faceIndices().size() == 5*4 + 4*3 );
+      REQUIRE( compact.faceOffsets().size() == compact.nbFaces() + 1 );
+      REQUIRE( sameMesh( aMesh, compact ) );
+      REQUIRE( compact.getFaceBarycenter( 0 ) == aMesh.getFaceBarycenter( 0 ) );
+
+      Mesh<RealPoint> back;
+      compact.toMesh( back );
+      REQUIRE( back.isStoringFaceColors() );
+      REQUIRE( sameMesh( back, compact ) );
+    }
+
+  SECTION( "OFF and OBJ exports are identical for Mesh and CompactMesh" )
+    {
+      CompactMesh<RealPoint> compact( aMesh );
+      std::ostringstream off1, off2, obj1, obj2;
+      MeshWriter<RealPoint>::export2OFF( off1, aMesh );
+      MeshWriter<RealPoint>::export2OFF( off2, compact );
+      MeshWriter<RealPoint>::export2OBJ( obj1, aMesh );
+      MeshWriter<RealPoint>::export2OBJ( obj2, compact );
+      REQUIRE( off1.str() == off2.str() );
+      REQUIRE( obj1.str() == obj2.str() );
+    }
+
+  SECTION( "PLY export and import (binary and ASCII)" )
+    {
+      CompactMesh<RealPoint> compact( aMesh );
+      REQUIRE( ( compact >> "testCompactMesh.ply" ) );
+      CompactMesh<RealPoint> binaryImport( true );
+      REQUIRE( ( binaryImport << "testCompactMesh.ply" ) );
+      REQUIRE( sameMesh( aMesh, binaryImport ) );
+
+      // Binary words are little-endian whatever the host: the second
+      // vertex starts with x = 1.0.
+      std::ostringstream binary;
+      MeshWriter<RealPoint>::export2PLY( binary, aMesh, true );
+      const std::string bytes = binary.str();
+      const std::size_t data = bytes.find( "end_header\n" ) + 11;
+      const unsigned char one[ 8 ] = { 0, 0, 0, 0, 0, 0, 0xF0, 0x3F };
+      REQUIRE( bytes.size() > data + 48 );
+      REQUIRE( std::equal( one, one + 8,
+                           reinterpret_cast<const unsigned char*>( bytes.data() ) + data + 24 ) );
+
+      std::ofstream out( "testCompactMeshAscii.ply" );
+      MeshWriter<RealPoint>::export2PLY( out, aMesh, false );
+      out.close();
+      Mesh<RealPoint> asciiImport( true );
+      REQUIRE( MeshReader<RealPoint>::importPLYFile( "testCompactMeshAscii.ply", asciiImport ) );
+      REQUIRE( sameMesh( asciiImport, compact ) );
+    }
+
+  SECTION( "Large meshes are written by chunks" )
+    {
+      CompactMesh<Z3i::Point> big;
+      const unsigned int n = 200;
+      big.reserve( n*n, (n-1)*(n-1), 4*(n-1)*(n-1) );
+      for ( unsigned int j = 0; j < n; j++ )
+        for ( unsigned int i = 0; i < n; i++ )
+          big.addVertex( Z3i::Point( i, j, (i*j) % 7 ) );
+      for ( unsigned int j = 0; j+1 < n; j++ )
+        for ( unsigned int i = 0; i+1 < n; i++ )
+          big.addQuadFace( j*n+i, j*n+i+1, (j+1)*n+i+1, (j+1)*n+i );
+
+      Mesh<Z3i::Point> bigMesh;
+      big.toMesh( bigMesh );
+      std::ostringstream off1, off2;
+      MeshWriter<Z3i::Point>::export2OFF( off1, big );
+      MeshWriter<Z3i::Point>::export2OFF( off2, bigMesh );
+      REQUIRE( off1.str() == off2.str() );
+
+      REQUIRE( ( big >> "testCompactMeshBig.ply" ) );
+      CompactMesh<Z3i::Point> imported;
+      REQUIRE( ( imported << "testCompactMeshBig.ply" ) );
+      REQUIRE( imported.vertices() == big.vertices() );
+      REQUIRE( imported.faceOffsets() == big.faceOffsets() );
+      REQUIRE( imported.faceIndices() == big.faceIndices() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,224 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testScanlineDigitizer.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/07
+ *
+ * Functions for testing class ScanlineDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/ScanlineDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// @return the number of points of the digitizer domain which are
+  /// not classified as the GaussDigitizer does.
+  template <typename TDigitizer, typename TDigitalSet>
+  unsigned int nbErrors( const TDigitizer & dig, const TDigitalSet & aSet )
+  {
+    typedef typename TDigitizer::Domain Domain;
+    const Domain domain = dig.getDomain();
+    unsigned int errors = 0;
+    for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+      if ( dig( *it ) != aSet( *it ) )
+        errors++;
+    return errors;
+  }
+
+  template <typename TDigitizer>
+  unsigned int nbInside( const TDigitizer & dig )
+  {
+    typedef typename TDigitizer::Domain Domain;
+    const Domain domain = dig.getDomain();
+    unsigned int n = 0;
+    for ( typename Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+      if ( dig( *it ) ) n++;
+    return n;
+  }
+}
+
+TEST_CASE( "Testing ScanlineDigitizer" )
+{
+  SECTION( "2D balls" )
+    {
+      typedef ImplicitBall<Z2i::Space> Shape;
+      const double steps[] = { 1.0, 0.1, 0.0137 };
+      for ( unsigned int s = 0; s < 3; s++ )
+        {
+          Shape ball( Z2i::RealPoint( 0.3, -0.7 ), 5.0 );
+          ScanlineDigitizer<Z2i::Space, Shape> dig;
+          dig.attach( ball );
+          dig.init( ball.getLowerBound(), ball.getUpperBound(), steps[ s ] );
+          Z2i::DigitalSet aSet( dig.getDomain() );
+          dig.digitize( aSet );
+          REQUIRE( aSet.size() == nbInside( dig ) );
+          REQUIRE( nbErrors( dig, aSet ) == 0 );
+        }
+      // Points exactly on the circle are inside.
+      Shape ball( Z2i::RealPoint( 0, 0 ), 5.0 );
+      ScanlineDigitizer<Z2i::Space, Shape> dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 1.0 );
+      Z2i::DigitalSet aSet( dig.getDomain() );
+      dig.digitize( aSet );
+      REQUIRE( aSet( Z2i::Point( 3, 4 ) ) );
+      REQUIRE( aSet( Z2i::Point( 0, -5 ) ) );
+      REQUIRE( nbErrors( dig, aSet ) == 0 );
+    }
+
+  SECTION( "3D ball" )
+    {
+      typedef ImplicitBall<Z3i::Space> Shape;
+      Shape ball( Z3i::RealPoint( 0.5, 0.25, -1.0 ), 3.3 );
+      ScanlineDigitizer<Z3i::Space, Shape> dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.2 );
+      Z3i::DigitalSet aSet( dig.getDomain() );
+      dig.digitize( aSet );
+      REQUIRE( aSet.size() == nbInside( dig ) );
+      REQUIRE( nbErrors( dig, aSet ) == 0 );
+    }
+
+  SECTION( "Ball2D and Flower2D" )
+    {
+      typedef Ball2D<Z2i::Space> Disk;
+      Disk disk( 0.1, 0.2, 7.5 );
+      ScanlineDigitizer<Z2i::Space, Disk> digDisk;
+      digDisk.attach( disk );
+      digDisk.init( disk.getLowerBound(), disk.getUpperBound(), 0.05 );
+      Z2i::DigitalSet diskSet( digDisk.getDomain() );
+      digDisk.digitize( diskSet );
+      REQUIRE( diskSet.size() == nbInside( digDisk ) );
+      REQUIRE( nbErrors( digDisk, diskSet ) == 0 );
+
+      typedef Flower2D<Z2i::Space> Flower;
+      Flower flower( 0.5, -0.5, 10.0, 3.0, 5, 0.3 );
+      ScanlineDigitizer<Z2i::Space, Flower> digFlower;
+      digFlower.attach( flower );
+      digFlower.init( flower.getLowerBound(), flower.getUpperBound(), 0.1 );
+      Z2i::DigitalSet flowerSet( digFlower.getDomain() );
+      digFlower.digitize( flowerSet );
+      REQUIRE( flowerSet.size() == nbInside( digFlower ) );
+      REQUIRE( nbErrors( digFlower, flowerSet ) == 0 );
+    }
+
+  SECTION( "Implicit polynomial shapes" )
+    {
+      typedef ImplicitPolynomial3Shape<Z3i::Space> Shape;
+      typedef MPolynomial<3, double> Polynomial3;
+      // Unknown points are evaluated with evaluateLine.
+      REQUIRE( detail::ScanlineHasEvaluateLine<Shape>::value );
+      REQUIRE( ! detail::ScanlineHasEvaluateLine< ImplicitBall<Z3i::Space> >::value );
+      // The next ones vanish at many grid points, the last ones have
+      // high degrees in x (the rounding errors of evaluateLine grow
+      // with it, up to falling back to the orientation).
+      const std::string polys[] = { "x^2+y^2+z^2-1",
+                                    "(x^2+y^2+z^2+0.5^2-0.25^2)^2-4*0.5^2*(x^2+y^2)",
+                                    "x^3y+xz^3+y^3z+z^3+5z",
+                                    "xyz",
+                                    "x^2-y^2+x^4z^2-0.25",
+                                    "x^8+y^8+z^8-0.5",
+                                    "3x^12-2x^6y+y^2+z^2-0.75",
+                                    "x^16+y^4-z^2-0.1" };
+      for ( unsigned int i = 0; i < 8; i++ )
+        {
+          Polynomial3 P;
+          MPolynomialReader<3, double> reader;
+          REQUIRE( reader.read( P, polys[ i ].begin(), polys[ i ].end() ) == polys[ i ].end() );
+          Shape shape( P );
+          ScanlineDigitizer<Z3i::Space, Shape> dig;
+          dig.attach( shape );
+          dig.init( Z3i::RealPoint( -1.2, -1.2, -1.2 ), Z3i::RealPoint( 1.2, 1.2, 1.2 ), 0.05 );
+          Z3i::DigitalSet aSet( dig.getDomain() );
+          dig.digitize( aSet );
+          REQUIRE( aSet.size() == nbInside( dig ) );
+          REQUIRE( nbErrors( dig, aSet ) == 0 );
+        }
+    }
+
+  SECTION( "Digitization into an image, clipped to the image domain" )
+    {
+      typedef ImplicitBall<Z3i::Space> Shape;
+      typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+      Shape ball( Z3i::RealPoint( 0, 0, 0 ), 6.0 );
+      ScanlineDigitizer<Z3i::Space, Shape> dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound(), ball.getUpperBound(), 1.0 );
+      const Z3i::Domain domain( Z3i::Point( -3, -10, -2 ), Z3i::Point( 10, 4, 2 ) );
+      Image image( domain );
+      dig.digitize( image, 7 );
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        REQUIRE( image( *it ) == ( ( *it ).dot( *it ) <= 36 ? 7 : 0 ) );
+    }
+
+  SECTION( "Shapes::euclideanShaper and digitalShaper add to non empty sets" )
+    {
+      typedef Flower2D<Z2i::Space> Flower;
+      Flower flower( 0.0, 0.0, 8.0, 2.0, 4, 0.0 );
+      GaussDigitizer<Z2i::Space, Flower> gauss;
+      gauss.attach( flower );
+      gauss.init( flower.getLowerBound(), flower.getUpperBound(), 0.25 );
+      const Z2i::Domain domain( gauss.getLowerBound() - Z2i::Point( 1, 1 ), gauss.getUpperBound() );
+      const Z2i::Point extra = domain.lowerBound();
+      Z2i::DigitalSet ref( domain ), set1( domain ), set2( domain ), set3( domain );
+      ref.insert( extra );
+      for ( Z2i::Domain::ConstIterator it = gauss.getDomain().begin();
+            it != gauss.getDomain().end(); ++it )
+        if ( gauss( *it ) ) ref.insert( *it );
+      set1.insert( extra );
+      Shapes<Z2i::Domain>::euclideanShaper( set1, flower, 0.25 );
+      set2.insert( extra );
+      Shapes<Z2i::Domain>::digitalShaper( set2, gauss );
+      // Flower2D is thread-safe.
+      set3.insert( extra );
+      Shapes<Z2i::Domain>::euclideanShaper( set3, flower, 0.25, true );
+      REQUIRE( set1.size() == ref.size() );
+      REQUIRE( set2.size() == ref.size() );
+      REQUIRE( set3.size() == ref.size() );
+      for ( Z2i::DigitalSet::ConstIterator it = ref.begin(); it != ref.end(); ++it )
+        {
+          REQUIRE( set1( *it ) );
+          REQUIRE( set2( *it ) );
+          REQUIRE( set3( *it ) );
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
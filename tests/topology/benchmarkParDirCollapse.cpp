@@ -0,0 +1,114 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkParDirCollapse.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/24
+ *
+ * Functions for benchmarking the sequential and the parallel versions
+ * of ParDirCollapse on solid tori in 256^3 and 512^3 domains.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <benchmark/benchmark.h>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingMap.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/ParDirCollapse.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /**
+   * Builds the complex of a solid torus centered in the domain
+   * [0,size-1]^3, whose tube radius is size/16.
+   */
+  template <typename CC>
+  void makeTorus( CC & complex, Z3i::KSpace & K, Z3i::Integer size )
+  {
+    Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+    Z3i::DigitalSet set( domain );
+    const double c  = 0.5 * static_cast<double>( size - 1 );
+    const double R  = 0.3 * static_cast<double>( size );
+    const double r  = static_cast<double>( size ) / 16.0;
+    for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+      {
+        const double x = (*it)[ 0 ] - c, y = (*it)[ 1 ] - c, z = (*it)[ 2 ] - c;
+        const double d = std::sqrt( x * x + y * y ) - R;
+        if ( d * d + z * z <= r * r )
+          set.insertNew( *it );
+      }
+    K.init( domain.lowerBound(), domain.upperBound(), true );
+    complex.clear();
+    complex.construct( set );
+  }
+}
+
+template <typename TCellContainer, bool inParallel>
+static void BM_collapseSurface( benchmark::State& state )
+{
+  typedef CubicalComplex< Z3i::KSpace, TCellContainer > CC;
+  Z3i::KSpace K;
+  CC torus( K );
+  makeTorus( torus, K, static_cast<Z3i::Integer>( state.range( 0 ) ) );
+  while ( state.KeepRunning() )
+    {
+      state.PauseTiming();
+      CC complex = torus;
+      ParDirCollapse< CC > thinning( K );
+      thinning.attach( &complex );
+      state.ResumeTiming();
+      thinning.collapseSurface( inParallel );
+      benchmark::DoNotOptimize( complex.nbCells( 0 ) );
+    }
+  state.counters[ "cells" ] = static_cast<double>( torus.nbCells( 0 ) + torus.nbCells( 1 )
+                                                   + torus.nbCells( 2 ) + torus.nbCells( 3 ) );
+}
+
+typedef std::map< Z3i::Cell, CubicalCellData >        StdMap;
+typedef OpenAddressingMap< Z3i::Cell, CubicalCellData > FlatMap;
+
+BENCHMARK_TEMPLATE2( BM_collapseSurface, StdMap, false )->Arg( 256 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE2( BM_collapseSurface, StdMap, true )->Arg( 256 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE2( BM_collapseSurface, FlatMap, false )->Arg( 256 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+BENCHMARK_TEMPLATE2( BM_collapseSurface, FlatMap, true )->Arg( 256 )->Arg( 512 )->Unit( benchmark::kMillisecond );
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char**argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
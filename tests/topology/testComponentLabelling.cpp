@@ -0,0 +1,217 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testComponentLabelling.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/25
+ *
+ * Functions for testing functions::labelComponents against
+ * breadth-first traversals of objects.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/topology/ComponentLabelling.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+namespace
+{
+  /// Inserts each point of @a domain in @a set with probability @a density.
+  template <typename TDomain, typename TDigitalSet>
+  void randomSet( const TDomain & domain, double density, TDigitalSet & set )
+  {
+    for ( typename TDomain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+      if ( static_cast<double>( rand() ) / RAND_MAX < density )
+        set.insertNew( *it );
+  }
+
+  /**
+     Labels the components of @a obj by breadth-first traversals,
+     numbered in the order of the domain scan.
+     @return the number of components.
+  */
+  template <typename TObject, typename TImage>
+  unsigned int referenceLabels( const TObject & obj, TImage & ref )
+  {
+    unsigned int nb = 0;
+    for ( typename TImage::Domain::ConstIterator it = ref.domain().begin(),
+            itE = ref.domain().end(); it != itE; ++it )
+      ref.setValue( *it, 0 );
+    for ( typename TImage::Domain::ConstIterator it = ref.domain().begin(),
+            itE = ref.domain().end(); it != itE; ++it )
+      {
+        if ( ref( *it ) != 0 || obj.pointSet().find( *it ) == obj.pointSet().end() )
+          continue;
+        ++nb;
+        BreadthFirstVisitor< TObject, std::set<typename TObject::Vertex> > visitor( obj, *it );
+        for ( ; ! visitor.finished(); visitor.expand() )
+          ref.setValue( visitor.current().first, nb );
+      }
+    return nb;
+  }
+
+  /// @return 'true' if the labels of @a obj computed sequentially and in parallel equal the reference ones.
+  template <typename TObject>
+  bool checkLabels( const TObject & obj )
+  {
+    typedef typename TObject::Domain Domain;
+    typedef ImageContainerBySTLVector<Domain, unsigned int> LabelImage;
+    const Domain & domain = obj.domain();
+    LabelImage ref( domain ), labels( domain );
+    const unsigned int nb = referenceLabels( obj, ref );
+    for ( int parallel = 0; parallel < 2; ++parallel )
+      {
+        std::vector<typename Domain::Size> sizes;
+        const typename Domain::Size n =
+          functions::labelComponents( obj.topology().kappa(), obj.pointSet(),
+                                      labels, sizes, parallel == 1 );
+        if ( n != nb || sizes.size() != nb + 1 ) return false;
+        std::vector<typename Domain::Size> refSizes( nb + 1, 0 );
+        for ( typename Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+          {
+            if ( labels( *it ) != ref( *it ) ) return false;
+            ++refSizes[ ref( *it ) ];
+          }
+        if ( sizes != refSizes ) return false;
+      }
+    return true;
+  }
+
+  /// @return 'true' if writeComponents gives the components of the reference labelling.
+  template <typename TObject>
+  bool checkWriteComponents( const TObject & obj )
+  {
+    typedef typename TObject::Domain Domain;
+    typedef ImageContainerBySTLVector<Domain, unsigned int> LabelImage;
+    LabelImage ref( obj.domain() );
+    const unsigned int nb = referenceLabels( obj, ref );
+    std::vector<TObject> components;
+    std::back_insert_iterator< std::vector<TObject> > it( components );
+    if ( TObject( obj ).writeComponents( it ) != nb || components.size() != nb ) return false;
+    std::set<unsigned int> seen;
+    typename TObject::Size total = 0;
+    for ( unsigned int i = 0; i < nb; ++i )
+      {
+        const TObject & component = components[ i ];
+        const unsigned int l = ref( *component.pointSet().begin() );
+        if ( ! seen.insert( l ).second ) return false;
+        for ( typename TObject::DigitalSet::ConstIterator itP = component.pointSet().begin(),
+                itPE = component.pointSet().end(); itP != itPE; ++itP )
+          if ( ref( *itP ) != l ) return false;
+        total += component.size();
+        if ( component.connectedness() != CONNECTED ) return false;
+      }
+    // The first component is the one of the first point of the set.
+    if ( nb > 0 && ref( *obj.pointSet().begin() ) != ref( *components.front().pointSet().begin() ) )
+      return false;
+    const Connectedness cxn = TObject( obj.topology(), obj.pointSet() ).computeConnectedness();
+    return total == obj.size() && cxn == ( nb <= 1 ? CONNECTED : DISCONNECTED );
+  }
+}
+
+TEST_CASE( "Labelling of 2D objects", "[component_labelling]" )
+{
+  srand( 0 );
+  const Z2i::Domain domain( Z2i::Point( -7, 3 ), Z2i::Point( 56, 50 ) );
+  for ( int i = 0; i < 3; ++i )
+    {
+      Z2i::DigitalSet set( domain );
+      randomSet( domain, 0.3 + 0.15 * i, set );
+      Z2i::Object4_8 obj4( Z2i::dt4_8, set );
+      Z2i::Object8_4 obj8( Z2i::dt8_4, set );
+      REQUIRE( checkLabels( obj4 ) );
+      REQUIRE( checkLabels( obj8 ) );
+      REQUIRE( checkWriteComponents( obj4 ) );
+      REQUIRE( checkWriteComponents( obj8 ) );
+    }
+}
+
+TEST_CASE( "Labelling of 3D objects", "[component_labelling]" )
+{
+  srand( 1 );
+  const Z3i::Domain domain( Z3i::Point( 2, -5, 0 ), Z3i::Point( 21, 11, 22 ) );
+  for ( int i = 0; i < 2; ++i )
+    {
+      Z3i::DigitalSet set( domain );
+      randomSet( domain, 0.2 + 0.1 * i, set );
+      Z3i::Object6_18  obj6( Z3i::dt6_18, set );
+      Z3i::Object18_6  obj18( Z3i::dt18_6, set );
+      Z3i::Object26_6  obj26( Z3i::dt26_6, set );
+      REQUIRE( checkLabels( obj6 ) );
+      REQUIRE( checkLabels( obj18 ) );
+      REQUIRE( checkLabels( obj26 ) );
+      REQUIRE( checkWriteComponents( obj6 ) );
+      REQUIRE( checkWriteComponents( obj18 ) );
+      REQUIRE( checkWriteComponents( obj26 ) );
+    }
+}
+
+TEST_CASE( "Labelling of a thresholded image", "[component_labelling]" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 9, 9 ) );
+  Image image( domain );
+  Z3i::DigitalSet set( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      // Two balls, and a diagonal of isolated points.
+      const Z3i::Point p = *it;
+      const Z3i::Point c1( 2, 2, 2 ), c2( 7, 7, 7 );
+      int v = 0;
+      if ( ( p - c1 ).dot( p - c1 ) <= 3 || ( p - c2 ).dot( p - c2 ) <= 3 ) v = 2;
+      else if ( p[ 0 ] == p[ 1 ] && p[ 1 ] == p[ 2 ] ) v = 1;
+      image.setValue( p, v );
+      if ( v > 0 ) set.insertNew( p );
+    }
+  ImageContainerBySTLVector<Z3i::Domain, unsigned char> labels( domain );
+  std::vector<Z3i::Domain::Size> sizes;
+  const Z3i::Domain::Size nbBalls =
+    functions::labelComponents( Z3i::adj6, image, [] ( int v ) { return v > 1; }, labels, sizes, true );
+  REQUIRE( nbBalls == 2 );
+  REQUIRE( sizes.size() == 3 );
+  REQUIRE( sizes[ 1 ] == sizes[ 2 ] );
+  REQUIRE( labels( Z3i::Point( 2, 2, 2 ) ) == 1 );
+  REQUIRE( labels( Z3i::Point( 7, 7, 7 ) ) == 2 );
+  REQUIRE( labels( Z3i::Point( 0, 0, 0 ) ) == 0 );
+  // The diagonal points (0,0,0), (4,4,4), (5,5,5) and (9,9,9) are isolated.
+  REQUIRE( functions::labelComponents( Z3i::adj6, image, [] ( int v ) { return v > 0; },
+                                       labels, sizes ) == 6 );
+  REQUIRE( functions::labelComponents( Z3i::adj18, image, [] ( int v ) { return v > 0; },
+                                       labels, sizes ) == 6 );
+  REQUIRE( labels( Z3i::Point( 0, 0, 0 ) ) == 1 );
+  REQUIRE( labels( Z3i::Point( 9, 9, 9 ) ) == 6 );
+  REQUIRE( functions::labelComponents( Z3i::adj26, image, [] ( int v ) { return v > 0; },
+                                       labels, sizes, true ) == 1 );
+  REQUIRE( sizes[ 1 ] == set.size() );
+  REQUIRE( sizes[ 0 ] == domain.size() - set.size() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -32,7 +32,10 @@
 #include <map>
 #include <unordered_map>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingMap.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/topology/CubicalComplex.h"
@@ -621,5 +624,130 @@ SCENARIO( "CubicalComplex< K2,std::map<> > set operations and relations", "[cubi
   bool X1bd_equal_X1boundary = X1bd == X1.boundary();
   REQUIRE( X1bd_equal_X1boundary );
 }
+
+SCENARIO( "CubicalComplex< K3,OpenAddressingMap<> > bulk construction, close and open", "[cubical_complex][bulk]" )
+{
+  typedef KhalimskySpaceND<3>                          KSpace;
+  typedef KSpace::Space                                Space;
+  typedef HyperRectDomain<Space>                       Domain;
+  typedef KSpace::Point                                Point;
+  typedef KSpace::Cell                                 Cell;
+  typedef DigitalSetBySTLSet<Domain>                   DigitalSet;
+  typedef ImageContainerBySTLVector<Domain, int>       Image;
+  typedef std::map<Cell, CubicalCellData>              RefMap;
+  typedef OpenAddressingMap<Cell, CubicalCellData>     Map;
+  typedef CubicalComplex< KSpace, RefMap >             RefCC;
+  typedef CubicalComplex< KSpace, Map >                CC;
+
+  using namespace DGtal::functions;
+
+  srand( 0 );
+  KSpace K;
+  K.init( Point( 0,0,0 ), Point( 15,15,15 ), true );
+  Domain domain( Point( 0,0,0 ), Point( 15,15,15 ) );
+  DigitalSet set( domain );
+  Image image( domain );
+  for ( Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    if ( rand() % 3 == 0 )
+      {
+        set.insertNew( *it );
+        image.setValue( *it, 1 );
+      }
+    else
+      image.setValue( *it, 0 );
+  // Builds the reference complex cell by cell.
+  RefCC ref( K );
+  for ( DigitalSet::ConstIterator it = set.begin(), itE = set.end(); it != itE; ++it )
+    {
+      const Cell spel = K.uSpel( *it );
+      ref.insertCell( spel );
+      KSpace::Cells faces = K.uFaces( spel );
+      ref.insertCells( faces.begin(), faces.end() );
+    }
+
+  GIVEN( "Complexes built in bulk from a digital set and from an image" ) {
+    RefCC refX( K );
+    refX.construct( set );
+    CC X( K );
+    X.construct( set );
+    CC Y( K );
+    Y.construct( image, functors::Identity() );
+    THEN( "They have the same cells as the complex built cell by cell" ) {
+      bool refX_equal_ref = refX == ref;
+      REQUIRE( refX_equal_ref );
+      REQUIRE( X.size() == ref.size() );
+      for ( Dimension d = 0; d <= 3; ++d )
+        {
+          REQUIRE( X.nbCells( d ) == ref.nbCells( d ) );
+          REQUIRE( Y.nbCells( d ) == ref.nbCells( d ) );
+          bool same = true;
+          for ( RefCC::CellMapConstIterator it = ref.begin( d ), itE = ref.end( d ); it != itE; ++it )
+            same = same && X.belongs( d, it->first ) && Y.belongs( d, it->first );
+          REQUIRE( same );
+        }
+      bool X_equal_Y = X == Y;
+      REQUIRE( X_equal_Y );
+      REQUIRE( X.isValid() );
+    }
+    WHEN( "Opening and closing them" ) {
+      RefCC refOpen = ref;
+      refOpen.open();
+      CC XOpen = X;
+      XOpen.open();
+      CC XClosed = XOpen;
+      XClosed.close();
+      RefCC refClosed = refOpen;
+      refClosed.close();
+      THEN( "They give the same complexes as with std::map" ) {
+        for ( Dimension d = 0; d <= 3; ++d )
+          {
+            REQUIRE( XOpen.nbCells( d ) == refOpen.nbCells( d ) );
+            REQUIRE( XClosed.nbCells( d ) == refClosed.nbCells( d ) );
+          }
+        REQUIRE( XOpen.euler() == refOpen.euler() );
+        bool XClosed_equal_X = XClosed == X;
+        bool X_minus_XOpen_equal_boundary = ( X - XOpen ) == X.boundary();
+        REQUIRE( XClosed_equal_X );
+        REQUIRE( X_minus_XOpen_equal_boundary );
+      }
+    }
+    WHEN( "Using set operations" ) {
+      CC Z( K );
+      Z.insertCell( K.uSpel( Point( 3,3,3 ) ) );
+      Z.insertCell( K.uSpel( Point( 4,3,3 ) ) );
+      Z.close();
+      THEN( "Set relations hold" ) {
+        bool X_and_Z_included_in_Z = ( X & Z ) <= Z;
+        bool X_included_in_X_or_Z = X <= ( X | Z );
+        bool X_or_Z_minus_Z_included_in_X = ( ( X | Z ) - Z ) <= X;
+        bool xor_or_and_equal_or = ( ( X ^ Z ) | ( X & Z ) ) == ( X | Z );
+        REQUIRE( X_and_Z_included_in_Z );
+        REQUIRE( X_included_in_X_or_Z );
+        REQUIRE( X_or_Z_minus_Z_included_in_X );
+        REQUIRE( xor_or_and_equal_or );
+      }
+    }
+  }
+
+  GIVEN( "A closed cube of 4x4x4 voxels" ) {
+    std::vector<Cell> S;
+    for ( KSpace::Integer x = 0; x < 4; ++x )
+      for ( KSpace::Integer y = 0; y < 4; ++y )
+        for ( KSpace::Integer z = 0; z < 4; ++z )
+          S.push_back( K.uSpel( Point( x, y, z ) ) );
+    CC X( K );
+    X.insertCells( S.begin(), S.end() );
+    X.close();
+    WHEN( "Collapsing it" ) {
+      CC::DefaultCellMapIteratorPriority P;
+      functions::collapse( X, S.begin(), S.end(), P, false, true );
+      THEN( "It keeps its topology" ) {
+        REQUIRE( X.euler() == 1 );
+        REQUIRE( X.nbCells( 3 ) == 0 );
+      }
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
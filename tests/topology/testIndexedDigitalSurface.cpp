@@ -0,0 +1,215 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/26
+ *
+ * Functions for testing class IndexedDigitalSurface against the
+ * traversals of DigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// @return 'true' if the arcs of @a indexed are the ones of its surface.
+  template <typename TIndexedSurface>
+  bool checkArcs( const TIndexedSurface & indexed )
+  {
+    typedef typename TIndexedSurface::Surface Surface;
+    typedef typename TIndexedSurface::Index Index;
+    const Surface & surface = indexed.surface();
+    if ( indexed.nbVertices() != surface.size() ) return false;
+    Index nbArcs = 0;
+    for ( Index v = 0; v < indexed.nbVertices(); ++v )
+      {
+        if ( indexed.index( indexed.surfel( v ) ) != v ) return false;
+        const typename Surface::ArcRange arcs = surface.outArcs( indexed.surfel( v ) );
+        if ( indexed.degree( v ) != arcs.size() ) return false;
+        if ( indexed.outArcsBegin( v ) != nbArcs ) return false;
+        for ( Index a = indexed.outArcsBegin( v ), i = 0; a < indexed.outArcsEnd( v ); ++a, ++i )
+          {
+            if ( ! ( indexed.arc( a ) == arcs[ i ] ) ) return false;
+            if ( indexed.tail( a ) != v ) return false;
+            if ( indexed.surfel( indexed.head( a ) ) != surface.head( arcs[ i ] ) ) return false;
+            const Index b = indexed.opposite( a );
+            if ( b == TIndexedSurface::INVALID_INDEX ) return false;
+            if ( indexed.opposite( b ) != a || indexed.tail( b ) != indexed.head( a ) ) return false;
+            if ( ! ( indexed.arc( b ) == surface.opposite( arcs[ i ] ) ) ) return false;
+          }
+        nbArcs += indexed.degree( v );
+      }
+    return nbArcs == indexed.nbArcs();
+  }
+
+  /// @return 'true' if the faces of @a indexed are the ones of its surface.
+  template <typename TIndexedSurface>
+  bool checkFaces( const TIndexedSurface & indexed )
+  {
+    typedef typename TIndexedSurface::Surface Surface;
+    typedef typename TIndexedSurface::Index Index;
+    typedef typename TIndexedSurface::IndexConstIterator IndexConstIterator;
+    const Surface & surface = indexed.surface();
+    const typename Surface::FaceSet all = surface.allFaces();
+    if ( indexed.nbFaces() != all.size() ) return false;
+    Index f = 0;
+    for ( typename Surface::FaceSet::const_iterator it = all.begin(), itE = all.end();
+          it != itE; ++it, ++f )
+      {
+        if ( ! ( indexed.surfaceFace( f ) == *it ) ) return false;
+        if ( indexed.isClosed( f ) != it->isClosed() ) return false;
+        const typename Surface::VertexRange vertices = surface.verticesAroundFace( *it );
+        if ( indexed.faceDegree( f ) != vertices.size() ) return false;
+        Index i = 0;
+        for ( IndexConstIterator itV = indexed.verticesBegin( f ); itV != indexed.verticesEnd( f ); ++itV, ++i )
+          if ( indexed.surfel( *itV ) != vertices[ i ] ) return false;
+        // Arcs go from a vertex of the face to the next one.
+        i = 0;
+        for ( IndexConstIterator itA = indexed.arcsBegin( f ); itA != indexed.arcsEnd( f ); ++itA, ++i )
+          {
+            const Index n = indexed.faceDegree( f );
+            if ( i + 1 == n && ! indexed.isClosed( f ) )
+              {
+                if ( *itA != TIndexedSurface::INVALID_INDEX ) return false;
+                continue;
+              }
+            if ( indexed.tail( *itA ) != indexed.verticesBegin( f )[ i ] ) return false;
+            if ( indexed.head( *itA ) != indexed.verticesBegin( f )[ ( i + 1 ) % n ] ) return false;
+          }
+      }
+    for ( Index v = 0; v < indexed.nbVertices(); ++v )
+      {
+        const typename Surface::FaceRange faces = surface.facesAroundVertex( indexed.surfel( v ) );
+        if ( static_cast<std::size_t>( indexed.facesAroundVertexEnd( v )
+                                       - indexed.facesAroundVertexBegin( v ) ) != faces.size() )
+          return false;
+        Index i = 0;
+        for ( IndexConstIterator it = indexed.facesAroundVertexBegin( v );
+              it != indexed.facesAroundVertexEnd( v ); ++it, ++i )
+          if ( ! ( indexed.surfaceFace( *it ) == faces[ i ] ) ) return false;
+      }
+    // Following next arcs walks along faces.
+    for ( Index a = 0; a < indexed.nbArcs(); ++a )
+      {
+        const Index arcFace = indexed.face( a );
+        Index b = a, k = 0;
+        while ( k < indexed.faceDegree( arcFace ) )
+          {
+            const Index c = indexed.next( b );
+            if ( c == TIndexedSurface::INVALID_INDEX ) break;
+            if ( indexed.face( c ) != arcFace || indexed.tail( c ) != indexed.head( b ) ) return false;
+            b = c; ++k;
+          }
+        if ( indexed.isClosed( arcFace ) && ( k != indexed.faceDegree( arcFace ) || b != a ) ) return false;
+        if ( ! indexed.isClosed( arcFace ) && k >= indexed.faceDegree( arcFace ) ) return false;
+      }
+    return true;
+  }
+
+  /// @return 'true' if both indexed surfaces have the same arcs and faces.
+  template <typename TIndexedSurface>
+  bool sameIndexing( const TIndexedSurface & s1, const TIndexedSurface & s2 )
+  {
+    typedef typename TIndexedSurface::Index Index;
+    if ( s1.nbVertices() != s2.nbVertices() || s1.nbArcs() != s2.nbArcs()
+         || s1.nbFaces() != s2.nbFaces() ) return false;
+    for ( Index a = 0; a < s1.nbArcs(); ++a )
+      if ( s1.head( a ) != s2.head( a ) || s1.opposite( a ) != s2.opposite( a )
+           || s1.face( a ) != s2.face( a ) || s1.next( a ) != s2.next( a ) )
+        return false;
+    for ( Index f = 0; f < s1.nbFaces(); ++f )
+      if ( ! std::equal( s1.arcsBegin( f ), s1.arcsEnd( f ), s2.arcsBegin( f ) ) )
+        return false;
+    return true;
+  }
+}
+
+TEST_CASE( "Testing IndexedDigitalSurface" )
+{
+  typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Boundary;
+  typedef SetOfSurfels<Z3i::KSpace> SurfelSet;
+  typedef IndexedDigitalSurface<Boundary> IndexedBoundary;
+  typedef IndexedDigitalSurface<SurfelSet> IndexedSurfelSet;
+
+  const Z3i::Domain domain( Z3i::Point( -10, -10, -10 ), Z3i::Point( 10, 10, 10 ) );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Z3i::DigitalSet shape_set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( shape_set, Z3i::Point( 0, 0, 0 ), 6 );
+  Shapes<Z3i::Domain>::addNorm1Ball( shape_set, Z3i::Point( 4, 3, 2 ), 4 );
+  Boundary boundary( K, shape_set );
+  DigitalSurface<Boundary> closedSurface( boundary );
+
+  SECTION( "Indexing a closed surface" )
+    {
+      IndexedBoundary indexed( closedSurface );
+      REQUIRE( indexed.isValid() );
+      REQUIRE( indexed.nbFacesPerArc() == 1 );
+      REQUIRE( checkArcs( indexed ) );
+      REQUIRE( checkFaces( indexed ) );
+      REQUIRE( ! indexed.isIndexed( K.sSpel( Z3i::Point( 0, 0, 0 ) ) ) );
+      // Euler characteristic of a sphere.
+      const int chi = int( indexed.nbVertices() ) - int( indexed.nbArcs() / 2 ) + int( indexed.nbFaces() );
+      REQUIRE( chi == 2 );
+      IndexedBoundary parallel( closedSurface, true );
+      REQUIRE( sameIndexing( indexed, parallel ) );
+    }
+
+  SECTION( "Indexing an open surface" )
+    {
+      // The part of the boundary below the plane z = 1.
+      std::set<Z3i::SCell> part;
+      for ( Boundary::SurfelConstIterator it = boundary.begin(), itE = boundary.end(); it != itE; ++it )
+        if ( K.sKCoord( *it, 2 ) <= 2 ) part.insert( *it );
+      SurfelSet surfels( K, SurfelAdjacency<3>( true ), part );
+      DigitalSurface<SurfelSet> openSurface( surfels );
+      IndexedSurfelSet indexed( openSurface );
+      REQUIRE( indexed.nbVertices() == part.size() );
+      REQUIRE( checkArcs( indexed ) );
+      REQUIRE( checkFaces( indexed ) );
+      unsigned int nbOpen = 0;
+      for ( IndexedSurfelSet::FaceIndex f = 0; f < indexed.nbFaces(); ++f )
+        if ( ! indexed.isClosed( f ) ) ++nbOpen;
+      REQUIRE( nbOpen > 0 );
+      IndexedSurfelSet parallel;
+      parallel.init( openSurface, true );
+      REQUIRE( sameIndexing( indexed, parallel ) );
+      trace.info() << parallel << std::endl;
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstddef>
 #include <algorithm>
+#include <vector>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -703,6 +704,102 @@ void testCellularGridSpaceNDCoFaces( KSpace const & K )
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/** Compares the allocation-free and batched neighborhood and incidence
+ * services to the ones returning cell collections, on every cell of
+ * the space.
+ *
+ * @tparam KSpace the Khalimsky space type (auto-deduced).
+ * @param K the Khalimsky space.
+ */
+template < typename KSpace >
+void testFixedSizeIncidence( KSpace const & K )
+{
+  INFO( "Testing allocation-free and batched incidence services" );
+
+  using Point  = typename KSpace::Point;
+  using Cell   = typename KSpace::Cell;
+  using SCell  = typename KSpace::SCell;
+  using Domain = HyperRectDomain< typename KSpace::Space >;
+
+  std::vector<Cell>  ucells;
+  std::vector<SCell> scells;
+  const Domain kdomain( K.uKCoords( K.lowerCell() ), K.uKCoords( K.upperCell() ) );
+  for ( Point const & kp : kdomain )
+    {
+      ucells.push_back( K.uCell( kp ) );
+      scells.push_back( K.sCell( kp, ucells.size() % 3 == 0 ? K.NEG : K.POS ) );
+    }
+
+  typename KSpace::IncidentCellArray     uIncident;
+  typename KSpace::IncidentSCellArray    sIncident;
+  typename KSpace::NeighborhoodCellArray  uNeighbors;
+  typename KSpace::NeighborhoodSCellArray sNeighbors;
+  typename KSpace::FaceCellArray         faces;
+  for ( std::size_t i = 0; i < ucells.size(); ++i )
+    {
+      const Cell  & c  = ucells[ i ];
+      const SCell & sc = scells[ i ];
+      INFO( "Current cell is " << sc );
+
+      const auto uLower = K.uLowerIncident( c );
+      REQUIRE( K.uLowerIncident( c, uIncident ) == uLower.size() );
+      REQUIRE( std::equal( uLower.begin(), uLower.end(), uIncident.begin() ) );
+      const auto uUpper = K.uUpperIncident( c );
+      REQUIRE( K.uUpperIncident( c, uIncident ) == uUpper.size() );
+      REQUIRE( std::equal( uUpper.begin(), uUpper.end(), uIncident.begin() ) );
+      const auto sLower = K.sLowerIncident( sc );
+      REQUIRE( K.sLowerIncident( sc, sIncident ) == sLower.size() );
+      REQUIRE( std::equal( sLower.begin(), sLower.end(), sIncident.begin() ) );
+      const auto sUpper = K.sUpperIncident( sc );
+      REQUIRE( K.sUpperIncident( sc, sIncident ) == sUpper.size() );
+      REQUIRE( std::equal( sUpper.begin(), sUpper.end(), sIncident.begin() ) );
+      const auto uNeighborhood = K.uNeighborhood( c );
+      REQUIRE( K.uNeighborhood( c, uNeighbors ) == uNeighborhood.size() );
+      REQUIRE( std::equal( uNeighborhood.begin(), uNeighborhood.end(), uNeighbors.begin() ) );
+      const auto sNeighborhood = K.sNeighborhood( sc );
+      REQUIRE( K.sNeighborhood( sc, sNeighbors ) == sNeighborhood.size() );
+      REQUIRE( std::equal( sNeighborhood.begin(), sNeighborhood.end(), sNeighbors.begin() ) );
+      const auto uFaces = K.uFaces( c );
+      REQUIRE( K.uFaces( c, faces ) == uFaces.size() );
+      REQUIRE( std::equal( uFaces.begin(), uFaces.end(), faces.begin() ) );
+    }
+
+  std::vector<Cell>  ubatch;
+  std::vector<SCell> sbatch;
+  std::vector<std::size_t> offsets;
+  K.uLowerIncident( ucells.begin(), ucells.end(), ubatch, offsets );
+  REQUIRE( offsets.size() == ucells.size() + 1 );
+  for ( std::size_t i = 0; i < ucells.size(); ++i )
+    {
+      const auto uLower = K.uLowerIncident( ucells[ i ] );
+      REQUIRE( offsets[ i + 1 ] - offsets[ i ] == uLower.size() );
+      REQUIRE( std::equal( uLower.begin(), uLower.end(), ubatch.begin() + offsets[ i ] ) );
+    }
+  K.uUpperIncident( ucells.begin(), ucells.end(), ubatch, offsets );
+  for ( std::size_t i = 0; i < ucells.size(); ++i )
+    {
+      const auto uUpper = K.uUpperIncident( ucells[ i ] );
+      REQUIRE( offsets[ i + 1 ] - offsets[ i ] == uUpper.size() );
+      REQUIRE( std::equal( uUpper.begin(), uUpper.end(), ubatch.begin() + offsets[ i ] ) );
+    }
+  K.sLowerIncident( scells.begin(), scells.end(), sbatch, offsets );
+  for ( std::size_t i = 0; i < scells.size(); ++i )
+    {
+      const auto sLower = K.sLowerIncident( scells[ i ] );
+      REQUIRE( offsets[ i + 1 ] - offsets[ i ] == sLower.size() );
+      REQUIRE( std::equal( sLower.begin(), sLower.end(), sbatch.begin() + offsets[ i ] ) );
+    }
+  K.sUpperIncident( scells.begin(), scells.end(), sbatch, offsets );
+  REQUIRE( offsets.back() == sbatch.size() );
+  for ( std::size_t i = 0; i < scells.size(); ++i )
+    {
+      const auto sUpper = K.sUpperIncident( scells[ i ] );
+      REQUIRE( offsets[ i + 1 ] - offsets[ i ] == sUpper.size() );
+      REQUIRE( std::equal( sUpper.begin(), sUpper.end(), sbatch.begin() + offsets[ i ] ) );
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Test cases
 
@@ -777,6 +874,7 @@ TEST_CASE( "3D closed Khalimsky space", "[KSpace][3D][closed]" )
   testFindABel( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "2D closed Khalimsky space", "[KSpace][2D][closed]" )
@@ -797,6 +895,7 @@ TEST_CASE( "2D closed Khalimsky space", "[KSpace][2D][closed]" )
   testCellDrawOnBoard( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "4D closed Khalimsky space", "[KSpace][4D][closed]" )
@@ -817,6 +916,7 @@ TEST_CASE( "4D closed Khalimsky space", "[KSpace][4D][closed]" )
   testFindABel( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "2D open Khalimsky space", "[KSpace][2D][open]" )
@@ -837,6 +937,7 @@ TEST_CASE( "2D open Khalimsky space", "[KSpace][2D][open]" )
   testCellDrawOnBoard( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "3D open Khalimsky space", "[KSpace][3D][open]" )
@@ -857,6 +958,7 @@ TEST_CASE( "3D open Khalimsky space", "[KSpace][3D][open]" )
   testFindABel( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "2D periodic Khalimsky space", "[KSpace][2D][periodic]" )
@@ -877,6 +979,7 @@ TEST_CASE( "2D periodic Khalimsky space", "[KSpace][2D][periodic]" )
   testCellDrawOnBoard( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "3D periodic Khalimsky space", "[KSpace][3D][periodic]" )
@@ -897,6 +1000,7 @@ TEST_CASE( "3D periodic Khalimsky space", "[KSpace][3D][periodic]" )
   testFindABel( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "2D mixed Khalimsky space", "[KSpace][2D][closed][periodic]" )
@@ -917,6 +1021,7 @@ TEST_CASE( "2D mixed Khalimsky space", "[KSpace][2D][closed][periodic]" )
   testCellDrawOnBoard( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
 TEST_CASE( "3D mixed Khalimsky space", "[KSpace][3D][closed][periodic][open]" )
@@ -937,5 +1042,6 @@ TEST_CASE( "3D mixed Khalimsky space", "[KSpace][3D][closed][periodic][open]" )
   testFindABel( K );
   testCellularGridSpaceNDFaces( K );
   testCellularGridSpaceNDCoFaces( K );
+  testFixedSizeIncidence( K );
 }
 
@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testLabelBoundaries.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/12/15
+ *
+ * Functions for testing Surfaces::sMakeLabelBoundaries against the
+ * boundaries of each label given by Surfaces::sMakeBoundary.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <map>
+#include <utility>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> LabelImage;
+  typedef Surfaces<Z3i::KSpace> SurfaceHelper;
+  typedef std::map< std::pair<int, int>, std::vector<Z3i::SCell> > LabelBoundaries;
+
+  /// Point predicate of the spels with a given label.
+  struct HasLabel
+  {
+    typedef Z3i::Point Point;
+    const LabelImage * image;
+    int label;
+    HasLabel( const LabelImage & anImage, int aLabel ) : image( &anImage ), label( aLabel ) {}
+    bool operator()( const Point & p ) const { return (*image)( p ) == label; }
+  };
+
+  /// @return a label image made of two balls and two half-spaces.
+  LabelImage makeLabels( const Z3i::Domain & domain )
+  {
+    LabelImage image( domain );
+    for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+      {
+        const Z3i::Point & p = *it;
+        const Z3i::Point c1( 3, 2, 1 ), c2( -5, -4, 2 );
+        int label = p[ 2 ] < 0 ? 1 : 3;
+        if ( ( p - c1 ).norm() <= 5.5 ) label = 7;
+        else if ( ( p - c2 ).norm() <= 4.0 ) label = 2;
+        image.setValue( p, label );
+      }
+    return image;
+  }
+}
+
+TEST_CASE( "Testing Surfaces::sMakeLabelBoundaries" )
+{
+  const Z3i::Domain domain( Z3i::Point( -10, -9, -8 ), Z3i::Point( 11, 10, 9 ) );
+  const LabelImage image = makeLabels( domain );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+
+  LabelBoundaries boundaries;
+  SurfaceHelper::sMakeLabelBoundaries( boundaries, K, image,
+                                       domain.lowerBound(), domain.upperBound() );
+
+  SECTION( "Pairs of labels" )
+    {
+      // 1|3, 1|2, 2|3, 1|7, 3|7 (the balls do not touch each other).
+      REQUIRE( boundaries.size() == 5 );
+      REQUIRE( boundaries.count( std::make_pair( 2, 7 ) ) == 0 );
+      for ( LabelBoundaries::const_iterator it = boundaries.begin(); it != boundaries.end(); ++it )
+        {
+          REQUIRE( it->first.first < it->first.second );
+          REQUIRE( ! it->second.empty() );
+          const std::set<Z3i::SCell> surfels( it->second.begin(), it->second.end() );
+          REQUIRE( surfels.size() == it->second.size() );
+        }
+    }
+
+  SECTION( "Boundaries of each label" )
+    {
+      const int labels[] = { 1, 2, 3, 7 };
+      for ( unsigned int i = 0; i < 4; ++i )
+        {
+          const int label = labels[ i ];
+          std::set<Z3i::SCell> ref, surfels;
+          SurfaceHelper::sMakeBoundary( ref, K, HasLabel( image, label ),
+                                        domain.lowerBound(), domain.upperBound() );
+          for ( LabelBoundaries::const_iterator it = boundaries.begin(); it != boundaries.end(); ++it )
+            for ( std::vector<Z3i::SCell>::const_iterator itS = it->second.begin(); itS != it->second.end(); ++itS )
+              {
+                if ( it->first.first == label ) surfels.insert( *itS );
+                else if ( it->first.second == label ) surfels.insert( K.sOpp( *itS ) );
+              }
+          REQUIRE( surfels == ref );
+        }
+    }
+
+  SECTION( "Sequential order" )
+    {
+      std::vector<Z3i::SCell> scan;
+      const std::pair<int, int> pair( 1, 3 );
+      for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+        for ( Dimension k = 0; k < 3; ++k )
+          if ( ( *it )[ k ] < domain.upperBound()[ k ] )
+            {
+              const int here = image( *it ), further = image( *it + Z3i::Point::base( k ) );
+              if ( std::make_pair( std::min( here, further ), std::max( here, further ) ) == pair )
+                scan.push_back( K.sIncident( K.sSpel( *it, here < further ), k, true ) );
+            }
+      REQUIRE( boundaries[ pair ] == scan );
+
+#ifdef WITH_OPENMP
+      const int nbThreads = omp_get_max_threads();
+      omp_set_num_threads( 3 );
+      LabelBoundaries boundaries3;
+      SurfaceHelper::sMakeLabelBoundaries( boundaries3, K, image,
+                                           domain.lowerBound(), domain.upperBound() );
+      omp_set_num_threads( nbThreads );
+      REQUIRE( boundaries3 == boundaries );
+#endif
+    }
+
+  SECTION( "Digital surface of a pair of labels" )
+    {
+      typedef SetOfSurfels<Z3i::KSpace, std::set<Z3i::SCell> > SurfelContainer;
+      const std::vector<Z3i::SCell> & interface = boundaries[ std::make_pair( 3, 7 ) ];
+      const SurfelContainer container( K, SurfelAdjacency<3>( true ),
+                                       std::set<Z3i::SCell>( interface.begin(), interface.end() ) );
+      const DigitalSurface<SurfelContainer> surface( container );
+      REQUIRE( surface.size() == interface.size() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -105,4 +105,70 @@ TEST_CASE( "Testing ParDirCollapse" )
     }
 }
 
+TEST_CASE( "Testing parallel ParDirCollapse against the sequential one" )
+{
+  typedef map<Cell, CubicalCellData>   Map;
+  typedef CubicalComplex< KSpace, Map >     CC;
+  KSpace K;
+  CC complex ( K );
+  CC complexPar ( K );
+  ParDirCollapse < CC > thinning ( K );
+  ParDirCollapse < CC > thinningPar ( K );
+
+  SECTION("2D: eval removes the same cells")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      getComplex< CC, KSpace > ( complexPar, K );
+      thinning.attach ( &complex );
+      thinningPar.attach ( &complexPar );
+      for ( unsigned int i = 0; i < 4; ++i )
+        {
+          unsigned int removed = thinning.eval ( 1 );
+          unsigned int removedPar = thinningPar.eval ( 1, true );
+          REQUIRE( removed == removedPar );
+          bool same = functions::operator== ( complex, complexPar );
+          REQUIRE( same );
+        }
+    }
+
+  SECTION("2D: collapseIsthmus gives the same skeleton")
+    {
+      getComplex< CC, KSpace > ( complex, K );
+      getComplex< CC, KSpace > ( complexPar, K );
+      thinning.attach ( &complex );
+      thinningPar.attach ( &complexPar );
+      thinning.collapseIsthmus ();
+      thinningPar.collapseIsthmus ( true );
+      bool same = functions::operator== ( complex, complexPar );
+      REQUIRE( same );
+    }
+
+  SECTION("3D: collapseSurface gives the same complex")
+    {
+      typedef map<Z3i::Cell, CubicalCellData>      Map3;
+      typedef CubicalComplex< Z3i::KSpace, Map3 >  CC3;
+      Z3i::Domain domain ( Z3i::Point ( -8, -8, -8 ), Z3i::Point ( 8, 8, 8 ) );
+      Z3i::DigitalSet aSet ( domain );
+      srand ( 0 );
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+        if ( (*it).dot ( *it ) <= 49 && ( (*it)[0] != 0 || (*it)[1] != 0 ) && rand() % 10 != 0 )
+          aSet.insertNew ( *it );
+      Z3i::KSpace K3;
+      K3.init ( domain.lowerBound(), domain.upperBound(), true );
+      CC3 complex3 ( K3 );
+      complex3.construct ( aSet );
+      CC3 complex3Par = complex3;
+      const int eulerBefore = complex3.euler();
+      ParDirCollapse < CC3 > thinning3 ( K3 );
+      ParDirCollapse < CC3 > thinning3Par ( K3 );
+      thinning3.attach ( &complex3 );
+      thinning3Par.attach ( &complex3Par );
+      thinning3.collapseSurface ();
+      thinning3Par.collapseSurface ( true );
+      bool same = functions::operator== ( complex3, complex3Par );
+      REQUIRE( same );
+      REQUIRE( eulerBefore == complex3Par.euler() );
+    }
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,151 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelTrackBoundary.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/27
+ *
+ * Functions for testing Surfaces::parallelTrackBoundary against the
+ * sequential trackers, and its use in implicit digital surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  /// The union of two ellipsoids, a point predicate.
+  struct TwoEllipsoids
+  {
+    typedef Z3i::Point Point;
+    bool operator()( const Point & p ) const
+    {
+      const double x = p[ 0 ] / 9.0, y = p[ 1 ] / 6.5, z = p[ 2 ] / 5.0;
+      const double u = ( p[ 0 ] - 7 ) / 4.0, v = ( p[ 1 ] - 5 ) / 7.0, w = p[ 2 ] / 8.5;
+      return x * x + y * y + z * z <= 1.0 || u * u + v * v + w * w <= 1.0;
+    }
+  };
+
+  typedef Surfaces<Z3i::KSpace> SurfaceHelper;
+  typedef std::vector<Z3i::SCell> SCellRange;
+
+  /**
+     @return 'true' if @a surfels is the breadth-first traversal of @a
+     surface from its first surfel, each level sorted.
+  */
+  template <typename TSurface>
+  bool isSortedByLevels( const TSurface & surface, const SCellRange & surfels )
+  {
+    std::map<Z3i::SCell, double> distance;
+    BreadthFirstVisitor<TSurface> visitor( surface, surfels.front() );
+    for ( ; ! visitor.finished(); visitor.expand() )
+      distance[ visitor.current().first ] = visitor.current().second;
+    if ( distance.size() != surfels.size() ) return false;
+    for ( std::size_t i = 1; i < surfels.size(); ++i )
+      {
+        const double d1 = distance[ surfels[ i - 1 ] ], d2 = distance[ surfels[ i ] ];
+        if ( d1 > d2 || ( d1 == d2 && ! ( surfels[ i - 1 ] < surfels[ i ] ) ) )
+          return false;
+      }
+    return true;
+  }
+}
+
+TEST_CASE( "Testing Surfaces::parallelTrackBoundary" )
+{
+  const TwoEllipsoids shape;
+  const SurfelAdjacency<3> adj( true );
+  Z3i::KSpace K;
+
+  SECTION( "Closed boundary" )
+    {
+      K.init( Z3i::Point( -16, -16, -16 ), Z3i::Point( 16, 16, 16 ), true );
+      const Z3i::SCell bel = SurfaceHelper::findABel( K, shape, Z3i::Point( 0, 0, 0 ),
+                                                      Z3i::Point( 16, 0, 0 ) );
+      std::set<Z3i::SCell> ref, refClosed;
+      SurfaceHelper::trackBoundary( ref, K, adj, shape, bel );
+      SurfaceHelper::trackClosedBoundary( refClosed, K, adj, shape, bel );
+      SCellRange surfels, closedSurfels;
+      std::back_insert_iterator<SCellRange> out( surfels ), outClosed( closedSurfels );
+      SurfaceHelper::parallelTrackBoundary( out, K, adj, shape, bel );
+      SurfaceHelper::parallelTrackBoundary( outClosed, K, adj, shape, bel, true );
+      REQUIRE( surfels.size() == ref.size() );
+      REQUIRE( closedSurfels.size() == refClosed.size() );
+      REQUIRE( std::set<Z3i::SCell>( surfels.begin(), surfels.end() ) == ref );
+      REQUIRE( std::set<Z3i::SCell>( closedSurfels.begin(), closedSurfels.end() ) == refClosed );
+      REQUIRE( surfels.front() == bel );
+
+      typedef LightImplicitDigitalSurface<Z3i::KSpace, TwoEllipsoids> LightSurface;
+      LightSurface light( K, shape, adj, bel );
+      const DigitalSurface<LightSurface> surface( light );
+      REQUIRE( isSortedByLevels( surface, surfels ) );
+      SCellRange lightSurfels;
+      std::back_insert_iterator<SCellRange> outLight( lightSurfels );
+      light.writeSurfels( outLight );
+      REQUIRE( lightSurfels == surfels );
+      REQUIRE( light.nbSurfels() == surfels.size() );
+
+      typedef ImplicitDigitalSurface<Z3i::KSpace, TwoEllipsoids> Implicit;
+      const Implicit implicit( K, shape, adj, bel, true, true );
+      REQUIRE( implicit.nbSurfels() == refClosed.size() );
+      REQUIRE( std::equal( implicit.begin(), implicit.end(), closedSurfels.begin() ) );
+    }
+
+  SECTION( "Open boundary" )
+    {
+      // The shape is cut by the bounds of the space.
+      K.init( Z3i::Point( -6, -4, -3 ), Z3i::Point( 8, 9, 4 ), true );
+      // (-6,9,0) lies in the space bounds, outside both ellipsoids.
+      const Z3i::SCell bel = SurfaceHelper::findABel( K, shape, Z3i::Point( 0, 0, 0 ),
+                                                      Z3i::Point( -6, 9, 0 ) );
+      std::set<Z3i::SCell> ref;
+      SurfaceHelper::trackBoundary( ref, K, adj, shape, bel );
+      SCellRange surfels;
+      std::back_insert_iterator<SCellRange> out( surfels );
+      SurfaceHelper::parallelTrackBoundary( out, K, adj, shape, bel );
+      REQUIRE( std::set<Z3i::SCell>( surfels.begin(), surfels.end() ) == ref );
+      REQUIRE( surfels.size() == ref.size() );
+
+      typedef ImplicitDigitalSurface<Z3i::KSpace, TwoEllipsoids> Implicit;
+      const Implicit implicit( K, shape, adj, bel, false, true );
+      REQUIRE( std::equal( implicit.begin(), implicit.end(), surfels.begin() ) );
+      const DigitalSurface<Implicit> surface( implicit );
+      REQUIRE( isSortedByLevels( surface, surfels ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
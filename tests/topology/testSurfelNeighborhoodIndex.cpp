@@ -0,0 +1,226 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelNeighborhoodIndex.cpp
+ * @ingroup Tests
+ * @author DGtal team
+ *
+ * @date 2016/11/12
+ *
+ * Functions for testing class SurfelNeighborhoodIndex.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/topology/SurfelNeighborhoodIndex.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+namespace
+{
+  typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Boundary;
+  typedef DigitalSurface<Boundary> Surface;
+  typedef Surface::Surfel Surfel;
+  typedef SurfelNeighborhoodIndex<Boundary> NeighborhoodIndex;
+  typedef NeighborhoodIndex::Index Index;
+  typedef CanonicSCellEmbedder<Z3i::KSpace> Embedder;
+
+  /// Euclidean distance of a surfel to a center.
+  struct SurfelDistance
+  {
+    typedef double Value;
+    SurfelDistance( const Embedder & e, const Surfel & c )
+      : myEmbedder( e ), myCenter( e( c ) ) {}
+    double operator()( const Surfel & s ) const
+    {
+      return ( myEmbedder( s ) - myCenter ).norm();
+    }
+    Embedder myEmbedder;
+    Z3i::RealPoint myCenter;
+  };
+
+  /// Euclidean distance of an indexed surfel to a center.
+  struct IndexDistance
+  {
+    IndexDistance( const NeighborhoodIndex & index, const SurfelDistance & d )
+      : myIndex( &index ), myDistance( d ) {}
+    double operator()( Index i ) const
+    {
+      return myDistance( myIndex->surfel( i ) );
+    }
+    const NeighborhoodIndex * myIndex;
+    SurfelDistance myDistance;
+  };
+
+  /// Unit length edges.
+  struct UnitLength
+  {
+    double operator()( Index, Index ) const { return 1.0; }
+  };
+}
+
+TEST_CASE( "Testing SurfelNeighborhoodIndex" )
+{
+  const Z3i::Domain domain( Z3i::Point( -10, -10, -10 ), Z3i::Point( 10, 10, 10 ) );
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Z3i::DigitalSet shape_set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( shape_set, Z3i::Point( 0, 0, 0 ), 7 );
+  Shapes<Z3i::Domain>::addNorm1Ball( shape_set, Z3i::Point( 4, 3, 2 ), 5 );
+  Boundary boundary( K, shape_set );
+  Surface surface( boundary );
+  const Embedder embedder( K );
+  NeighborhoodIndex index( surface );
+
+  SECTION( "Indexing and adjacency" )
+    {
+      REQUIRE( index.isValid() );
+      REQUIRE( index.size() == surface.size() );
+      for ( Index i = 0; i < index.size(); i++ )
+        {
+          const Surfel s = index.surfel( i );
+          REQUIRE( index.isIndexed( s ) );
+          REQUIRE( index.index( s ) == i );
+          std::vector<Surfel> neighbors;
+          std::back_insert_iterator< std::vector<Surfel> > write_it = std::back_inserter( neighbors );
+          surface.writeNeighbors( write_it, s );
+          REQUIRE( index.degree( i ) == neighbors.size() );
+          unsigned int k = 0;
+          for ( NeighborhoodIndex::NeighborConstIterator it = index.neighborsBegin( i ),
+                  itE = index.neighborsEnd( i ); it != itE; ++it, ++k )
+            REQUIRE( index.surfel( *it ) == neighbors[ k ] );
+        }
+      REQUIRE( ! index.isIndexed( K.sSpel( Z3i::Point( 0, 0, 0 ) ) ) );
+    }
+
+  SECTION( "Gathering is a bounded DistanceBreadthFirstVisitor traversal" )
+    {
+      const double radii[ 3 ] = { 0.5, 3.0, 6.5 };
+      for ( Index c = 0; c < index.size(); c += 37 )
+        for ( unsigned int r = 0; r < 3; r++ )
+          {
+            const Surfel center = index.surfel( c );
+            const SurfelDistance d( embedder, center );
+            DistanceBreadthFirstVisitor< Surface, SurfelDistance > visitor( surface, d, center );
+            const NeighborhoodIndex::Neighborhood & nodes =
+              index.gather( c, IndexDistance( index, d ), radii[ r ] );
+            unsigned int k = 0;
+            while ( ! visitor.finished() && visitor.current().second < radii[ r ] )
+              {
+                REQUIRE( k < nodes.size() );
+                REQUIRE( index.surfel( nodes[ k ].first ) == visitor.current().first );
+                REQUIRE( nodes[ k ].second == visitor.current().second );
+                visitor.expand();
+                ++k;
+              }
+            REQUIRE( k == nodes.size() );
+          }
+    }
+
+  SECTION( "Cached neighborhoods" )
+    {
+      index.enableCache( 4.0 );
+      REQUIRE( index.isCached( 4.0 ) );
+      REQUIRE( ! index.isCached( 3.0 ) );
+      for ( Index c = 0; c < index.size(); c += 11 )
+        {
+          const SurfelDistance d( embedder, index.surfel( c ) );
+          const NeighborhoodIndex::Neighborhood first = index.gather( c, IndexDistance( index, d ), 4.0 );
+          // Another gather in between, not cached.
+          index.gather( ( c + 1 ) % index.size(), IndexDistance( index, d ), 2.0 );
+          const NeighborhoodIndex::Neighborhood & second = index.gather( c, IndexDistance( index, d ), 4.0 );
+          REQUIRE( first == second );
+          REQUIRE( ! first.empty() );
+          REQUIRE( first[ 0 ].first == c );
+        }
+      index.disableCache();
+      REQUIRE( ! index.isCached( 4.0 ) );
+    }
+
+  SECTION( "Gathering with caller workspaces, possibly in parallel" )
+    {
+      std::vector<NeighborhoodIndex::Neighborhood> ref( index.size() ), par( index.size() );
+      for ( Index c = 0; c < index.size(); c++ )
+        {
+          const SurfelDistance d( embedder, index.surfel( c ) );
+          ref[ c ] = index.gather( c, IndexDistance( index, d ), 3.0 );
+        }
+      const long n = static_cast<long>( index.size() );
+#ifdef WITH_OPENMP
+#pragma omp parallel
+#endif
+      {
+        NeighborhoodIndex::Workspace workspace;
+#ifdef WITH_OPENMP
+#pragma omp for
+#endif
+        for ( long c = 0; c < n; c++ )
+          {
+            const SurfelDistance d( embedder, index.surfel( Index( c ) ) );
+            par[ c ] = index.gather( workspace, Index( c ), IndexDistance( index, d ), 3.0 );
+          }
+      }
+      REQUIRE( par == ref );
+      NeighborhoodIndex::Workspace workspace;
+      for ( Index c = 0; c < index.size(); c += 53 )
+        {
+          const NeighborhoodIndex::Neighborhood geodesic = index.geodesicGather( c, UnitLength(), 5.0 );
+          REQUIRE( index.geodesicGather( workspace, c, UnitLength(), 5.0 ) == geodesic );
+        }
+    }
+
+  SECTION( "Geodesic gathering with unit edges gives topological distances" )
+    {
+      for ( Index c = 0; c < index.size(); c += 53 )
+        {
+          const Surfel center = index.surfel( c );
+          std::map<Surfel, double> ref;
+          BreadthFirstVisitor< Surface > visitor( surface, center );
+          while ( ! visitor.finished() && visitor.current().second < 5 )
+            {
+              ref[ visitor.current().first ] = visitor.current().second;
+              visitor.expand();
+            }
+          const NeighborhoodIndex::Neighborhood & nodes = index.geodesicGather( c, UnitLength(), 5.0 );
+          REQUIRE( nodes.size() == ref.size() );
+          for ( unsigned int k = 0; k < nodes.size(); k++ )
+            {
+              REQUIRE( ref.count( index.surfel( nodes[ k ].first ) ) == 1 );
+              REQUIRE( ref[ index.surfel( nodes[ k ].first ) ] == nodes[ k ].second );
+              if ( k > 0 ) REQUIRE( nodes[ k - 1 ].second <= nodes[ k ].second );
+            }
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////